@@ -255,6 +255,36 @@ static const char no_warmup_message[] =
     "Optional. Skip warmup inference. Useful for benchmarking purposes in simulated environments.\n"
     "Otherwise, not recommended.";
 
+/// @brief message for load_models option
+static const char load_models_message[] =
+    "Optional. Enables open-loop load generation mode: comma-separated list of the models which are compiled on the "
+    "same device and get the requests concurrently, each one with its own rate in requests per second: "
+    "\"<path1>:<rate1>,<path2>:<rate2>\". The requests are sent at the scheduled arrival times whether the previous "
+    "ones are completed or not, the latency is measured from the scheduled arrival time. The models should have static "
+    "shapes, the inputs are filled with random values. Cannot be used together with -m option.";
+
+/// @brief message for arrival option
+static const char arrival_message[] =
+    "Optional. Arrival process of the load generation mode.\n"
+    "                              'poisson': exponentially distributed intervals between the requests (default).\n"
+    "                              'constant': fixed intervals between the requests.\n"
+    "                              'trace': the arrivals are replayed from -arrival_trace file, the rates of "
+    "-load_models are ignored.";
+
+/// @brief message for arrival_trace option
+static const char arrival_trace_message[] =
+    "Optional. Path to a text file with the arrivals to replay, each line is \"<timestamp in ms> <model>\" where the "
+    "model is its 0-based position in -load_models list, its path or its file name without extension. The whole trace "
+    "is replayed unless -t is set.";
+
+/// @brief message for arrival_seed option
+static const char arrival_seed_message[] = "Optional. Seed of the poisson arrivals. Default value is 1.";
+
+/// @brief message for load_report option
+static const char load_report_message[] =
+    "Optional. Path to a JSON file where the per-model results of the load generation mode are stored: throughput, "
+    "latency percentiles and the latency histogram.";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -389,6 +419,21 @@ DEFINE_string(dump_config, "", dump_config_message);
 /// @brief Skips warmup inference and measures only the first inference
 DEFINE_bool(no_warmup, false, no_warmup_message);
 
+/// @brief Define parameter for the models of the load generation mode <br>
+DEFINE_string(load_models, "", load_models_message);
+
+/// @brief Define parameter for the arrival process of the load generation mode <br>
+DEFINE_string(arrival, "poisson", arrival_message);
+
+/// @brief Define parameter for the arrival trace file <br>
+DEFINE_string(arrival_trace, "", arrival_trace_message);
+
+/// @brief Define parameter for the seed of the poisson arrivals <br>
+DEFINE_uint64(arrival_seed, 1, arrival_seed_message);
+
+/// @brief Path to a JSON file where the results of the load generation mode are stored
+DEFINE_string(load_report, "", load_report_message);
+
 /**
  * @brief This function show a help message
  */
@@ -447,4 +492,11 @@ static void show_usage() {
     std::cout << "    -exec_graph_path        " << exec_graph_path_message << std::endl;
     std::cout << "    -dump_config            " << dump_config_message << std::endl;
     std::cout << "    -load_config            " << load_config_message << std::endl;
+    std::cout << std::endl;
+    std::cout << "Load generation options:" << std::endl;
+    std::cout << "    -load_models  <list>          " << load_models_message << std::endl;
+    std::cout << "    -arrival  <process>           " << arrival_message << std::endl;
+    std::cout << "    -arrival_trace  <path>        " << arrival_trace_message << std::endl;
+    std::cout << "    -arrival_seed  <integer>      " << arrival_seed_message << std::endl;
+    std::cout << "    -load_report  <path>          " << load_report_message << std::endl;
 }
@@ -50,6 +50,13 @@ public:
         _request.start_async();
     }
 
+    // the latency is measured from the given time, e.g. from the scheduled arrival of an open-loop request
+    // that had to wait for an idle infer request
+    void start_async(Time::time_point start_time) {
+        _startTime = start_time;
+        _request.start_async();
+    }
+
     void wait() {
         _request.wait();
     }
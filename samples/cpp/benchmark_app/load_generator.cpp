@@ -0,0 +1,444 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "samples/args_helper.hpp"
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+
+#include "inputs_filling.hpp"
+#include "load_generator.hpp"
+// clang-format on
+
+namespace {
+// 2^11 values with the unit resolution, then each power of two is split into 2^10 buckets
+constexpr size_t sub_bucket_bits = 11;
+constexpr uint64_t sub_bucket_count = uint64_t(1) << sub_bucket_bits;
+constexpr uint64_t sub_bucket_half_count = sub_bucket_count / 2;
+// about 12 days in microseconds, longer latencies are clamped
+constexpr uint64_t max_trackable_value_us = (uint64_t(1) << 40) - 1;
+
+uint64_t to_microseconds(double latency_ms) {
+    const auto value = std::llround(std::max(latency_ms, 0.0) * 1000.0);
+    return std::min(static_cast<uint64_t>(value), max_trackable_value_us);
+}
+
+std::string model_base_name(const std::string& path) {
+    const auto pos = path.find_last_of("/\\");
+    return fileNameNoExt(pos == std::string::npos ? path : path.substr(pos + 1));
+}
+
+size_t find_trace_model(const std::string& model, const std::vector<LoadModel>& models) {
+    if (!model.empty() && std::all_of(model.begin(), model.end(), [](unsigned char c) {
+            return std::isdigit(c);
+        })) {
+        const auto index = std::stoull(model);
+        if (index >= models.size()) {
+            throw std::logic_error("Arrival trace refers to the model " + model + ", but only " +
+                                   std::to_string(models.size()) + " models are set by -load_models option");
+        }
+        return static_cast<size_t>(index);
+    }
+    for (size_t i = 0; i < models.size(); i++) {
+        if (models[i].path == model || model_base_name(models[i].path) == model) {
+            return i;
+        }
+    }
+    throw std::logic_error("Arrival trace refers to the model '" + model + "' which is not set by -load_models option");
+}
+}  // namespace
+
+LatencyHistogram::LatencyHistogram() : _counts(index_of(max_trackable_value_us) + 1, 0) {}
+
+size_t LatencyHistogram::index_of(uint64_t value_us) {
+    if (value_us < sub_bucket_count) {
+        return static_cast<size_t>(value_us);
+    }
+    // shift keeps the value in [sub_bucket_half_count, sub_bucket_count)
+    size_t shift = 0;
+    while ((value_us >> shift) >= sub_bucket_count) {
+        shift++;
+    }
+    return static_cast<size_t>(sub_bucket_count + (shift - 1) * sub_bucket_half_count +
+                               ((value_us >> shift) - sub_bucket_half_count));
+}
+
+uint64_t LatencyHistogram::highest_equivalent_value(size_t index) {
+    if (index < sub_bucket_count) {
+        return index;
+    }
+    const auto shift = (index - sub_bucket_count) / sub_bucket_half_count + 1;
+    const auto sub_bucket = (index - sub_bucket_count) % sub_bucket_half_count + sub_bucket_half_count;
+    return ((sub_bucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(double latency_ms) {
+    const auto value = to_microseconds(latency_ms);
+    _counts[index_of(value)]++;
+    _count++;
+    _min_us = std::min(_min_us, value);
+    _max_us = std::max(_max_us, value);
+    _sum_us += static_cast<double>(value);
+}
+
+double LatencyHistogram::percentile(double percentile) const {
+    if (_count == 0) {
+        return 0;
+    }
+    const auto rank =
+        std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(_count))));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < _counts.size(); i++) {
+        seen += _counts[i];
+        if (seen >= rank) {
+            return std::min(highest_equivalent_value(i), _max_us) / 1000.0;
+        }
+    }
+    return max();
+}
+
+double LatencyHistogram::min() const {
+    return _count == 0 ? 0 : _min_us / 1000.0;
+}
+
+double LatencyHistogram::max() const {
+    return _max_us / 1000.0;
+}
+
+double LatencyHistogram::mean() const {
+    return _count == 0 ? 0 : _sum_us / static_cast<double>(_count) / 1000.0;
+}
+
+nlohmann::json LatencyHistogram::buckets_to_json() const {
+    auto buckets = nlohmann::json::array();
+    for (size_t i = 0; i < _counts.size(); i++) {
+        if (_counts[i] != 0) {
+            buckets.push_back({{"le", highest_equivalent_value(i) / 1000.0}, {"count", _counts[i]}});
+        }
+    }
+    return buckets;
+}
+
+std::vector<LoadModel> parse_load_models(const std::string& load_models_string) {
+    std::vector<LoadModel> models;
+    for (const auto& item : split(load_models_string, ',')) {
+        if (item.empty()) {
+            continue;
+        }
+        LoadModel model{item, 0};
+        // the rate is optional and the path may contain ':' itself (e.g. a drive letter)
+        const auto pos = item.rfind(':');
+        if (pos != std::string::npos) {
+            const auto rate_string = item.substr(pos + 1);
+            try {
+                size_t parsed = 0;
+                const auto rate = std::stod(rate_string, &parsed);
+                if (parsed == rate_string.size()) {
+                    if (rate <= 0) {
+                        throw std::logic_error("Rate of the model " + item.substr(0, pos) +
+                                               " should be positive (invalid -load_models option value)");
+                    }
+                    model = {item.substr(0, pos), rate};
+                }
+            } catch (const std::invalid_argument&) {
+            } catch (const std::out_of_range&) {
+            }
+        }
+        models.push_back(model);
+    }
+    if (models.empty()) {
+        throw std::logic_error("No models are set by -load_models option");
+    }
+    return models;
+}
+
+ArrivalSchedule::ArrivalSchedule(const std::string& arrival, double rate, uint64_t seed)
+    : _arrival(arrival),
+      _rate(rate),
+      _generator(seed),
+      _interval(rate) {}
+
+ArrivalSchedule::ArrivalSchedule(std::vector<ns> trace) : _arrival(traceArrival), _trace(std::move(trace)) {}
+
+bool ArrivalSchedule::next(ns deadline, ns& arrival) {
+    if (_arrival == traceArrival) {
+        if (_position == _trace.size() || _trace[_position] >= deadline) {
+            return false;
+        }
+        arrival = _trace[_position++];
+        return true;
+    }
+    const auto interval_s = _arrival == poissonArrival ? _interval(_generator) : 1.0 / _rate;
+    // the first arrival of the constant rate is at the start of the run
+    if (_arrival == poissonArrival || _position++ != 0) {
+        _time += ns(static_cast<int64_t>(interval_s * 1.0e9));
+    }
+    if (_time >= deadline) {
+        return false;
+    }
+    arrival = _time;
+    return true;
+}
+
+std::vector<std::vector<ns>> read_arrival_trace(const std::string& trace_path, const std::vector<LoadModel>& models) {
+    std::ifstream trace_file(trace_path);
+    if (!trace_file.is_open()) {
+        throw std::logic_error("Cannot open arrival trace " + trace_path);
+    }
+
+    std::vector<std::vector<double>> timestamps(models.size());
+    double first_timestamp = 0;
+    bool empty = true;
+    std::string line;
+    size_t line_number = 0;
+    while (std::getline(trace_file, line)) {
+        line_number++;
+        const auto begin = line.find_first_not_of(" \t\r");
+        if (begin == std::string::npos || line[begin] == '#') {
+            continue;
+        }
+        std::istringstream line_stream(line);
+        double timestamp = 0;
+        std::string model;
+        if (!(line_stream >> timestamp >> model)) {
+            throw std::logic_error("Incorrect line " + std::to_string(line_number) + " of arrival trace " +
+                                   trace_path + ", \"<timestamp in ms> <model>\" is expected");
+        }
+        timestamps[find_trace_model(model, models)].push_back(timestamp);
+        first_timestamp = empty ? timestamp : std::min(first_timestamp, timestamp);
+        empty = false;
+    }
+    if (empty) {
+        throw std::logic_error("Arrival trace " + trace_path + " has no arrivals");
+    }
+
+    std::vector<std::vector<ns>> arrivals(models.size());
+    for (size_t i = 0; i < models.size(); i++) {
+        for (const auto timestamp : timestamps[i]) {
+            arrivals[i].emplace_back(static_cast<int64_t>((timestamp - first_timestamp) * 1.0e6));
+        }
+        std::sort(arrivals[i].begin(), arrivals[i].end());
+    }
+    return arrivals;
+}
+
+LoadGenerator::LoadGenerator(std::vector<LoadModel> models, std::string arrival, std::string trace_path, uint64_t seed)
+    : _arrival(std::move(arrival)),
+      _trace_path(std::move(trace_path)),
+      _seed(seed) {
+    std::vector<std::vector<ns>> trace;
+    if (_arrival == traceArrival) {
+        trace = read_arrival_trace(_trace_path, models);
+    }
+    _models.resize(models.size());
+    for (size_t i = 0; i < models.size(); i++) {
+        if (_arrival != traceArrival && models[i].rate <= 0) {
+            throw std::logic_error("Rate of the model " + models[i].path + " is required for " + _arrival +
+                                   " arrivals, please set it as -load_models \"<path>:<requests per second>\"");
+        }
+        _models[i].config = models[i];
+        _models[i].schedule = _arrival == traceArrival
+                                  ? std::make_unique<ArrivalSchedule>(std::move(trace[i]))
+                                  : std::make_unique<ArrivalSchedule>(_arrival, models[i].rate, _seed + i);
+    }
+}
+
+void LoadGenerator::compile_models(ov::Core& core, const std::string& device_name, const ov::AnyMap& device_config) {
+    for (auto& model : _models) {
+        const auto& path = model.config.path;
+        auto start_time = Time::now();
+        if (fileExt(path) == "blob") {
+            std::ifstream model_stream(path, std::ios_base::binary | std::ios_base::in);
+            if (!model_stream.is_open()) {
+                throw std::runtime_error("Cannot open model file " + path);
+            }
+            model.compiled_model = core.import_model(model_stream, device_name, device_config);
+        } else {
+            model.compiled_model = core.compile_model(path, device_name, device_config);
+        }
+        slog::info << "Compile model " << path << " took " << double_to_string(get_duration_ms_till_now(start_time))
+                   << " ms" << slog::endl;
+        printInputAndOutputsInfoShort(model.compiled_model);
+    }
+}
+
+void LoadGenerator::create_infer_requests(uint64_t nireq) {
+    for (auto& model : _models) {
+        const auto& path = model.config.path;
+        auto model_nireq = nireq;
+        if (model_nireq == 0) {
+            try {
+                model_nireq = model.compiled_model.get_property(ov::optimal_number_of_infer_requests);
+            } catch (const std::exception& ex) {
+                OPENVINO_THROW("Every device used with the benchmark_app should support " +
+                               std::string(ov::optimal_number_of_infer_requests.name()) +
+                               " Failed to query the metric for the model " + path + " with error: " + ex.what());
+            }
+        }
+        model.requests = std::make_unique<InferRequestsQueue>(model.compiled_model, model_nireq, 1, false);
+
+        auto app_inputs_info = get_inputs_info("", "", 0, "", {}, "", "", model.compiled_model.inputs());
+        for (const auto& item : app_inputs_info.at(0)) {
+            if (item.second.partialShape.is_dynamic()) {
+                throw std::logic_error("Load generation mode supports models with static shapes only, input " +
+                                       item.first + " of the model " + path + " is dynamic");
+            }
+        }
+        auto inputs_data =
+            get_tensors_static_case({}, get_batch_size(app_inputs_info.at(0)), app_inputs_info.at(0), model_nireq);
+        size_t i = 0;
+        for (auto& request : model.requests->requests) {
+            for (const auto& item : app_inputs_info.at(0)) {
+                const auto& tensors = inputs_data.at(item.first);
+                auto request_tensor = request->get_tensor(item.first);
+                copy_tensor_data(request_tensor, tensors[i % tensors.size()]);
+            }
+            i++;
+        }
+        slog::info << "Model " << path << ": " << model_nireq << " inference requests" << slog::endl;
+    }
+}
+
+void LoadGenerator::warm_up() {
+    for (auto& model : _models) {
+        model.requests->get_idle_request()->start_async();
+        model.requests->wait_all();
+        slog::info << "First inference of the model " << model.config.path << " took "
+                   << double_to_string(model.requests->get_latencies().at(0)) << " ms" << slog::endl;
+        model.requests->reset_times();
+    }
+}
+
+void LoadGenerator::dispatch(ModelState& model, Time::time_point start, ns deadline) {
+    ns arrival{0};
+    while (model.schedule->next(deadline, arrival)) {
+        const auto scheduled_time = start + std::chrono::duration_cast<Time::duration>(arrival);
+        std::this_thread::sleep_until(scheduled_time);
+        // blocks while all the requests are busy, so the late arrivals are served in the order they were scheduled
+        auto request = model.requests->get_idle_request();
+        const auto lag_ms = std::chrono::duration_cast<ns>(Time::now() - scheduled_time).count() * 0.000001;
+        model.max_dispatch_lag_ms = std::max(model.max_dispatch_lag_ms, lag_ms);
+        request->start_async(scheduled_time);
+    }
+    model.requests->wait_all();
+}
+
+void LoadGenerator::run(uint64_t duration_seconds) {
+    ns deadline(get_duration_in_nanoseconds(duration_seconds));
+    if (duration_seconds == 0) {
+        // the whole trace is replayed
+        deadline = ns::max();
+    }
+
+    std::vector<std::thread> dispatchers;
+    std::vector<std::exception_ptr> exceptions(_models.size());
+    const auto start = Time::now();
+    for (size_t i = 0; i < _models.size(); i++) {
+        dispatchers.emplace_back([this, i, start, deadline, &exceptions] {
+            try {
+                dispatch(_models[i], start, deadline);
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& dispatcher : dispatchers) {
+        dispatcher.join();
+    }
+    _duration_ms = std::chrono::duration_cast<ns>(Time::now() - start).count() * 0.000001;
+    for (const auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    for (auto& model : _models) {
+        for (const auto latency : model.requests->get_latencies()) {
+            model.histogram.record(latency);
+        }
+        model.duration_ms = model.requests->get_duration_in_milliseconds();
+    }
+}
+
+void LoadGenerator::report(const std::string& report_path) const {
+    static const std::vector<std::pair<std::string, double>> percentiles = {{"p50", 50.0},
+                                                                            {"p90", 90.0},
+                                                                            {"p99", 99.0},
+                                                                            {"p99.9", 99.9}};
+
+    nlohmann::json js;
+    js["arrival"] = _arrival;
+    if (_arrival == traceArrival) {
+        js["arrival_trace"] = _trace_path;
+    }
+    js["duration"] = _duration_ms;
+    js["models"] = nlohmann::json::array();
+
+    slog::info << "Duration:            " << double_to_string(_duration_ms) << " ms" << slog::endl;
+    for (const auto& model : _models) {
+        const auto& histogram = model.histogram;
+        const double throughput = model.duration_ms > 0 ? 1000.0 * histogram.count() / model.duration_ms : 0;
+
+        slog::info << "Model:               " << model.config.path << slog::endl;
+        if (_arrival != traceArrival) {
+            slog::info << "  Offered rate:      " << double_to_string(model.config.rate) << " requests/s (" << _arrival
+                       << ")" << slog::endl;
+        }
+        slog::info << "  Count:             " << histogram.count() << " requests" << slog::endl;
+        slog::info << "  Throughput:        " << double_to_string(throughput) << " requests/s" << slog::endl;
+        slog::info << "  Max dispatch lag:  " << double_to_string(model.max_dispatch_lag_ms) << " ms" << slog::endl;
+        slog::info << "  Latency from the scheduled arrival:" << slog::endl;
+        slog::info << "    Min:             " << double_to_string(histogram.min()) << " ms" << slog::endl;
+        slog::info << "    Average:         " << double_to_string(histogram.mean()) << " ms" << slog::endl;
+        for (const auto& percentile : percentiles) {
+            std::stringstream label;
+            label << "    " << percentile.first << ":";
+            slog::info << std::left << std::setw(21) << label.str()
+                       << double_to_string(histogram.percentile(percentile.second)) << " ms" << slog::endl;
+        }
+        slog::info << "    Max:             " << double_to_string(histogram.max()) << " ms" << slog::endl;
+
+        nlohmann::json latency;
+        latency["min"] = histogram.min();
+        latency["avg"] = histogram.mean();
+        for (const auto& percentile : percentiles) {
+            latency[percentile.first] = histogram.percentile(percentile.second);
+        }
+        latency["max"] = histogram.max();
+
+        nlohmann::json model_js;
+        model_js["model"] = model.config.path;
+        if (_arrival != traceArrival) {
+            model_js["offered_rate"] = model.config.rate;
+        }
+        model_js["nireq"] = model.requests->requests.size();
+        model_js["requests"] = histogram.count();
+        model_js["throughput"] = throughput;
+        model_js["max_dispatch_lag"] = model.max_dispatch_lag_ms;
+        model_js["latency"] = latency;
+        model_js["histogram"] = histogram.buckets_to_json();
+        js["models"].push_back(model_js);
+    }
+
+    if (!report_path.empty()) {
+        std::ofstream out_stream(report_path);
+        if (!out_stream.is_open()) {
+            throw std::runtime_error("Cannot open load report file " + report_path);
+        }
+        out_stream << std::setw(4) << js << std::endl;
+        slog::info << "Load report is stored to " << report_path << slog::endl;
+    }
+}
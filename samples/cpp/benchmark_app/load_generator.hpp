@@ -0,0 +1,134 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <openvino/openvino.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef JSON_HEADER
+#    include <json.hpp>
+#else
+#    include <nlohmann/json.hpp>
+#endif
+
+// clang-format off
+#include "infer_request_wrap.hpp"
+#include "utils.hpp"
+// clang-format on
+
+// @brief arrival processes of the load generation mode
+static constexpr char poissonArrival[] = "poisson";
+static constexpr char constantArrival[] = "constant";
+static constexpr char traceArrival[] = "trace";
+
+/// @brief Latency histogram with logarithmic buckets, the values are kept with 3 significant digits
+/// (HdrHistogram-like layout), so the histograms of different runs and hosts can be merged bucket by bucket
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    void record(double latency_ms);
+
+    /// @brief Returns the highest latency in the bucket the percentile falls into, in milliseconds
+    double percentile(double percentile) const;
+
+    uint64_t count() const {
+        return _count;
+    }
+    double min() const;
+    double max() const;
+    double mean() const;
+
+    /// @brief Non empty buckets as the list of {"le": <upper bound in ms>, "count": <number of values>}
+    nlohmann::json buckets_to_json() const;
+
+private:
+    static size_t index_of(uint64_t value_us);
+    static uint64_t highest_equivalent_value(size_t index);
+
+    std::vector<uint64_t> _counts;
+    uint64_t _count = 0;
+    uint64_t _min_us = UINT64_MAX;
+    uint64_t _max_us = 0;
+    double _sum_us = 0;
+};
+
+/// @brief Model loaded by the load generator together with its offered rate
+struct LoadModel {
+    std::string path;
+    /// requests per second, not used for the trace arrivals
+    double rate = 0;
+};
+
+/// @brief Parses "<path>[:<rate>],<path>[:<rate>]" string of -load_models option
+std::vector<LoadModel> parse_load_models(const std::string& load_models_string);
+
+/// @brief Generates the arrival times of the requests of a model relatively to the start of the run
+class ArrivalSchedule {
+public:
+    ArrivalSchedule(const std::string& arrival, double rate, uint64_t seed);
+    explicit ArrivalSchedule(std::vector<ns> trace);
+
+    /// @brief Returns false when there are no arrivals before the deadline anymore
+    bool next(ns deadline, ns& arrival);
+
+private:
+    std::string _arrival;
+    double _rate = 0;
+    std::mt19937_64 _generator;
+    std::exponential_distribution<double> _interval;
+    std::vector<ns> _trace;
+    size_t _position = 0;
+    ns _time{0};
+};
+
+/// @brief Reads the arrival trace, each line is "<timestamp in ms> <model>" where the model is its position in
+/// -load_models list, its path or its file name without extension. The arrivals of every model are shifted by the
+/// first timestamp of the trace.
+std::vector<std::vector<ns>> read_arrival_trace(const std::string& trace_path, const std::vector<LoadModel>& models);
+
+/// @brief Open-loop load generator: several models compiled on the same ov::Core get the requests at the scheduled
+/// arrival times independently of the completion of the previous ones. The latency is measured from the scheduled
+/// arrival time, so the time an arrival waits for an idle infer request is not omitted from the statistics.
+class LoadGenerator {
+public:
+    LoadGenerator(std::vector<LoadModel> models, std::string arrival, std::string trace_path, uint64_t seed);
+
+    void compile_models(ov::Core& core, const std::string& device_name, const ov::AnyMap& device_config);
+
+    void create_infer_requests(uint64_t nireq);
+
+    void warm_up();
+
+    /// @brief Runs the arrivals until the duration expires (the trace end if duration is 0) and waits for all the
+    /// arrivals issued before, including the ones that were queued behind the busy infer requests
+    void run(uint64_t duration_seconds);
+
+    void report(const std::string& report_path) const;
+
+private:
+    struct ModelState {
+        LoadModel config;
+        ov::CompiledModel compiled_model;
+        std::unique_ptr<InferRequestsQueue> requests;
+        std::unique_ptr<ArrivalSchedule> schedule;
+        LatencyHistogram histogram;
+        double max_dispatch_lag_ms = 0;
+        double duration_ms = 0;
+    };
+
+    void dispatch(ModelState& model, Time::time_point start, ns deadline);
+
+    std::string _arrival;
+    std::string _trace_path;
+    uint64_t _seed;
+    std::vector<ModelState> _models;
+    double _duration_ms = 0;
+};
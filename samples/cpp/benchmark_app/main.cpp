@@ -32,6 +32,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -131,11 +132,29 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_load_models.empty()) {
         show_usage();
         throw std::logic_error("Model is required but not set. Please set -m option.");
     }
 
+    if (!FLAGS_load_models.empty()) {
+        if (!FLAGS_m.empty()) {
+            throw std::logic_error("-m and -load_models options cannot be used together.");
+        }
+        if (FLAGS_arrival != poissonArrival && FLAGS_arrival != constantArrival && FLAGS_arrival != traceArrival) {
+            throw std::logic_error("Incorrect arrival process. Please set -arrival option to `poisson`, `constant` or "
+                                   "`trace` value.");
+        }
+        if ((FLAGS_arrival == traceArrival) == FLAGS_arrival_trace.empty()) {
+            throw std::logic_error("-arrival_trace option should be set for `trace` arrivals only.");
+        }
+        if (FLAGS_api == "sync" || FLAGS_niter != 0) {
+            throw std::logic_error("Load generation mode runs the requests asynchronously for the time set by -t "
+                                   "option, -api sync and -niter options are not supported.");
+        }
+        FLAGS_api = "async";
+    }
+
     if (FLAGS_latency_percentile > 100 || FLAGS_latency_percentile < 1) {
         show_usage();
         throw std::logic_error("The percentile value is incorrect. The applicable values range is [1, 100].");
@@ -629,6 +648,65 @@ int main(int argc, char* argv[]) {
             device_config.insert(ov::hint::allow_auto_batching(false));
         }
 
+        if (!FLAGS_load_models.empty()) {
+            LoadGenerator generator(parse_load_models(FLAGS_load_models),
+                                    FLAGS_arrival,
+                                    FLAGS_arrival_trace,
+                                    FLAGS_arrival_seed);
+            for (size_t i = 0; i < 3; i++) {
+                next_step();
+                slog::info << "Skipping the step for load generation mode" << slog::endl;
+            }
+            // ----------------- 7. Loading the models to the device
+            // --------------------------------------------------------
+            next_step();
+            generator.compile_models(core, device_name, device_config);
+
+            // ----------------- 8. Querying optimal runtime parameters
+            // -----------------------------------------------------
+            next_step();
+            uint64_t duration_seconds = FLAGS_t;
+            if (duration_seconds == 0 && FLAGS_arrival != traceArrival) {
+                duration_seconds = device_default_device_duration_in_seconds(device_name);
+            }
+
+            // ----------------- 9. Creating infer requests and filling input blobs
+            // ----------------------------------------
+            next_step();
+            generator.create_infer_requests(FLAGS_nireq);
+
+            // ----------------- 10. Measuring performance
+            // ------------------------------------------------------------------
+            std::stringstream ss;
+            ss << "Start open-loop inference with " << FLAGS_arrival << " arrivals, limits: ";
+            if (duration_seconds > 0) {
+                ss << get_duration_in_milliseconds(duration_seconds) << " ms duration";
+            } else {
+                ss << "end of the arrival trace";
+            }
+            next_step(ss.str());
+
+            if (!FLAGS_no_warmup) {
+                generator.warm_up();
+            } else {
+                slog::info << "Skipping warmup inference due to -no_warmup flag" << slog::endl;
+            }
+            generator.run(duration_seconds);
+
+            // ----------------- 11. Dumping statistics report
+            // -------------------------------------------------------------
+            next_step();
+            if (!FLAGS_dump_config.empty()) {
+                dump_config(FLAGS_dump_config, config);
+                slog::info << "OpenVINO Runtime configuration settings were dumped to " << FLAGS_dump_config
+                           << slog::endl;
+            }
+            if (statistics)
+                statistics->dump();
+            generator.report(FLAGS_load_report);
+            return 0;
+        }
+
         bool isDynamicNetwork = false;
         auto areNetworkInputsDynamic = [](const benchmark_app::InputsInfo& input_info) {
             return std::any_of(input_info.begin(), input_info.end(), [](const auto& info) {
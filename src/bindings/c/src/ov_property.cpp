@@ -37,6 +37,7 @@ const char* ov_property_key_hint_execution_mode = "EXECUTION_MODE_HINT";
 const char* ov_property_key_force_tbb_terminate = "FORCE_TBB_TERMINATE";
 const char* ov_property_key_enable_mmap = "ENABLE_MMAP";
 const char* ov_property_key_auto_batch_timeout = "AUTO_BATCH_TIMEOUT";
+const char* ov_property_key_auto_batch_target_latency = "AUTO_BATCH_TARGET_LATENCY";
 const char* ov_property_key_intel_gpu_config_file = "CONFIG_FILE";
 
 // Write-only property key
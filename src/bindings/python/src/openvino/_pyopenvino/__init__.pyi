@@ -5164,11 +5164,37 @@ class VariableState:
     """
     def __repr__(self) -> str:
         ...
+    def fork_from(self, source: VariableState) -> None:
+        """
+                Sets the value of another variable state for the next inference.
+                The data may be shared by both states until one of them is changed.
+        
+                :param source: The state of the same variable, e.g. of another infer request.
+                :type source: openvino.VariableState
+        """
+    def offload(self) -> None:
+        """
+                Moves the state out of the working memory of the infer request until the next inference.
+                The restored state is the same as the offloaded one.
+        """
+    def prefetch(self) -> None:
+        """
+                Starts restoring of the offloaded state in background ahead of the next inference.
+        """
     def reset(self) -> None:
         """
                 Reset internal variable state for relevant infer request,
                 to a value specified as default for according node.
         """
+    def truncate(self, length: typing.SupportsInt | typing.SupportsIndex) -> None:
+        """
+                Keeps only the first elements of the state along its sequence axis.
+                Only the states which have a sequence axis support it (e.g. the KV-cache
+                states of the CPU plugin), the other ones raise RuntimeError.
+        
+                :param length: The number of the elements to keep.
+                :type length: int
+        """
     @property
     def name(self) -> str:
         """
@@ -26,6 +26,42 @@ void regclass_VariableState(py::module m) {
         to a value specified as default for according node.
     )");
 
+    variable_st.def("fork_from",
+                    &ov::VariableState::fork_from,
+                    py::arg("source"),
+                    R"(
+        Sets the value of another variable state for the next inference.
+        The data may be shared by both states until one of them is changed.
+
+        :param source: The state of the same variable, e.g. of another infer request.
+        :type source: openvino.VariableState
+    )");
+
+    variable_st.def("truncate",
+                    &ov::VariableState::truncate,
+                    py::arg("length"),
+                    R"(
+        Keeps only the first elements of the state along its sequence axis.
+        Only the states which have a sequence axis support it (e.g. the KV-cache
+        states of the CPU plugin), the other ones raise RuntimeError.
+
+        :param length: The number of the elements to keep.
+        :type length: int
+    )");
+
+    variable_st.def("offload",
+                    &ov::VariableState::offload,
+                    R"(
+        Moves the state out of the working memory of the infer request until the next inference.
+        The restored state is the same as the offloaded one.
+    )");
+
+    variable_st.def("prefetch",
+                    &ov::VariableState::prefetch,
+                    R"(
+        Starts restoring of the offloaded state in background ahead of the next inference.
+    )");
+
     variable_st.def_property_readonly("name",
                                       &ov::VariableState::get_name,
                                       R"(
@@ -252,6 +252,14 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (np.uint32(37), np.uint32(37)),
             ),
         ),
+        (
+            props.auto_batch_target_latency,
+            "AUTO_BATCH_TARGET_LATENCY",
+            (
+                (21, 21),
+                (np.uint32(37), 37),
+            ),
+        ),
         (
             props.inference_num_threads,
             "INFERENCE_NUM_THREADS",
@@ -215,6 +215,9 @@ bool ov::pass::MOCTransformations::run_on_model(const std::shared_ptr<ov::Model>
     ADD_MATCHER(eliminations, NopElimination, m_use_shapes)
     ADD_MATCHER(eliminations, SelectWithOneValueCondition)
     eliminations->set_name("ov::pass::CommonEliminations");
+    // an eliminated node may turn its already visited producers into nops, so the touched nodes are revisited
+    // instead of running the eliminations over the whole model again
+    eliminations->set_revisit_touched_nodes(true);
 
     manager.register_pass<ov::pass::ConstantFolding>();
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include "openvino/core/attribute_adapter.hpp"
@@ -65,6 +66,27 @@ public:
 
     virtual std::shared_ptr<IBufferDescriptor> get_descriptor() const;
 
+    /// \brief Returns the digest of the buffer content computed by ov::runtime::compute_hash.
+    /// If is_hash_memoizable(), the digest is memoized until invalidate_hash() is called, so repeated calls (i.e.
+    /// hashing the same model for several compilations) don't read the data again. Otherwise it is computed on every
+    /// call.
+    size_t get_hash() const;
+
+    /// \brief Drops the memoized digest, must be called by the writers which modify the data after it is hashed.
+    void invalidate_hash() const {
+        if (m_hash_computed.load(std::memory_order_relaxed)) {
+            m_hash_computed.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    /// \brief Returns true if the data is modified only by the writers which call invalidate_hash(): the buffer owns
+    /// its memory, or shares the read-only memory (i.e. the mapped weights file or the weights buffer of the model read
+    /// from IR). The other shared memory (i.e. SharedBuffer over ov::Tensor) may be modified by its owner bypassing
+    /// the buffer.
+    bool is_hash_memoizable() const {
+        return m_allocated_buffer != nullptr || m_read_only;
+    }
+
     AlignedBuffer(const AlignedBuffer&) = delete;
     AlignedBuffer& operator=(const AlignedBuffer&) = delete;
 
@@ -72,6 +94,11 @@ protected:
     char* m_allocated_buffer;
     char* m_aligned_buffer;
     size_t m_byte_size;
+    bool m_read_only = false;
+
+private:
+    mutable std::atomic<size_t> m_hash{0};
+    mutable std::atomic_bool m_hash_computed{false};
 };
 
 template <>
@@ -96,15 +96,20 @@ public:
         std::enable_if_t<!is_aligned_buffer_ptr_v<U> && !std::is_same_v<U, std::shared_ptr<ov::MappedMemory>>, int> = 0>
     SharedBuffer(char* data, size_t size, const T& shared_object) : SharedBufferBase<T>(data, size, shared_object) {}
 
-    // For AlignedBuffer-derived shared_ptr types: auto-inherit descriptor
+    // For AlignedBuffer-derived shared_ptr types: auto-inherit descriptor, the digest of the view is memoized as the
+    // digest of the source buffer
     template <typename U = T, std::enable_if_t<is_aligned_buffer_ptr_v<U>, int> = 0>
     SharedBuffer(char* data, size_t size, const T& shared_object)
-        : SharedBufferBase<T>(data, size, shared_object, shared_object ? shared_object->get_descriptor() : nullptr) {}
+        : SharedBufferBase<T>(data, size, shared_object, shared_object ? shared_object->get_descriptor() : nullptr) {
+        this->m_read_only = shared_object && shared_object->is_hash_memoizable();
+    }
 
-    // For MappedMemory: auto-create mmap descriptor
+    // For MappedMemory: auto-create mmap descriptor, the file is mapped read-only
     template <typename U = T, std::enable_if_t<std::is_same_v<U, std::shared_ptr<ov::MappedMemory>>, int> = 0>
     SharedBuffer(char* data, size_t size, const T& shared_object)
-        : SharedBufferBase<T>(data, size, shared_object, detail::create_mmap_descriptor(shared_object)) {}
+        : SharedBufferBase<T>(data, size, shared_object, detail::create_mmap_descriptor(shared_object)) {
+        this->m_read_only = true;
+    }
 };
 
 /// \brief SharedStreamBuffer class to store pointer to pre-allocated buffer and provide streambuf interface.
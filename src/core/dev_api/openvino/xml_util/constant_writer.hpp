@@ -4,14 +4,17 @@
 
 #pragma once
 
+#include <filesystem>
 #include <iostream>
 #include <map>
+#include <optional>
 #include <string_view>
 #include <vector>
 
 #include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/visibility.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 
 namespace ov::util {
 
@@ -33,21 +36,96 @@ public:
 
     virtual FilePosition write(const std::vector<std::string_view>& chunks, size_t& new_size);
 
+    /**
+     * @brief Writes the whole buffer, the digest memoized by the buffer is passed to the pointer based write() to be
+     * used instead of hashing the data again, ConstantWriter doesn't use it for the compressed data. The data is
+     * written by the pointer based write(), so the derived writers which override it keep their behavior.
+     */
+    FilePosition write(const ov::AlignedBuffer& buffer,
+                       size_t& new_size,
+                       bool compress_to_fp16 = false,
+                       ov::element::Type src_type = ov::element::dynamic,
+                       bool ptr_is_temporary = false);
+
     uint64_t get_data_hash() const {
         return m_data_hash;
     }
 
-private:
+protected:
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
                                                          const element::Type& src_type,
                                                          size_t& compressed_size);
 
-    ConstWritePositions m_hash_to_file_positions;
-    std::vector<std::vector<char>> m_packed_string_data;
+    /**
+     * @brief Converts num_elements values of src_type (f32 or f64) to f16 values written to dst.
+     */
+    static void convert_to_fp16(const char* ptr, size_t num_elements, const element::Type& src_type, char* dst);
+
     std::reference_wrapper<std::ostream> m_binary_output;
     bool m_enable_compression;
     FilePosition m_blob_offset;  // blob offset inside output stream
     uint64_t m_data_hash;
+    std::optional<HashValue> m_precomputed_hash;  // digest of the data passed to the next write() call
+
+private:
+    ConstWritePositions m_hash_to_file_positions;
+    std::vector<std::vector<char>> m_packed_string_data;
+};
+
+/**
+ * @brief Writes the weights of the IR to a file by several threads. The write() calls only place the data in the blob,
+ * the data is compressed and written by flush() from the threads, each of them writes a contiguous range of the file by
+ * its own stream. The blob has the same layout as the one written by ConstantWriter.
+ *
+ * The data passed to write() has to be valid until flush() unless ptr_is_temporary is set, such data is copied.
+ */
+class OPENVINO_API ParallelConstantWriter : public ConstantWriter {
+public:
+    static constexpr size_t default_chunk_size = 16 * 1024 * 1024;
+
+    /**
+     * @param bin_data    Stream of the file bin_path, the blob starts at its current position.
+     * @param chunk_size  Max number of the source bytes written by a thread at once.
+     */
+    ParallelConstantWriter(std::ostream& bin_data,
+                           std::filesystem::path bin_path,
+                           bool enable_compression = true,
+                           size_t chunk_size = default_chunk_size);
+
+    FilePosition write(const char* ptr,
+                       size_t size,
+                       size_t& new_size,
+                       bool compress_to_fp16 = false,
+                       ov::element::Type src_type = ov::element::dynamic,
+                       bool ptr_is_temporary = false) override;
+
+    FilePosition write(const std::vector<std::string_view>& chunks, size_t& new_size) override;
+
+    using ConstantWriter::write;
+
+    /**
+     * @brief Writes the placed data to the file, the stream is positioned at the end of the blob after the call. The
+     * data written after the call isn't deduplicated with the flushed one.
+     */
+    void flush();
+
+private:
+    struct Entry {
+        const char* ptr;
+        size_t size;                 // size of the source data
+        ov::element::Type src_type;  // type of the data compressed to f16, dynamic if it isn't compressed
+        FilePosition offset;
+    };
+
+    std::optional<FilePosition> find(const char* ptr, size_t size, ov::element::Type src_type, HashValue hash) const;
+    FilePosition place(const char* ptr, size_t size, size_t new_size, ov::element::Type src_type);
+
+    std::filesystem::path m_bin_path;
+    size_t m_chunk_size;
+    FilePosition m_blob_size;
+    std::vector<Entry> m_entries;
+    std::multimap<HashValue, size_t> m_hash_to_entries;
+    std::vector<std::vector<char>> m_owned_data;  // copies of the temporary data and the packed strings
 };
 }  // namespace ov::util
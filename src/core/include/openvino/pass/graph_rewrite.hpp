@@ -127,6 +127,14 @@ public:
 
     void set_pass_config(const std::shared_ptr<PassConfig>& pass_config) override;
 
+    /// \brief Enables the rounds of the matcher passes over the nodes touched by the rewrites.
+    ///
+    /// The first round visits all the nodes of the model. While the matcher callbacks rewrite the model, the
+    /// next rounds revisit only the nodes touched by the successful callbacks of the previous round: the
+    /// matched nodes with their producers and consumers, and the new producers of the consumers. The rounds
+    /// stop when nothing is rewritten. By default the model is traversed once.
+    void set_revisit_touched_nodes(bool enable);
+
 protected:
     bool apply_matcher_passes(std::shared_ptr<Model> f, std::deque<std::weak_ptr<Node>> nodes_to_run);
 
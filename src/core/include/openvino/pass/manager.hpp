@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <list>
 #include <memory>
+#include <string>
 #include <typeinfo>
 #include <vector>
 
@@ -75,6 +77,27 @@ public:
     ///             false otherwise.
     bool run_passes(const std::shared_ptr<Model>& model);
 
+    /// \brief Cost of a pass executed by run_passes
+    struct PassStatistics {
+        std::string name;
+        std::chrono::nanoseconds time{0};
+        /// \brief Number of the nodes visited by the matcher passes of GraphRewrite and MatcherPass passes
+        size_t visited_nodes = 0;
+        /// \brief Number of the matcher callbacks of GraphRewrite and MatcherPass passes which rewrote the model
+        size_t matches = 0;
+        bool changed = false;
+    };
+
+    /// \brief      Runs registered transformations on a given model and measures their cost
+    ///
+    /// \param      model Input model
+    /// \param      statistics Statistics of the executed passes in the order of their execution. The disabled
+    ///             and the skipped passes are not listed.
+    ///
+    /// \return     Returns true if the model was changed by transformations,
+    ///             false otherwise.
+    bool run_passes(const std::shared_ptr<Model>& model, std::vector<PassStatistics>& statistics);
+
     /// \brief Set flag to enable/disable running Validate pass after executing
     /// each registered pass
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
@@ -108,6 +131,7 @@ protected:
     std::string m_name = "UnnamedManager";
 
 private:
+    bool run_pass_list(const std::shared_ptr<Model>& model, std::vector<PassStatistics>* statistics);
     bool run_pass(const std::shared_ptr<PassBase>& pass, const std::shared_ptr<Model>& model);
 };
 }  // namespace pass
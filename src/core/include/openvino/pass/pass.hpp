@@ -31,6 +31,8 @@ enum class PassProperty : uint32_t {
     REQUIRE_STATIC_SHAPE = 0x1,
     // Pass transformation will change the function's dynamic state
     CHANGE_DYNAMIC_STATE = 1 << 1,
+    // GraphRewrite revisits the nodes touched by the rewrites until nothing is rewritten
+    REVISIT_TOUCHED_NODES = 1 << 2,
 };
 
 using PassPropertyMask = ov::EnumMask<PassProperty>;
@@ -12,6 +12,7 @@
 #include "openvino/op/util/attr_types.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel_util.hpp"
 
 namespace ov {
 namespace reference {
@@ -71,34 +72,14 @@ inline size_t calculate_fixed_axis(size_t axis, const size_t* strides) {
         --axis;
     return axis;
 }
-}  // namespace internal
 
-/**
- * @brief Apply elementwise function for 2 inputs of same size.
- *
- * @param arg0  Pointer to input 0 data.
- * @param arg1  Pointer to input 1 data.
- * @param out   Pointer to output data.
- * @param count Number of elements in inputs
- * @param f     Binary elementwise functions.
- */
 template <typename T, typename U, class Functor>
-void no_broadcast_binop(const T* arg0, const T* arg1, U* out, const size_t count, Functor f) {
+void elementwise_binop(const T* arg0, const T* arg1, U* out, const size_t count, Functor f) {
     for (auto last = arg0 + count; arg0 != last; ++arg0, ++arg1, ++out) {
         *out = f(*arg0, *arg1);
     }
 }
 
-/**
- * @brief Apply elementwise function for 2 inputs and apply NUMPY broadcasting.
- *
- * @param arg0       Pointer to input 0 data.
- * @param arg1       Pointer to input 1 data.
- * @param out        Pointer to output data.
- * @param arg0_shape Shape of input 0.
- * @param arg1_shape Shape of input 1.
- * @param f          Binary elementwise functions.
- */
 template <typename T, typename U, class Functor>
 void numpy_broadcast_binop(const T* arg0,
                            const T* arg1,
@@ -124,8 +105,6 @@ void numpy_broadcast_binop(const T* arg0,
     //                 Output shape
     //                 ------------
     //                 [ 3, 2, 6]
-    using namespace internal;
-
     const size_t shape_rank = std::max(arg0_shape.size(), arg1_shape.size()) + 1;
 
     // TODO: Use compiler-specific alloca() or variable-length array
@@ -155,7 +134,7 @@ void numpy_broadcast_binop(const T* arg0,
     }
 
     if (axis == 0) {
-        no_broadcast_binop(arg0, arg1, out, strides0[0], f);
+        elementwise_binop(arg0, arg1, out, strides0[0], f);
     } else if (strides0[axis] == 1 && value_with_padding_or(arg0_shape, padding0, axis, 1) == 1) {
         axis = calculate_fixed_axis(axis, strides0);
 
@@ -203,6 +182,82 @@ void numpy_broadcast_binop(const T* arg0,
                                                   strides0[axis],
                                                   f);
 }
+}  // namespace internal
+
+/**
+ * @brief Apply elementwise function for 2 inputs of same size.
+ *
+ * @param arg0  Pointer to input 0 data.
+ * @param arg1  Pointer to input 1 data.
+ * @param out   Pointer to output data.
+ * @param count Number of elements in inputs
+ * @param f     Binary elementwise functions.
+ */
+template <typename T, typename U, class Functor>
+void no_broadcast_binop(const T* arg0, const T* arg1, U* out, const size_t count, Functor f) {
+    parallel_chunks(count, 1, [&](const size_t begin, const size_t end) {
+        internal::elementwise_binop(arg0 + begin, arg1 + begin, out + begin, end - begin, f);
+    });
+}
+
+/**
+ * @brief Apply elementwise function for 2 inputs and apply NUMPY broadcasting.
+ *
+ * @param arg0       Pointer to input 0 data.
+ * @param arg1       Pointer to input 1 data.
+ * @param out        Pointer to output data.
+ * @param arg0_shape Shape of input 0.
+ * @param arg1_shape Shape of input 1.
+ * @param f          Binary elementwise functions.
+ */
+template <typename T, typename U, class Functor>
+void numpy_broadcast_binop(const T* arg0,
+                           const T* arg1,
+                           U* out,
+                           const Shape& arg0_shape,
+                           const Shape& arg1_shape,
+                           Functor f) {
+    using namespace internal;
+
+    const size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+    if (rank > 1) {
+        // the output is split by the outermost dimension, the slices are broadcasted in parallel
+        const auto dim0 = value_with_padding_or(arg0_shape, rank - arg0_shape.size(), 0, size_t{1});
+        const auto dim1 = value_with_padding_or(arg1_shape, rank - arg1_shape.size(), 0, size_t{1});
+        const auto slice_shape = [rank](const Shape& shape) {
+            return shape.size() == rank ? Shape(shape.begin() + 1, shape.end()) : shape;
+        };
+        const auto slice0_shape = slice_shape(arg0_shape);
+        const auto slice1_shape = slice_shape(arg1_shape);
+
+        size_t slice_size = 1;
+        for (size_t i = 0; i < rank - 1; ++i) {
+            slice_size *= std::max(value_with_padding_or(slice0_shape, rank - 1 - slice0_shape.size(), i, size_t{1}),
+                                   value_with_padding_or(slice1_shape, rank - 1 - slice1_shape.size(), i, size_t{1}));
+        }
+        const auto slices = std::max(dim0, dim1);
+        if (arg0_shape != arg1_shape && slices > 1 && slices * slice_size >= parallel_threshold) {
+            const auto step0 = dim0 == 1 ? 0 : shape_size(slice0_shape);
+            const auto step1 = dim1 == 1 ? 0 : shape_size(slice1_shape);
+            parallel_chunks(slices, slice_size, [&](const size_t begin, const size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    internal::numpy_broadcast_binop(arg0 + i * step0,
+                                                    arg1 + i * step1,
+                                                    out + i * slice_size,
+                                                    slice0_shape,
+                                                    slice1_shape,
+                                                    f);
+                }
+            });
+            return;
+        }
+    }
+    if (arg0_shape == arg1_shape) {
+        no_broadcast_binop(arg0, arg1, out, shape_size(arg0_shape), f);
+    } else {
+        internal::numpy_broadcast_binop(arg0, arg1, out, arg0_shape, arg1_shape, f);
+    }
+}
 
 /**
  * @brief Apply elementwise function for 2 inputs and apply PDPP broadcasting.
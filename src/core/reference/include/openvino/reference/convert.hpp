@@ -12,6 +12,7 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/core/type/nf4.hpp"
+#include "openvino/reference/utils/parallel_util.hpp"
 
 #if !defined(OS_CHROMEOS) && (defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64))
 #    define OV_CORE_USE_XBYAK_JIT
@@ -61,7 +62,9 @@ void convert(InputIt arg, OutputIt out, const size_t count) {
 
 template <typename TI, typename TO>
 void convert(const TI* arg, TO* out, const size_t count) {
-    std::transform(arg, arg + count, out, detail::convert<TI, TO>);
+    parallel_chunks(count, 1, [&](const size_t begin, const size_t end) {
+        std::transform(arg + begin, arg + end, out + begin, detail::convert<TI, TO>);
+    });
 }
 
 template <>
@@ -6,45 +6,54 @@
 
 #include <cmath>
 #include <numeric>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 #include "openvino/reference/broadcast.hpp"
 #include "openvino/reference/reshape.hpp"
+#include "openvino/reference/utils/parallel_util.hpp"
 
 namespace ov {
 namespace reference {
 namespace details {
-template <typename T>
-void dot(const T* arg0,
-         const T* arg1,
-         T* out,
-         const Shape& arg0_shape,
-         const Shape& arg1_shape,
-         const Shape& out_shape) {
-    std::fill(out, out + shape_size(out_shape), T{0});
+// 2D inputs shapes are interpreted as {I, K} x {K, J}
+// If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
+// If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
+inline std::tuple<size_t, size_t, size_t> dot_dims(const Shape& arg0_shape, const Shape& arg1_shape) {
     const size_t arg0_rank = arg0_shape.size();
     const size_t arg1_rank = arg1_shape.size();
-
-    // 2D inputs shapes are interpreted as {I, K} x {K, J}
-    // If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
-    // If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
     const size_t I_dim = arg0_rank == 1 ? 1 : arg0_shape[arg0_rank - 2];
     const size_t J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
     const size_t K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
+    return {I_dim, J_dim, K_dim};
+}
 
-    for (size_t i = 0; i < I_dim; ++i) {
+// Computes the rows [begin, end) of the {I, J} output
+template <typename T>
+void dot_rows(const T* arg0, const T* arg1, T* out, size_t J_dim, size_t K_dim, size_t begin, size_t end) {
+    std::fill(out + begin * J_dim, out + end * J_dim, T{0});
+    for (size_t i = begin; i < end; ++i) {
+        T* const out_row = out + i * J_dim;
         for (size_t k = 0; k < K_dim; ++k) {
-            const size_t a_idx = i * K_dim + k;
+            const T a = arg0[i * K_dim + k];
+            const T* const b_row = arg1 + k * J_dim;
             for (size_t j = 0; j < J_dim; ++j) {
-                const size_t b_idx = k * J_dim + j;
-                const size_t out_idx = i * J_dim + j;
-                out[out_idx] += arg0[a_idx] * arg1[b_idx];
+                out_row[j] += a * b_row[j];
             }
         }
     }
 }
 
+template <typename T>
+void dot(const T* arg0, const T* arg1, T* out, const Shape& arg0_shape, const Shape& arg1_shape) {
+    size_t I_dim, J_dim, K_dim;
+    std::tie(I_dim, J_dim, K_dim) = dot_dims(arg0_shape, arg1_shape);
+    parallel_chunks(I_dim, J_dim * K_dim, [&](const size_t begin, const size_t end) {
+        dot_rows(arg0, arg1, out, J_dim, K_dim, begin, end);
+    });
+}
+
 std::vector<size_t> get_transpose_order(const Shape& input_shape);
 }  // namespace details
 /// \brief Reference kernel for matmul computation.
@@ -126,7 +135,7 @@ void matmul(const T* arg0,
 
     // Inputs are 2D and below, perform dot directly
     if (arg0_rank <= 2 && arg1_rank <= 2) {
-        details::dot(arg0_data, arg1_data, out, arg0_shape_tmp, arg1_shape_tmp, out_shape);
+        details::dot(arg0_data, arg1_data, out, arg0_shape_tmp, arg1_shape_tmp);
         return;
     }
 
@@ -206,14 +215,21 @@ void matmul(const T* arg0,
     const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
     const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
     const size_t output_offset = shape_size(dot_output_shape);
-    for (size_t i = 0; i < output_batch_size; i++) {
-        details::dot(arg0_data + i * arg0_offset,
-                     arg1_data + i * arg1_offset,
-                     out + i * output_offset,
-                     dot_arg0_shape,
-                     dot_arg1_shape,
-                     dot_output_shape);
-    }
+    // the rows of all the batches are computed in parallel
+    size_t I_dim, J_dim, K_dim;
+    std::tie(I_dim, J_dim, K_dim) = details::dot_dims(dot_arg0_shape, dot_arg1_shape);
+    parallel_chunks(output_batch_size * I_dim, J_dim * K_dim, [&](const size_t begin, const size_t end) {
+        for (size_t row = begin; row < end; row++) {
+            const size_t batch = row / I_dim;
+            details::dot_rows(arg0_data + batch * arg0_offset,
+                              arg1_data + batch * arg1_offset,
+                              out + batch * output_offset,
+                              J_dim,
+                              K_dim,
+                              row % I_dim,
+                              row % I_dim + 1);
+        }
+    });
 }
 }  // namespace reference
 }  // namespace ov
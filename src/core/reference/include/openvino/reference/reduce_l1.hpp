@@ -10,6 +10,7 @@
 #include "openvino/core/shape_util.hpp"
 #include "openvino/reference/abs.hpp"
 #include "openvino/reference/reduce_sum.hpp"
+#include "openvino/reference/utils/parallel_util.hpp"
 #include "openvino/reference/utils/type_util.hpp"
 
 namespace ov {
@@ -29,6 +30,10 @@ void reduce_l1(InputIt in, OutputIt out, const Shape& in_shape, const AxisSet& r
     static_assert(std::is_same<typename std::iterator_traits<InputIt>::value_type, T>::value,
                   "Assume in and out same type.");
 
+    if (parallel_reduce_slices(in, out, in_shape, reduction_axes, reduce_l1<InputIt, OutputIt>)) {
+        return;
+    }
+
     const auto out_shape = ov::util::reduce(in_shape, reduction_axes);
     std::fill(out, std::next(out, shape_size(out_shape)), T(0));
 
@@ -10,6 +10,7 @@
 
 #include "openvino/core/shape_util.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel_util.hpp"
 
 namespace ov {
 namespace reference {
@@ -28,6 +29,10 @@ void reduce_l2(InputIt in, OutputIt out, const Shape& in_shape, const AxisSet& r
     static_assert(std::is_same<typename std::iterator_traits<InputIt>::value_type, T>::value,
                   "Assume in and out same type.");
 
+    if (parallel_reduce_slices(in, out, in_shape, reduction_axes, reduce_l2<InputIt, OutputIt>)) {
+        return;
+    }
+
     const auto out_shape = ov::util::reduce(in_shape, reduction_axes);
     const auto out_last = std::next(out, shape_size(out_shape));
     std::fill(out, out_last, T(0));
@@ -11,6 +11,7 @@
 #include "openvino/core/shape_util.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel_util.hpp"
 
 namespace ov {
 namespace reference {
@@ -25,6 +26,10 @@ namespace reference {
  */
 template <class T>
 void reduce_max(const T* in, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
+    if (parallel_reduce_slices(in, out, in_shape, reduction_axes, reduce_max<T>)) {
+        return;
+    }
+
     constexpr auto min_value = std::numeric_limits<T>::lowest();
 
     const auto out_shape = util::reduce(in_shape, reduction_axes);
@@ -11,6 +11,7 @@
 #include "openvino/core/shape_util.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel_util.hpp"
 
 namespace ov {
 namespace reference {
@@ -24,6 +25,10 @@ namespace reference {
  */
 template <class T>
 void reduce_min(const T* in, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
+    if (parallel_reduce_slices(in, out, in_shape, reduction_axes, reduce_min<T>)) {
+        return;
+    }
+
     constexpr auto max_value =
         std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
 
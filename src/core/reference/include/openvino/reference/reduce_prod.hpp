@@ -10,6 +10,7 @@
 #include "openvino/core/shape_util.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel_util.hpp"
 
 namespace ov {
 namespace reference {
@@ -23,6 +24,10 @@ namespace reference {
  */
 template <typename T>
 void reduce_prod(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
+    if (parallel_reduce_slices(arg, out, in_shape, reduction_axes, reduce_prod<T>)) {
+        return;
+    }
+
     const auto out_shape = util::reduce(in_shape, reduction_axes);
     std::fill(out, out + shape_size(out_shape), T(1));
 
@@ -12,6 +12,7 @@
 #include "openvino/core/type/float16.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel_util.hpp"
 #include "openvino/reference/utils/type_util.hpp"
 
 namespace ov {
@@ -72,6 +73,10 @@ T kahan_summation(const T in, const T prev_sum, T& compensation) {
  */
 template <typename T>
 void reduce_sum(const T* in, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
+    if (parallel_reduce_slices(in, out, in_shape, reduction_axes, reduce_sum<T>)) {
+        return;
+    }
+
     const auto out_shape = util::reduce(in_shape, reduction_axes);
 
     const auto out_size = shape_size(out_shape);
@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+
+#include "openvino/core/axis_set.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/shape_util.hpp"
+
+namespace ov {
+namespace reference {
+
+/** @brief Number of the processed elements below which the reference kernels run serially. */
+constexpr size_t parallel_threshold = size_t{1} << 16;
+
+/** @brief Minimal number of the processed elements per thread of the reference kernels. */
+constexpr size_t parallel_grain = size_t{1} << 14;
+
+/**
+ * @brief Runs func(begin, end) over the contiguous chunks of [0, work_amount) items in parallel.
+ *
+ * The small tensors are processed by a single call on the calling thread. The first exception thrown by func is
+ * rethrown on the calling thread after all the chunks are finished, so the kernels may throw from the workers.
+ *
+ * @param work_amount   Number of the work items.
+ * @param item_elements Number of the elements processed per work item, the chunks are sized by it.
+ * @param func          Callable taking the [begin, end) range of the work items.
+ */
+template <typename F>
+void parallel_chunks(size_t work_amount, size_t item_elements, const F& func) {
+    const auto elements = work_amount * std::max<size_t>(item_elements, 1);
+    if (work_amount < 2 || elements < parallel_threshold) {
+        func(size_t{0}, work_amount);
+        return;
+    }
+
+    const auto nthr = static_cast<int>(std::min({static_cast<size_t>(parallel_get_max_threads()),
+                                                 work_amount,
+                                                 elements / parallel_grain}));
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        size_t begin = 0, end = 0;
+        splitter(work_amount, nthr, ithr, begin, end);
+        if (begin >= end) {
+            return;
+        }
+        try {
+            func(begin, end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * @brief Runs the reduction of the slices over the outer not reduced axes in parallel.
+ *
+ * The slices are reduced by the call of reduce(in, out, slice_shape, slice_reduction_axes), the reduced axes of the
+ * slices start from the first one, so the call runs serially.
+ *
+ * @param in             Input iterator to data.
+ * @param out            Output iterator to results.
+ * @param in_shape       Input shape.
+ * @param reduction_axes Axes on which reduction is applied.
+ * @param reduce         Reduction of a single slice.
+ * @return False if the reduction is too small or has no outer axes to split and is left to the caller.
+ */
+template <class InputIt, class OutputIt, class F>
+bool parallel_reduce_slices(InputIt in,
+                            OutputIt out,
+                            const Shape& in_shape,
+                            const AxisSet& reduction_axes,
+                            const F& reduce) {
+    // the axes are sorted, so the first one bounds the outer axes
+    const auto outer_rank = reduction_axes.empty() ? in_shape.size() : *reduction_axes.begin();
+    if (outer_rank == 0 || outer_rank > in_shape.size()) {
+        return false;
+    }
+
+    const auto split = in_shape.begin() + outer_rank;
+    const auto slices = shape_size(Shape(in_shape.begin(), split));
+    const Shape slice_shape(split, in_shape.end());
+    const auto slice_size = shape_size(slice_shape);
+    if (slices < 2 || slices * slice_size < parallel_threshold) {
+        return false;
+    }
+
+    AxisSet slice_reduction_axes;
+    for (const auto axis : reduction_axes) {
+        slice_reduction_axes.insert(axis - outer_rank);
+    }
+    const auto out_slice_size = shape_size(util::reduce(slice_shape, slice_reduction_axes));
+    parallel_chunks(slices, slice_size, [&](const size_t begin, const size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            reduce(std::next(in, i * slice_size),
+                   std::next(out, i * out_slice_size),
+                   slice_shape,
+                   slice_reduction_axes);
+        }
+    });
+    return true;
+}
+
+}  // namespace reference
+}  // namespace ov
@@ -489,13 +489,17 @@ void convert_impl(const TI* arg, TO* out, size_t count) {
 #ifdef OV_CORE_USE_XBYAK_JIT
     if (util::may_i_use_dynamic_code()) {
         if (auto converter = jit_convert_array::get<TI, TO, Clamp::enabled>()) {
-            jit_convert_array::args_t args = {arg, out, count};
-            converter(&args);
+            parallel_chunks(count, 1, [&](const size_t begin, const size_t end) {
+                jit_convert_array::args_t args = {arg + begin, out + begin, end - begin};
+                converter(&args);
+            });
             return;
         }
     }
 #endif  // OV_CORE_USE_XBYAK_JIT
-    Converter<TI, TO>::template apply<Clamp>(arg, out, count);
+    parallel_chunks(count, 1, [&](const size_t begin, const size_t end) {
+        Converter<TI, TO>::template apply<Clamp>(arg + begin, out + begin, end - begin);
+    });
 }
 }  // namespace
 
@@ -540,7 +544,9 @@ void convert_from_f32_to_f16_with_clamp(const float* arg, float16* out, size_t c
 
 template <>
 void convert<int32_t, float16>(const int32_t* arg, float16* out, size_t count) {
-    Converter<int32_t, float16>::apply<Clamp<int32_t, float16>>(arg, out, count);
+    parallel_chunks(count, 1, [&](const size_t begin, const size_t end) {
+        Converter<int32_t, float16>::apply<Clamp<int32_t, float16>>(arg + begin, out + begin, end - begin);
+    });
 }
 
 void convert_from_bf16_to_f16_with_clamp(const bfloat16* arg, float16* out, size_t count) {
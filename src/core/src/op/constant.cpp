@@ -8,6 +8,7 @@
 #include <cstdio>
 #include <cstring>
 #include <sstream>
+#include <utility>
 
 #include "compare.hpp"
 #include "element_visitor.hpp"
@@ -396,11 +397,15 @@ size_t Constant::get_byte_size() const {
 }
 
 const void* Constant::get_data_ptr() const {
-    return (m_data ? m_data->get_ptr() : nullptr);
+    return (m_data ? std::as_const(*m_data).get_ptr() : nullptr);
 }
 
 void* Constant::get_data_ptr_nc() {
-    return (m_data ? m_data->get_ptr() : nullptr);
+    if (!m_data) {
+        return nullptr;
+    }
+    m_data->invalidate_hash();
+    return m_data->get_ptr();
 }
 
 struct ValuesToString : ov::element::NotSupported<void> {
@@ -18,6 +18,7 @@
 #include "openvino/pass/backward_graph_rewrite.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/log.hpp"
+#include "pass_statistics.hpp"
 #include "perf_counters.hpp"
 
 /* GraphRewrite algorithm:
@@ -143,6 +144,21 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // including ones triggered by parent type info.
     }
 
+    // The nodes touched by the successful callbacks are revisited by the next round
+    const bool track_changes = get_property(PassProperty::REVISIT_TOUCHED_NODES);
+    // the matchers which undo each other's rewrites are stopped after this number of rounds
+    constexpr size_t max_rounds = 32;
+    auto* const statistics = current_pass_statistics();
+    std::deque<std::weak_ptr<Node>> touched_nodes;
+    // consumers of the current node before the callbacks, they are touched when the node is rewritten
+    NodeVector consumers;
+    auto touch = [&](const std::shared_ptr<Node>& node) {
+        touched_nodes.emplace_back(node);
+        for (const auto& input : node->input_values()) {
+            touched_nodes.emplace_back(input.get_node_shared_ptr());
+        }
+    };
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
@@ -159,7 +175,29 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(std::move(node));
+        bool status = m_pass->apply(node);
+        if (status) {
+            if (statistics) {
+                statistics->matches++;
+            }
+            if (track_changes) {
+                for (const auto& consumer : consumers) {
+                    touch(consumer);
+                }
+                // the node is still in the model when it's rewritten in place, otherwise its producers lost
+                // the consumer
+                const auto& outputs = node->outputs();
+                if (std::any_of(outputs.begin(), outputs.end(), [](const Output<Node>& output) {
+                        return !output.get_target_inputs().empty();
+                    })) {
+                    touch(node);
+                } else {
+                    for (const auto& input : node->input_values()) {
+                        touched_nodes.emplace_back(input.get_node_shared_ptr());
+                    }
+                }
+            }
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -178,75 +216,109 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     // list of matchers to run for a node; define here to keep memory allocated
     std::vector<size_t> matcher_passes_to_run;
 
-    while (!nodes_to_run.empty()) {
-        auto weak_node = nodes_to_run.front();
-        nodes_to_run.pop_front();
-
-        auto node = weak_node.lock();
-        if (!node)
-            continue;
+    for (size_t round = 1;; ++round) {
+        bool round_rewritten = false;
+        while (!nodes_to_run.empty()) {
+            auto weak_node = nodes_to_run.front();
+            nodes_to_run.pop_front();
+
+            auto node = weak_node.lock();
+            if (!node)
+                continue;
+            if (statistics) {
+                statistics->visited_nodes++;
+            }
 
-        // Recursive apply Matchers for sub-graph based nodes
-        if (auto sub_graph_node = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
-            if (sub_graph_node->get_transformations_allowed()) {
-                size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
-                for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                    auto sub_graph = sub_graph_node->get_function(sub_graph_ind);
-                    run_on_model(sub_graph);
+            if (track_changes) {
+                consumers.clear();
+                for (const auto& output : node->outputs()) {
+                    for (const auto& input : output.get_target_inputs()) {
+                        consumers.push_back(input.get_node()->shared_from_this());
+                    }
                 }
             }
-        }
-        // Temporary keep this GraphRewrite property for backward compatibility
-        if (m_enable_shape_inference) {
-            node->revalidate_and_infer_types();
-        }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
+
+            // Recursive apply Matchers for sub-graph based nodes
+            if (auto sub_graph_node = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
+                if (sub_graph_node->get_transformations_allowed()) {
+                    size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+                    for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
+                        auto sub_graph = sub_graph_node->get_function(sub_graph_ind);
+                        run_on_model(sub_graph);
+                    }
                 }
-                node_type_info = node_type_info->parent;
             }
+            // Temporary keep this GraphRewrite property for backward compatibility
+            if (m_enable_shape_inference) {
+                node->revalidate_and_infer_types();
+            }
+            // If all Matchers in MatcherPasses has type based root node then we apply efficient
+            // algorithm for finding matchers
+            if (all_roots_has_type) {
+                const DiscreteTypeInfo* node_type_info = &node->get_type_info();
+                matcher_passes_to_run.clear();
+                while (node_type_info) {
+                    auto matchers = type_to_matcher.find(*node_type_info);
+                    if (matchers != type_to_matcher.end()) {
+                        // do not run found matchers immediately, need to collect all matchers for
+                        // parents
+                        // and sort them in order of the registration
+                        matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+                                                     matchers->second.begin(),
+                                                     matchers->second.end());
+                    }
+                    node_type_info = node_type_info->parent;
+                }
 
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+                std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
 
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
+                // TODO: type_to_matcher with just collected list of matchers to enable
+                // fast processing at the next time when node with the same type will be processed
 
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
+                for (size_t matcher_index : matcher_passes_to_run) {
+                    if (run_matcher_pass(m_matchers[matcher_index], node)) {
+                        round_rewritten = true;
+                        break;
+                    }
+                }
+            }
+            // Otherwise we use default algorithm that iterates over all registered matcher passes
+            else {
+                for (auto& m_pass : m_matchers) {
+                    // Skip passes that are disabled
+                    if (pass_config->is_disabled(m_pass->get_type_info()))
+                        continue;
+
+                    if (run_matcher_pass(m_pass, node)) {
+                        round_rewritten = true;
+                        break;
+                    }
                 }
             }
         }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
+        rewritten = rewritten || round_rewritten;
+        if (!round_rewritten || !track_changes || round >= max_rounds) {
+            break;
+        }
+
+        // the next round visits the alive touched nodes once in the order they were touched
+        std::unordered_set<Node*> visited;
+        for (const auto& weak_node : touched_nodes) {
+            if (auto node = weak_node.lock()) {
+                if (visited.insert(node.get()).second) {
+                    nodes_to_run.emplace_back(node);
                 }
             }
         }
+        touched_nodes.clear();
     }
     return rewritten;
 }
 
+void ov::pass::GraphRewrite::set_revisit_touched_nodes(bool enable) {
+    set_property(PassProperty::REVISIT_TOUCHED_NODES, enable);
+}
+
 void ov::pass::GraphRewrite::set_pass_config(const std::shared_ptr<PassConfig>& rhs) {
     auto pass_config = get_pass_config();
     // We have to preserve disabled passes because in case when we register matchers inside
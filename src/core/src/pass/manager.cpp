@@ -21,6 +21,7 @@
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
+#include "pass_statistics.hpp"
 #include "perf_counters.hpp"
 
 #ifdef ENABLE_PROFILING_ITT_FULL
@@ -333,7 +334,22 @@ void ov::pass::Manager::set_per_pass_validation(bool new_state) {
     m_per_pass_validation = new_state;
 }
 
+ov::pass::Manager::PassStatistics*& ov::pass::current_pass_statistics() {
+    static thread_local Manager::PassStatistics* statistics = nullptr;
+    return statistics;
+}
+
 bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
+    return run_pass_list(model, nullptr);
+}
+
+bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model, std::vector<PassStatistics>& statistics) {
+    statistics.clear();
+    return run_pass_list(model, &statistics);
+}
+
+bool ov::pass::Manager::run_pass_list(const std::shared_ptr<ov::Model>& model,
+                                      std::vector<PassStatistics>* statistics) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::ov_core, "pass::Manager::run_passes");
     Profiler profiler(m_name);
 
@@ -365,8 +381,28 @@ bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
 
         const auto& pass_name = pass->get_name();
 
+        bool pass_changed_model = false;
         profiler.start_timer(pass_name);
-        bool pass_changed_model = run_pass(pass, model);
+        if (statistics) {
+            PassStatistics pass_statistics;
+            pass_statistics.name = pass_name;
+            // the passes run by the nested managers without the statistics are counted as the part of this pass
+            auto& current = current_pass_statistics();
+            auto* const outer = std::exchange(current, &pass_statistics);
+            const auto start = std::chrono::steady_clock::now();
+            try {
+                pass_changed_model = run_pass(pass, model);
+            } catch (...) {
+                current = outer;
+                throw;
+            }
+            current = outer;
+            pass_statistics.time = std::chrono::steady_clock::now() - start;
+            pass_statistics.changed = pass_changed_model;
+            statistics->push_back(std::move(pass_statistics));
+        } else {
+            pass_changed_model = run_pass(pass, model);
+        }
         profiler.stop_timer(pass_name, pass_changed_model);
 
         manager_changed_model = manager_changed_model || pass_changed_model;
@@ -0,0 +1,14 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include "openvino/pass/manager.hpp"
+
+namespace ov {
+namespace pass {
+/// \brief Statistics of the pass which Manager runs on the current thread, nullptr if they are not collected.
+/// GraphRewrite counts the visited nodes and the matches there, so the exported classes keep no counters.
+Manager::PassStatistics*& current_pass_statistics();
+}  // namespace pass
+}  // namespace ov
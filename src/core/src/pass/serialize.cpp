@@ -132,7 +132,10 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
         xml_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
 
         try {
-            serialize_func(xml_file, bin_file, model, m_version);
+            // the weights are written to the file from several threads after the xml is built
+            ov::util::ParallelConstantWriter constant_writer(bin_file, m_bin_path);
+            serialize_func(xml_file, bin_file, model, m_version, false, constant_writer);
+            constant_writer.flush();
         } catch (const ov::AssertFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
@@ -142,6 +145,9 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
         } catch (const std::ios_base::failure&) {
             handle_file_serialize_error(m_xml_path, m_bin_path, xml_file, bin_file);
             throw;
+        } catch (const std::filesystem::filesystem_error&) {
+            handle_file_serialize_error(m_xml_path, m_bin_path, xml_file, bin_file);
+            throw;
         }
     }
 
@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "openvino/core/memory_util.hpp"
+#include "openvino/runtime/compute_hash.hpp"
 
 namespace ov {
 IBufferDescriptor::~IBufferDescriptor() = default;
@@ -25,10 +26,14 @@ AlignedBuffer::AlignedBuffer(size_t byte_size, size_t alignment) : m_byte_size(b
 AlignedBuffer::AlignedBuffer(AlignedBuffer&& other)
     : m_allocated_buffer(other.m_allocated_buffer),
       m_aligned_buffer(other.m_aligned_buffer),
-      m_byte_size(other.m_byte_size) {
+      m_byte_size(other.m_byte_size),
+      m_read_only(other.m_read_only),
+      m_hash(other.m_hash.load()),
+      m_hash_computed(other.m_hash_computed.load()) {
     other.m_allocated_buffer = nullptr;
     other.m_aligned_buffer = nullptr;
     other.m_byte_size = 0;
+    other.m_hash_computed = false;
 }
 
 AlignedBuffer::~AlignedBuffer() {
@@ -45,9 +50,13 @@ AlignedBuffer& AlignedBuffer::operator=(AlignedBuffer&& other) {
         m_allocated_buffer = other.m_allocated_buffer;
         m_aligned_buffer = other.m_aligned_buffer;
         m_byte_size = other.m_byte_size;
+        m_read_only = other.m_read_only;
+        m_hash = other.m_hash.load();
+        m_hash_computed = other.m_hash_computed.load();
         other.m_allocated_buffer = nullptr;
         other.m_aligned_buffer = nullptr;
         other.m_byte_size = 0;
+        other.m_hash_computed = false;
     }
     return *this;
 }
@@ -60,4 +69,17 @@ AttributeAdapter<std::shared_ptr<AlignedBuffer>>::~AttributeAdapter() = default;
 std::shared_ptr<IBufferDescriptor> AlignedBuffer::get_descriptor() const {
     return nullptr;
 }
+
+size_t AlignedBuffer::get_hash() const {
+    if (!is_hash_memoizable()) {
+        return m_aligned_buffer ? ov::runtime::compute_hash(m_aligned_buffer, m_byte_size) : 0;
+    }
+    if (!m_hash_computed.load(std::memory_order_acquire)) {
+        // concurrent callers may compute the same value, which is cheaper than serializing them
+        m_hash.store(m_aligned_buffer ? ov::runtime::compute_hash(m_aligned_buffer, m_byte_size) : 0,
+                     std::memory_order_relaxed);
+        m_hash_computed.store(true, std::memory_order_release);
+    }
+    return m_hash.load(std::memory_order_relaxed);
+}
 }  // namespace ov
@@ -4,7 +4,14 @@
 
 #include "openvino/xml_util/constant_writer.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <utility>
+
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/reference/convert.hpp"
 #include "openvino/runtime/compute_hash.hpp"
 #include "openvino/util/common_util.hpp"
@@ -12,8 +19,7 @@
 namespace ov::util {
 
 ConstantWriter::ConstantWriter(std::ostream& bin_data, bool enable_compression)
-    : m_hash_to_file_positions{},
-      m_binary_output(bin_data),
+    : m_binary_output(bin_data),
       m_enable_compression(enable_compression),
       m_blob_offset(bin_data.tellp()),
       m_data_hash{} {}
@@ -38,12 +44,14 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
         // the same hash for {2, 2} and {0, 128} arrays.
         // But even strong hashing algorithms sometimes give collisions.
         // Therefore we always have to compare values when finding a match in the hash multimap.
-        const HashValue hash = ov::runtime::compute_hash(data_ptr, new_size);
+        const auto precomputed_hash = std::exchange(m_precomputed_hash, std::nullopt);
+        const HashValue hash =
+            precomputed_hash && !compress_to_fp16 ? *precomputed_hash : ov::runtime::compute_hash(data_ptr, new_size);
 
         const auto found = m_hash_to_file_positions.equal_range(hash);
         // iterate over all matches of the key in the multimap
         for (auto it = found.first; it != found.second; ++it) {
-            if (memcmp(ptr, it->second.second, size) == 0) {
+            if (ptr == it->second.second || memcmp(ptr, it->second.second, size) == 0) {
                 return it->second.first;
             }
         }
@@ -61,6 +69,26 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
     return offset;
 }
 
+ConstantWriter::FilePosition ConstantWriter::write(const ov::AlignedBuffer& buffer,
+                                                   size_t& new_size,
+                                                   bool compress_to_fp16,
+                                                   ov::element::Type src_type,
+                                                   bool ptr_is_temporary) {
+    if (m_enable_compression) {
+        // the writer decides whether the digest of the uncompressed data fits
+        m_precomputed_hash = buffer.get_hash();
+    }
+    const auto offset = write(static_cast<const char*>(buffer.get_ptr()),
+                              buffer.size(),
+                              new_size,
+                              compress_to_fp16,
+                              src_type,
+                              ptr_is_temporary);
+    // the derived writer may not consume it
+    m_precomputed_hash.reset();
+    return offset;
+}
+
 ConstantWriter::FilePosition ConstantWriter::write(const std::vector<std::string_view>& chunks, size_t& new_size) {
     new_size = 0;
     for (const auto& sv : chunks)
@@ -109,19 +137,24 @@ std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
     OPENVINO_ASSERT(num_src_elements * src_type.size() == size);
     using T = fundamental_type_for<ov::element::Type_t::f16>;
     compressed_size = num_src_elements * sizeof(T);
+    auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
+    convert_to_fp16(ptr, num_src_elements, src_type, new_ptr.get());
+    return new_ptr;
+}
+
+void ConstantWriter::convert_to_fp16(const char* ptr,
+                                     size_t num_elements,
+                                     const element::Type& src_type,
+                                     char* dst) {
+    auto dst_data = reinterpret_cast<ov::float16*>(dst);
     if (src_type == ov::element::f32) {
-        auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
-        auto dst_data = reinterpret_cast<ov::float16*>(new_ptr.get());
         auto src_data = reinterpret_cast<const float*>(ptr);
-        ov::reference::convert_from_f32_to_f16_with_clamp(src_data, dst_data, num_src_elements);
-        return new_ptr;
+        ov::reference::convert_from_f32_to_f16_with_clamp(src_data, dst_data, num_elements);
     } else if (src_type == ov::element::f64) {
-        auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
-        auto dst_data = reinterpret_cast<ov::float16*>(new_ptr.get());
         auto src_data = reinterpret_cast<const double*>(ptr);
 
         // Reference implementation for fp64 to fp16 conversion
-        for (size_t i = 0; i < num_src_elements; ++i) {
+        for (size_t i = 0; i < num_elements; ++i) {
             // if abs value is smaller than the smallest positive fp16, but not zero
             if (std::abs(src_data[i]) < ov::float16::from_bits(0x0001) && src_data[i] != 0.0f) {
                 dst_data[i] = 0;
@@ -133,10 +166,208 @@ std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
                 dst_data[i] = static_cast<ov::float16>(src_data[i]);
             }
         }
-        return new_ptr;
     } else {
         OPENVINO_THROW("[ INTERNAL ERROR ] Not supported source type for weights compression: ", src_type);
     }
 }
 
+ParallelConstantWriter::ParallelConstantWriter(std::ostream& bin_data,
+                                               std::filesystem::path bin_path,
+                                               bool enable_compression,
+                                               size_t chunk_size)
+    : ConstantWriter(bin_data, enable_compression),
+      m_bin_path(std::move(bin_path)),
+      m_chunk_size(std::max<size_t>(chunk_size, 1)),
+      m_blob_size{} {}
+
+ConstantWriter::FilePosition ParallelConstantWriter::write(const char* ptr,
+                                                           size_t size,
+                                                           size_t& new_size,
+                                                           bool compress_to_fp16,
+                                                           ov::element::Type src_type,
+                                                           bool ptr_is_temporary) {
+    const auto precomputed_hash = std::exchange(m_precomputed_hash, std::nullopt);
+    new_size = size;
+    if (compress_to_fp16) {
+        const auto num_src_elements = size / src_type.size();
+        OPENVINO_ASSERT(num_src_elements * src_type.size() == size);
+        OPENVINO_ASSERT(src_type == ov::element::f32 || src_type == ov::element::f64,
+                        "[ INTERNAL ERROR ] Not supported source type for weights compression: ",
+                        src_type);
+        new_size = num_src_elements * sizeof(ov::float16);
+    } else {
+        src_type = ov::element::dynamic;
+    }
+
+    if (m_enable_compression) {
+        // The compressed data is matched by the source data, while the digest is of the written data as in
+        // ConstantWriter, so the data is converted to hash it and it's converted once again by flush(). The digest of
+        // the buffer is reused for the data which isn't compressed.
+        HashValue hash = 0;
+        if (compress_to_fp16) {
+            size_t compressed_size = 0;
+            const auto fp16_data = compress_data_to_fp16(ptr, size, src_type, compressed_size);
+            hash = ov::runtime::compute_hash(fp16_data.get(), compressed_size);
+        } else {
+            hash = precomputed_hash ? *precomputed_hash : ov::runtime::compute_hash(ptr, size);
+        }
+        if (const auto offset = find(ptr, size, src_type, hash)) {
+            return *offset;
+        }
+        m_data_hash = util::u64_hash_combine(m_data_hash, hash);
+        if (ptr_is_temporary) {
+            m_owned_data.emplace_back(ptr, ptr + size);
+            return place(m_owned_data.back().data(), size, new_size, src_type);
+        }
+        m_hash_to_entries.insert({hash, m_entries.size()});
+    } else {
+        m_data_hash = util::u64_hash_combine(m_data_hash, new_size);
+        if (ptr_is_temporary) {
+            m_owned_data.emplace_back(ptr, ptr + size);
+            ptr = m_owned_data.back().data();
+        }
+    }
+    return place(ptr, size, new_size, src_type);
+}
+
+ConstantWriter::FilePosition ParallelConstantWriter::write(const std::vector<std::string_view>& chunks,
+                                                           size_t& new_size) {
+    new_size = 0;
+    for (const auto& sv : chunks)
+        new_size += sv.size();
+
+    std::vector<char> packed(new_size);
+    char* dst = packed.data();
+    for (const auto& sv : chunks) {
+        std::memcpy(dst, sv.data(), sv.size());
+        dst += sv.size();
+    }
+
+    if (m_enable_compression) {
+        const HashValue hash = ov::runtime::compute_hash(packed.data(), new_size);
+        if (const auto offset = find(packed.data(), new_size, ov::element::dynamic, hash)) {
+            return *offset;
+        }
+        m_data_hash = util::u64_hash_combine(m_data_hash, hash);
+        m_hash_to_entries.insert({hash, m_entries.size()});
+    } else {
+        m_data_hash = util::u64_hash_combine(m_data_hash, new_size);
+    }
+    m_owned_data.push_back(std::move(packed));
+    return place(m_owned_data.back().data(), new_size, new_size, ov::element::dynamic);
+}
+
+std::optional<ConstantWriter::FilePosition> ParallelConstantWriter::find(const char* ptr,
+                                                                         size_t size,
+                                                                         ov::element::Type src_type,
+                                                                         HashValue hash) const {
+    // the hash is weak, so the data is always compared
+    const auto found = m_hash_to_entries.equal_range(hash);
+    for (auto it = found.first; it != found.second; ++it) {
+        const auto& entry = m_entries[it->second];
+        if (entry.size == size && entry.src_type == src_type &&
+            (entry.ptr == ptr || std::memcmp(entry.ptr, ptr, size) == 0)) {
+            return entry.offset;
+        }
+    }
+    return std::nullopt;
+}
+
+ConstantWriter::FilePosition ParallelConstantWriter::place(const char* ptr,
+                                                           size_t size,
+                                                           size_t new_size,
+                                                           ov::element::Type src_type) {
+    const auto offset = m_blob_size;
+    m_entries.push_back({ptr, size, src_type, offset});
+    m_blob_size += static_cast<FilePosition>(new_size);
+    return offset;
+}
+
+void ParallelConstantWriter::flush() {
+    // the entries are split to the pieces of at most m_chunk_size source bytes, they follow each other in the blob
+    struct Piece {
+        const Entry* entry;
+        size_t begin;
+        size_t end;
+        FilePosition offset;
+    };
+    std::vector<Piece> pieces;
+    for (const auto& entry : m_entries) {
+        const bool compressed = entry.src_type != ov::element::dynamic;
+        const size_t element_size = compressed ? entry.src_type.size() : 1;
+        const size_t step = std::max<size_t>(m_chunk_size / element_size, 1) * element_size;
+        for (size_t begin = 0; begin < entry.size; begin += step) {
+            const auto offset = compressed ? begin / element_size * sizeof(ov::float16) : begin;
+            pieces.push_back({&entry,
+                              begin,
+                              std::min(begin + step, entry.size),
+                              entry.offset + static_cast<FilePosition>(offset)});
+        }
+    }
+
+    const auto write_pieces = [](std::ostream& stream, const Piece* begin, const Piece* end) {
+        std::vector<char> fp16_data;
+        for (auto piece = begin; piece != end; ++piece) {
+            const auto& entry = *piece->entry;
+            const auto size = piece->end - piece->begin;
+            if (entry.src_type == ov::element::dynamic) {
+                stream.write(entry.ptr + piece->begin, size);
+            } else {
+                const auto num_elements = size / entry.src_type.size();
+                fp16_data.resize(num_elements * sizeof(ov::float16));
+                convert_to_fp16(entry.ptr + piece->begin, num_elements, entry.src_type, fp16_data.data());
+                stream.write(fp16_data.data(), fp16_data.size());
+            }
+        }
+    };
+
+    auto& output = m_binary_output.get();
+    const FilePosition blob_end = m_blob_offset + m_blob_size;
+    const auto nthr = static_cast<int>(std::min<size_t>(parallel_get_max_threads(), pieces.size()));
+    if (nthr <= 1) {
+        // the stream is at the beginning of the placed data
+        write_pieces(output, pieces.data(), pieces.data() + pieces.size());
+    } else {
+        output.flush();
+        std::filesystem::resize_file(m_bin_path, static_cast<std::uintmax_t>(blob_end));
+
+        // each thread writes the pieces of a contiguous range of the blob of about the same size
+        const auto first_offset = pieces.front().offset;
+        const auto range_size = m_blob_size - first_offset;
+        const auto first_piece = [&](int ithr) {
+            const auto range_begin = first_offset + range_size * ithr / nthr;
+            return std::partition_point(pieces.data(), pieces.data() + pieces.size(), [&](const Piece& piece) {
+                return piece.offset < range_begin;
+            });
+        };
+        std::vector<std::exception_ptr> errors(nthr);
+        ov::parallel_nt(nthr, [&](const int ithr, const int) {
+            try {
+                const auto begin = first_piece(ithr);
+                const auto end = first_piece(ithr + 1);
+                if (begin == end) {
+                    return;
+                }
+                std::fstream file(m_bin_path, std::ios::in | std::ios::out | std::ios::binary);
+                OPENVINO_ASSERT(file, "Can't open bin file: ", m_bin_path);
+                file.exceptions(std::fstream::failbit | std::fstream::badbit);
+                file.seekp(m_blob_offset + begin->offset);
+                write_pieces(file, begin, end);
+            } catch (...) {
+                errors[ithr] = std::current_exception();
+            }
+        });
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        output.seekp(blob_end);
+    }
+
+    m_entries.clear();
+    m_hash_to_entries.clear();
+    m_owned_data.clear();
+}
+
 }  // namespace ov::util
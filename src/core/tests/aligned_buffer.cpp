@@ -4,7 +4,15 @@
 
 #include "openvino/runtime/aligned_buffer.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
+#include "openvino/op/constant.hpp"
+#include "openvino/runtime/compute_hash.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 
 using namespace ov;
 
@@ -33,3 +41,63 @@ TEST(aligned_buffer, move) {
         EXPECT_NE(buffer2.get_ptr(), nullptr);
     }
 }
+
+TEST(aligned_buffer, hash_is_memoized) {
+    AlignedBuffer buffer(100, 64);
+    std::memset(buffer.get_ptr(), 1, buffer.size());
+    const auto& const_buffer = buffer;
+    const auto hash = const_buffer.get_hash();
+    EXPECT_EQ(hash, ov::runtime::compute_hash(const_buffer.get_ptr(), const_buffer.size()));
+
+    // the write bypassing the buffer is not seen, so the second call doesn't read the data
+    std::memset(const_cast<void*>(const_buffer.get_ptr()), 2, const_buffer.size());
+    EXPECT_EQ(hash, const_buffer.get_hash());
+}
+
+TEST(aligned_buffer, hash_is_invalidated_by_write) {
+    AlignedBuffer buffer(100, 64);
+    std::memset(buffer.get_ptr(), 1, buffer.size());
+    const auto hash = buffer.get_hash();
+
+    // the non-const access alone doesn't drop the digest
+    EXPECT_NE(buffer.get_ptr(), nullptr);
+    EXPECT_EQ(hash, buffer.get_hash());
+
+    std::memset(buffer.get_ptr(), 2, buffer.size());
+    buffer.invalidate_hash();
+    const auto new_hash = buffer.get_hash();
+    EXPECT_NE(hash, new_hash);
+    EXPECT_EQ(new_hash, ov::runtime::compute_hash(std::as_const(buffer).get_ptr(), buffer.size()));
+}
+
+TEST(aligned_buffer, hash_of_shared_memory_is_not_memoized) {
+    auto data = std::make_shared<std::vector<char>>(100, 1);
+    SharedBuffer<std::shared_ptr<std::vector<char>>> buffer(data->data(), data->size(), data);
+    const auto hash = buffer.get_hash();
+
+    // the owner of the memory modifies it bypassing the buffer
+    std::fill(data->begin(), data->end(), 2);
+    EXPECT_NE(hash, buffer.get_hash());
+    EXPECT_EQ(buffer.get_hash(), ov::runtime::compute_hash(data->data(), data->size()));
+}
+
+TEST(aligned_buffer, hash_of_shared_constant_is_memoized) {
+    // the constant of the model read from IR shares the weights buffer
+    auto weights = std::make_shared<AlignedBuffer>(400, 64);
+    std::memset(weights->get_ptr(), 1, weights->size());
+    auto view = std::make_shared<SharedBuffer<std::shared_ptr<AlignedBuffer>>>(weights->get_ptr<char>() + 200,
+                                                                                 200,
+                                                                                 weights);
+    const auto constant = std::make_shared<op::v0::Constant>(element::f32, Shape{50}, view);
+    EXPECT_TRUE(view->is_hash_memoizable());
+    const auto hash = view->get_hash();
+    EXPECT_EQ(hash, ov::runtime::compute_hash(constant->get_data_ptr(), constant->get_byte_size()));
+
+    // the second call doesn't read the data, so the write bypassing the buffer is not seen
+    std::memset(const_cast<void*>(constant->get_data_ptr()), 2, constant->get_byte_size());
+    EXPECT_EQ(hash, view->get_hash());
+
+    view->invalidate_hash();
+    EXPECT_NE(hash, view->get_hash());
+    EXPECT_EQ(view->get_hash(), ov::runtime::compute_hash(constant->get_data_ptr(), constant->get_byte_size()));
+}
@@ -7,6 +7,7 @@
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/graph_util.hpp"
 #include "openvino/core/rtti.hpp"
+#include "openvino/op/abs.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/divide.hpp"
 #include "openvino/op/op.hpp"
@@ -16,6 +17,7 @@
 #include "openvino/pass/backward_graph_rewrite.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -444,3 +446,112 @@ TEST(GraphRewriteTest, nodes_use_count) {
     m.register_pass<CheckConsumers>();
     OV_ASSERT_NO_THROW(m.run_passes(f));
 }
+
+// replaces the Relu having a single consumer with Abs
+class SingleConsumerReluToAbs : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("SingleConsumerReluToAbs");
+    SingleConsumerReluToAbs() : MatcherPass() {
+        auto relu = pattern::wrap_type<op::v0::Relu>(pattern::consumers_count(1));
+        ov::matcher_pass_callback callback = [](pattern::Matcher& m) {
+            const auto& root = m.get_match_root();
+            ov::replace_node(root, std::make_shared<op::v0::Abs>(root->input_value(0)));
+            return true;
+        };
+        register_matcher(std::make_shared<pattern::Matcher>(relu, "SingleConsumerReluToAbs"), callback);
+    }
+};
+
+// replaces the Tanh with the other Tanh of the same input
+class TanhElimination : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("TanhElimination");
+    TanhElimination() : MatcherPass() {
+        auto tanh = pattern::wrap_type<op::v0::Tanh>();
+        ov::matcher_pass_callback callback = [](pattern::Matcher& m) {
+            const auto& root = m.get_match_root();
+            for (const auto& input : root->input_value(0).get_target_inputs()) {
+                const auto other = input.get_node()->shared_from_this();
+                if (other != root && ov::is_type<op::v0::Tanh>(other)) {
+                    ov::replace_node(root, other);
+                    return true;
+                }
+            }
+            return false;
+        };
+        register_matcher(std::make_shared<pattern::Matcher>(tanh, "TanhElimination"), callback);
+    }
+};
+
+class TanhEliminationRewrite : public ov::pass::GraphRewrite {
+public:
+    OPENVINO_GRAPH_REWRITE_RTTI("TanhEliminationRewrite");
+    TanhEliminationRewrite() : GraphRewrite() {
+        add_matcher<SingleConsumerReluToAbs>();
+        add_matcher<TanhElimination>();
+    }
+};
+
+// the Relu is visited before the elimination of the Tanh leaves it with a single consumer
+inline std::shared_ptr<Model> get_tanh_model() {
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{3, 1, 2});
+    auto relu = std::make_shared<ov::op::v0::Relu>(data);
+    auto tanh_1 = std::make_shared<ov::op::v0::Tanh>(relu);
+    auto tanh_2 = std::make_shared<ov::op::v0::Tanh>(relu);
+    return std::make_shared<ov::Model>(ov::OutputVector{tanh_1, tanh_2}, ov::ParameterVector{data});
+}
+
+TEST(GraphRewriteTest, SingleRound) {
+    auto f = get_tanh_model();
+
+    pass::Manager m;
+    m.set_per_pass_validation(false);
+    m.register_pass<TanhEliminationRewrite>();
+    std::vector<pass::Manager::PassStatistics> statistics;
+    ASSERT_TRUE(m.run_passes(f, statistics));
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+    ASSERT_EQ(statistics.size(), 1);
+    ASSERT_EQ(statistics[0].visited_nodes, 6);
+    ASSERT_EQ(statistics[0].matches, 1);
+}
+
+TEST(GraphRewriteTest, NextRoundRevisitsTouchedNodes) {
+    auto f = get_tanh_model();
+
+    pass::Manager m;
+    m.set_per_pass_validation(false);
+    m.register_pass<TanhEliminationRewrite>()->set_revisit_touched_nodes(true);
+    std::vector<pass::Manager::PassStatistics> statistics;
+    ASSERT_TRUE(m.run_passes(f, statistics));
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::Abs>(f), 1);
+    // the second round visits the Relu, the remaining Tanh and the Result of the eliminated one, the third round
+    // visits the Abs with its producer and consumer and stops as nothing is rewritten
+    ASSERT_EQ(statistics.size(), 1);
+    ASSERT_EQ(statistics[0].visited_nodes, 12);
+    ASSERT_EQ(statistics[0].matches, 2);
+}
+
+TEST(GraphRewriteTest, ManagerPassStatistics) {
+    auto f = get_tanh_model();
+
+    pass::Manager m;
+    m.set_per_pass_validation(false);
+    m.register_pass<TanhElimination>();
+    m.register_pass<SingleConsumerReluToAbs>();
+    std::vector<pass::Manager::PassStatistics> statistics;
+    m.run_passes(f, statistics);
+
+    ASSERT_EQ(statistics.size(), 2);
+    ASSERT_EQ(statistics[0].name, "TanhElimination");
+    ASSERT_TRUE(statistics[0].changed);
+    ASSERT_EQ(statistics[0].visited_nodes, 6);
+    ASSERT_EQ(statistics[0].matches, 1);
+    ASSERT_EQ(statistics[1].name, "SingleConsumerReluToAbs");
+    ASSERT_TRUE(statistics[1].changed);
+    ASSERT_EQ(statistics[1].matches, 1);
+}
@@ -5,12 +5,15 @@
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <sstream>
 
 #include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/data_utils.hpp"
 #include "common_test_utils/graph_comparator.hpp"
 #include "common_test_utils/test_common.hpp"
 #include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/core.hpp"
+#include "openvino/xml_util/constant_writer.hpp"
 #include "transformations/common_optimizations/compress_float_constants.hpp"
 
 class SerializationConstantCompressionTest : public ov::test::TestsCommon {
@@ -444,3 +447,118 @@ TEST_F(SerializationConstantCompressionTest, IdenticalStringConstantsRoundTrip)
         }
     }
 }
+
+TEST_F(SerializationConstantCompressionTest, FileWeightsAreEqualToStreamWeights) {
+    const ov::Shape shape{64, 1024};
+    const auto values = ov::test::utils::generate_float_numbers(ov::shape_size(shape), -10.f, 10.f);
+    const auto other_values = ov::test::utils::generate_float_numbers(ov::shape_size(shape), -10.f, 10.f, 1);
+
+    auto A = ov::op::v0::Constant::create(ov::element::f32, shape, values);
+    auto B = ov::op::v0::Constant::create(ov::element::f32, shape, other_values);
+    auto C = ov::op::v0::Constant::create(ov::element::f32, shape, values);
+    auto D = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{3}, {1, 2, 3});
+    auto E = ov::op::v0::Constant::create(ov::element::string, ov::Shape{2}, std::vector<std::string>{"a", "bc"});
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{A, B, C, D, E}, ov::ParameterVector{});
+    ov::pass::CompressFloatConstants(/*postponed=*/true).run_on_model(model);
+
+    // the file weights are written by several threads
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(model);
+    std::stringstream xml_stream, bin_stream;
+    ov::pass::Serialize(xml_stream, bin_stream).run_on_model(model);
+
+    std::ifstream xml_1(m_out_xml_path_1);
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+    const std::string xml_file{std::istreambuf_iterator<char>(xml_1), std::istreambuf_iterator<char>()};
+    const std::string bin_file{std::istreambuf_iterator<char>(bin_1), std::istreambuf_iterator<char>()};
+
+    ASSERT_GT(bin_file.size(), 2 * ov::shape_size(shape) * sizeof(ov::float16));
+    EXPECT_EQ(bin_file, bin_stream.str());
+    EXPECT_EQ(xml_file, xml_stream.str());
+}
+
+TEST_F(SerializationConstantCompressionTest, ParallelWriterChunksHaveSameLayout) {
+    const auto values = ov::test::utils::generate_float_numbers(1000, -70000.f, 70000.f);
+    const std::vector<double> f64_values{1.5, -2.25, 1e10, 1e-10};
+    const std::string str = "string";
+
+    const auto write = [&](ov::util::ConstantWriter& writer) {
+        std::vector<size_t> layout;
+        size_t new_size = 0;
+        const auto data = reinterpret_cast<const char*>(values.data());
+        const auto f64_data = reinterpret_cast<const char*>(f64_values.data());
+        for (const bool compress : {false, true, false, true}) {
+            layout.push_back(writer.write(data, values.size() * sizeof(float), new_size, compress, ov::element::f32));
+            layout.push_back(new_size);
+        }
+        layout.push_back(writer.write(data, 400, new_size, false, ov::element::dynamic, true));
+        layout.push_back(new_size);
+        layout.push_back(writer.write(f64_data, f64_values.size() * sizeof(double), new_size, true, ov::element::f64));
+        layout.push_back(new_size);
+        layout.push_back(writer.write(std::vector<std::string_view>{str, str}, new_size));
+        layout.push_back(new_size);
+        return layout;
+    };
+
+    std::stringstream expected;
+    expected << "header";
+    ov::util::ConstantWriter writer(expected);
+    const auto expected_layout = write(writer);
+
+    {
+        std::ofstream bin(m_out_bin_path_1, std::ios::binary);
+        bin << "header";
+        ov::util::ParallelConstantWriter parallel_writer(bin, m_out_bin_path_1, true, 64);
+        EXPECT_EQ(write(parallel_writer), expected_layout);
+        parallel_writer.flush();
+    }
+
+    std::ifstream bin(m_out_bin_path_1, std::ios::binary);
+    const std::string actual{std::istreambuf_iterator<char>(bin), std::istreambuf_iterator<char>()};
+    EXPECT_EQ(actual, expected.str());
+}
+
+TEST_F(SerializationConstantCompressionTest, ParallelWriterHashesCompressedDataAsSequentialWriter) {
+    const ov::Shape shape{16, 256};
+    const auto values = ov::test::utils::generate_float_numbers(ov::shape_size(shape), -10.f, 10.f);
+    const auto other_values = ov::test::utils::generate_float_numbers(ov::shape_size(shape), -10.f, 10.f, 1);
+    auto A = ov::op::v0::Constant::create(ov::element::f32, shape, values);
+    auto B = ov::op::v0::Constant::create(ov::element::f32, shape, other_values);
+    auto C = ov::op::v0::Constant::create(ov::element::f32, shape, values);
+    auto D = ov::op::v0::Constant::create(ov::element::f64, ov::Shape{4}, std::vector<double>{1.5, -2.25, 1e10, 0});
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{A, B, C, D}, ov::ParameterVector{});
+
+    // the float constants are compressed to f16 on writing as by the serialization of the compressed model
+    const auto write = [&](ov::util::ConstantWriter& writer) {
+        std::vector<size_t> layout;
+        for (const auto& op : model->get_ordered_ops()) {
+            if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+                size_t new_size = 0;
+                layout.push_back(writer.write(static_cast<const char*>(constant->get_data_ptr()),
+                                              constant->get_byte_size(),
+                                              new_size,
+                                              true,
+                                              constant->get_element_type()));
+                layout.push_back(new_size);
+            }
+        }
+        return layout;
+    };
+
+    std::stringstream expected;
+    ov::util::ConstantWriter writer(expected);
+    const auto expected_layout = write(writer);
+
+    uint64_t data_hash = 0;
+    {
+        std::ofstream bin(m_out_bin_path_1, std::ios::binary);
+        ov::util::ParallelConstantWriter parallel_writer(bin, m_out_bin_path_1);
+        EXPECT_EQ(write(parallel_writer), expected_layout);
+        parallel_writer.flush();
+        data_hash = parallel_writer.get_data_hash();
+    }
+    EXPECT_EQ(data_hash, writer.get_data_hash());
+
+    std::ifstream bin(m_out_bin_path_1, std::ios::binary);
+    const std::string actual{std::istreambuf_iterator<char>(bin), std::istreambuf_iterator<char>()};
+    EXPECT_EQ(actual, expected.str());
+}
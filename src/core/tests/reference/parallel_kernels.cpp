@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "openvino/reference/autobroadcast_binop.hpp"
+#include "openvino/reference/gather.hpp"
+#include "openvino/reference/matmul.hpp"
+#include "openvino/reference/reduce_sum.hpp"
+
+using namespace ov;
+
+namespace {
+
+// the tensors of the tests are over reference::parallel_threshold, so the kernels run in parallel
+std::vector<float> make_data(size_t size) {
+    std::vector<float> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<float>(i % 13) * 0.5f;
+    }
+    return data;
+}
+
+TEST(ReferenceParallelKernelsTest, NumpyBroadcastBinop) {
+    const Shape shape0{4, 1, 96, 64}, shape1{3, 1, 64}, out_shape{4, 3, 96, 64};
+    const auto arg0 = make_data(shape_size(shape0));
+    const auto arg1 = make_data(shape_size(shape1));
+    std::vector<float> out(shape_size(out_shape));
+
+    reference::numpy_broadcast_binop(arg0.data(), arg1.data(), out.data(), shape0, shape1, std::minus<float>());
+
+    for (size_t n = 0; n < 4; ++n)
+        for (size_t c = 0; c < 3; ++c)
+            for (size_t h = 0; h < 96; ++h)
+                for (size_t w = 0; w < 64; ++w) {
+                    const auto expected = arg0[(n * 96 + h) * 64 + w] - arg1[c * 64 + w];
+                    ASSERT_EQ(out[((n * 3 + c) * 96 + h) * 64 + w], expected);
+                }
+}
+
+TEST(ReferenceParallelKernelsTest, BinopRethrowsFromWorkers) {
+    const auto data = make_data(size_t{1} << 18);
+    std::vector<float> out(data.size());
+
+    EXPECT_THROW(reference::no_broadcast_binop(data.data(),
+                                               data.data(),
+                                               out.data(),
+                                               data.size(),
+                                               [](float a, float) -> float {
+                                                   if (a == 6.0f) {
+                                                       throw std::domain_error("unexpected value");
+                                                   }
+                                                   return a;
+                                               }),
+                 std::domain_error);
+}
+
+TEST(ReferenceParallelKernelsTest, BatchedMatMul) {
+    const Shape shape0{3, 64, 48}, shape1{48, 40}, out_shape{3, 64, 40};
+    const auto arg0 = make_data(shape_size(shape0));
+    const auto arg1 = make_data(shape_size(shape1));
+    std::vector<float> out(shape_size(out_shape));
+
+    reference::matmul(arg0.data(), arg1.data(), out.data(), shape0, shape1, out_shape, false, false);
+
+    for (size_t b = 0; b < 3; ++b)
+        for (size_t i = 0; i < 64; ++i)
+            for (size_t j = 0; j < 40; ++j) {
+                float expected = 0.0f;
+                for (size_t k = 0; k < 48; ++k) {
+                    expected += arg0[(b * 64 + i) * 48 + k] * arg1[k * 40 + j];
+                }
+                ASSERT_FLOAT_EQ(out[(b * 64 + i) * 40 + j], expected);
+            }
+}
+
+TEST(ReferenceParallelKernelsTest, GatherZerosOutOfBoundIndices) {
+    constexpr size_t inner = 16384;
+    const Shape data_shape{2, 16, inner}, indices_shape{3}, out_shape{2, 3, inner};
+    const auto data = make_data(shape_size(data_shape));
+    const std::vector<int64_t> indices{5, -1, 16};
+    std::vector<float> out(shape_size(out_shape), 1.0f);
+
+    reference::gather(data.data(), indices.data(), out.data(), data_shape, indices_shape, out_shape, 1);
+
+    for (size_t outer = 0; outer < 2; ++outer) {
+        for (size_t i = 0; i < inner; ++i) {
+            ASSERT_EQ(out[(outer * 3 + 0) * inner + i], data[(outer * 16 + 5) * inner + i]);
+            ASSERT_EQ(out[(outer * 3 + 1) * inner + i], data[(outer * 16 + 15) * inner + i]);
+            ASSERT_EQ(out[(outer * 3 + 2) * inner + i], 0.0f);
+        }
+    }
+}
+
+TEST(ReferenceParallelKernelsTest, ReduceSumInnerAxes) {
+    const Shape shape{64, 8, 256};
+    const auto data = make_data(shape_size(shape));
+    std::vector<float> out(64 * 256);
+
+    reference::reduce_sum(data.data(), out.data(), shape, AxisSet{1});
+
+    for (size_t outer = 0; outer < 64; ++outer)
+        for (size_t inner = 0; inner < 256; ++inner) {
+            float expected = 0.0f;
+            for (size_t axis = 0; axis < 8; ++axis) {
+                expected += data[(outer * 8 + axis) * 256 + inner];
+            }
+            ASSERT_FLOAT_EQ(out[outer * 256 + inner], expected);
+        }
+}
+
+}  // namespace
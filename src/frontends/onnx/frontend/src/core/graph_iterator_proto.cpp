@@ -8,13 +8,17 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <fstream>
+#include <limits>
 #include <map>
 #include <queue>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "decoder_proto.hpp"
@@ -453,6 +457,214 @@ ov::frontend::onnx::TensorMetaInfo extract_tensor_meta_info(const TensorProto* t
     return tensor_meta_info;
 }
 
+namespace {
+// Reads the model file without copying the raw data of the large initializers into the ModelProto.
+// The protobuf wire format is scanned directly: the initializers of the main graph are re-encoded as the external
+// data which refers to the model file itself, the rest of the model is copied as is and parsed by protobuf.
+// So the data of such initializers is mapped (or read) from the file like the regular external data and the size
+// of the parsed part of the model isn't limited by the size of the weights.
+class ModelFileReader {
+public:
+    ModelFileReader(std::istream& stream, std::string location) : m_stream(stream), m_location(std::move(location)) {}
+
+    std::string read_model(uint64_t size) {
+        std::string model;
+        while (m_position < size) {
+            const auto key = read_varint();
+            if ((key >> 3) == MODEL_GRAPH && (key & 0x7) == LENGTH_DELIMITED) {
+                write_message(model, key, read_graph(read_varint()));
+            } else {
+                copy_field(model, key);
+            }
+        }
+        FRONT_END_GENERAL_CHECK(m_position == size, "Model can't be parsed");
+        return model;
+    }
+
+private:
+    // field numbers of onnx.proto
+    static constexpr uint64_t MODEL_GRAPH = 7;
+    static constexpr uint64_t GRAPH_INITIALIZER = 5;
+    static constexpr uint64_t TENSOR_DATA_TYPE = 2;
+    static constexpr uint64_t TENSOR_RAW_DATA = 9;
+    static constexpr uint64_t TENSOR_EXTERNAL_DATA = 13;
+    static constexpr uint64_t TENSOR_DATA_LOCATION = 14;
+    static constexpr uint64_t ENTRY_KEY = 1;
+    static constexpr uint64_t ENTRY_VALUE = 2;
+    // wire types
+    static constexpr uint64_t VARINT = 0;
+    static constexpr uint64_t BITS_64 = 1;
+    static constexpr uint64_t LENGTH_DELIMITED = 2;
+    static constexpr uint64_t BITS_32 = 5;
+    // the smaller raw data is kept in the model, it isn't worth a separate view of the file
+    static constexpr uint64_t min_external_size = 4096;
+
+    std::string read_graph(uint64_t size) {
+        const auto end = m_position + size;
+        std::string graph;
+        while (m_position < end) {
+            const auto key = read_varint();
+            if ((key >> 3) == GRAPH_INITIALIZER && (key & 0x7) == LENGTH_DELIMITED) {
+                write_message(graph, key, read_initializer(read_varint()));
+            } else {
+                copy_field(graph, key);
+            }
+        }
+        FRONT_END_GENERAL_CHECK(m_position == end, "Model can't be parsed");
+        return graph;
+    }
+
+    std::string read_initializer(uint64_t size) {
+        const auto end = m_position + size;
+        std::string tensor;
+        // the last occurrence of raw_data is the one taken by protobuf
+        bool has_raw_data = false;
+        uint64_t raw_data_offset = 0;
+        uint64_t raw_data_size = 0;
+        std::string raw_data;
+        uint64_t data_type = TensorProto_DataType::TensorProto_DataType_UNDEFINED;
+        while (m_position < end) {
+            const auto key = read_varint();
+            if ((key >> 3) == TENSOR_DATA_TYPE && (key & 0x7) == VARINT) {
+                data_type = read_varint();
+                write_varint(tensor, key);
+                write_varint(tensor, data_type);
+            } else if ((key >> 3) == TENSOR_RAW_DATA && (key & 0x7) == LENGTH_DELIMITED) {
+                has_raw_data = true;
+                raw_data_size = read_varint();
+                raw_data_offset = m_position;
+                raw_data.clear();
+                if (raw_data_size >= min_external_size) {
+                    skip(raw_data_size);
+                } else {
+                    read(raw_data, raw_data_size);
+                }
+            } else {
+                copy_field(tensor, key);
+            }
+        }
+        FRONT_END_GENERAL_CHECK(m_position == end, "Model can't be parsed");
+
+        // the mapped file is page aligned, so the view of the data is aligned as its offset in the file. The
+        // misaligned data is copied into the model, since the constants access the elements in place
+        const bool is_large = has_raw_data && raw_data_size >= min_external_size;
+        const bool is_external = is_large && raw_data_offset % data_alignment(data_type) == 0;
+        if (is_large && !is_external) {
+            read_at(raw_data, raw_data_offset, raw_data_size);
+        }
+        if (is_external) {
+            write_entry(tensor, "location", m_location);
+            write_entry(tensor, "offset", std::to_string(raw_data_offset));
+            write_entry(tensor, "length", std::to_string(raw_data_size));
+            write_varint(tensor, (TENSOR_DATA_LOCATION << 3) | VARINT);
+            write_varint(tensor, TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL);
+        } else if (has_raw_data) {
+            write_varint(tensor, (TENSOR_RAW_DATA << 3) | LENGTH_DELIMITED);
+            write_varint(tensor, raw_data.size());
+            tensor += raw_data;
+        }
+        return tensor;
+    }
+
+    void copy_field(std::string& out, uint64_t key) {
+        write_varint(out, key);
+        switch (key & 0x7) {
+        case VARINT:
+            write_varint(out, read_varint());
+            break;
+        case BITS_64:
+            read(out, 8);
+            break;
+        case LENGTH_DELIMITED: {
+            const auto size = read_varint();
+            write_varint(out, size);
+            read(out, size);
+            break;
+        }
+        case BITS_32:
+            read(out, 4);
+            break;
+        default:
+            FRONT_END_THROW("Unsupported wire type in the model");
+        }
+    }
+
+    uint64_t read_varint() {
+        uint64_t value = 0;
+        for (uint32_t shift = 0;; shift += 7) {
+            FRONT_END_GENERAL_CHECK(shift < 64, "Model can't be parsed");
+            const auto byte = m_stream.get();
+            FRONT_END_GENERAL_CHECK(byte != std::istream::traits_type::eof(), "Model can't be parsed");
+            ++m_position;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+    }
+
+    void read(std::string& out, uint64_t size) {
+        const auto offset = out.size();
+        out.resize(offset + size);
+        m_stream.read(out.data() + offset, static_cast<std::streamsize>(size));
+        FRONT_END_GENERAL_CHECK(static_cast<uint64_t>(m_stream.gcount()) == size, "Model can't be parsed");
+        m_position += size;
+    }
+
+    // reads the data at the offset of the file without moving the current position
+    void read_at(std::string& out, uint64_t offset, uint64_t size) {
+        m_stream.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+        FRONT_END_GENERAL_CHECK(m_stream.good(), "Model can't be parsed");
+        out.resize(size);
+        m_stream.read(out.data(), static_cast<std::streamsize>(size));
+        FRONT_END_GENERAL_CHECK(static_cast<uint64_t>(m_stream.gcount()) == size, "Model can't be parsed");
+        m_stream.seekg(static_cast<std::streamoff>(m_position), std::ios::beg);
+        FRONT_END_GENERAL_CHECK(m_stream.good(), "Model can't be parsed");
+    }
+
+    // the alignment of the elements of the type, the max one if the type isn't supported
+    static uint64_t data_alignment(uint64_t data_type) {
+        try {
+            return std::max<uint64_t>(get_ov_element_type(static_cast<int64_t>(data_type)).size(), 1);
+        } catch (const std::runtime_error&) {
+            return alignof(std::max_align_t);
+        }
+    }
+
+    void skip(uint64_t size) {
+        m_stream.seekg(static_cast<std::streamoff>(size), std::ios::cur);
+        FRONT_END_GENERAL_CHECK(m_stream.good(), "Model can't be parsed");
+        m_position += size;
+    }
+
+    static void write_varint(std::string& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    static void write_message(std::string& out, uint64_t key, const std::string& message) {
+        write_varint(out, key);
+        write_varint(out, message.size());
+        out += message;
+    }
+
+    static void write_entry(std::string& tensor, const std::string& key, const std::string& value) {
+        std::string entry;
+        write_message(entry, (ENTRY_KEY << 3) | LENGTH_DELIMITED, key);
+        write_message(entry, (ENTRY_VALUE << 3) | LENGTH_DELIMITED, value);
+        write_message(tensor, (TENSOR_EXTERNAL_DATA << 3) | LENGTH_DELIMITED, entry);
+    }
+
+    std::istream& m_stream;
+    // the initializers refer to the model file by its name, it is resolved relative to the model directory
+    std::string m_location;
+    uint64_t m_position = 0;
+};
+}  // namespace
+
 GraphIteratorProto::GraphIteratorProto(const GraphIteratorProtoMemoryManagementMode mode)
     : m_graph(nullptr),
       m_parent(nullptr),
@@ -481,9 +693,18 @@ void GraphIteratorProto::initialize(const std::filesystem::path& path) {
         std::ifstream model_file(path, std::ios::binary | std::ios::in);
         FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Could not open the file: \"", path_string, "\"");
 
-        m_model = std::make_shared<ModelProto>();
-        FRONT_END_GENERAL_CHECK(m_model->ParseFromIstream(&model_file), "Model can't be parsed");
+        const auto file_size = static_cast<uint64_t>(ov::util::file_size(path));
+        ModelFileReader reader(model_file, ov::util::path_to_string(path.filename()));
+        const auto model_data = reader.read_model(file_size);
         model_file.close();
+
+        m_model = std::make_shared<ModelProto>();
+        FRONT_END_GENERAL_CHECK(model_data.size() <= static_cast<size_t>(std::numeric_limits<int>::max()),
+                                "Model without the initializers exceeds 2GB: \"",
+                                path_string,
+                                "\"");
+        FRONT_END_GENERAL_CHECK(m_model->ParseFromArray(model_data.data(), static_cast<int>(model_data.size())),
+                                "Model can't be parsed");
         if (m_model->has_graph()) {
             fixup_legacy_nodes(*m_model);
             topological_sort_graph(m_model->mutable_graph());
@@ -6,7 +6,9 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
 #include <map>
 #include <openvino/frontend/exception.hpp>
 #include <openvino/frontend/graph_iterator.hpp>
@@ -18,6 +20,7 @@
 #include "../frontend/src/core/decoder_proto.hpp"
 #include "../frontend/src/core/graph_iterator_proto.hpp"
 #include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/test_case.hpp"
 #include "load_from.hpp"
 #include "onnx_utils.hpp"
@@ -508,3 +511,134 @@ TEST(FrontEndGraphIteratorTest, override_all_outputs_empty_throws) {
 
     EXPECT_THROW(input_model->override_all_outputs({}), ov::frontend::GeneralFailure);
 }
+
+namespace {
+// Saves the model y = x + w, where w is an initializer which is large enough to stay in the model file. The offset of
+// its data in the file is aligned for float or not as requested
+std::string save_model_with_large_initializer(const std::vector<float>& weights, bool misaligned = false) {
+    ONNX_NAMESPACE::ModelProto model;
+    model.set_ir_version(8);
+    model.add_opset_import()->set_version(17);
+    auto* graph = model.mutable_graph();
+    graph->set_name("large_initializer");
+
+    const auto add_value_info = [&](ONNX_NAMESPACE::ValueInfoProto* info, const std::string& name) {
+        info->set_name(name);
+        auto* tensor_type = info->mutable_type()->mutable_tensor_type();
+        tensor_type->set_elem_type(TensorProto_DataType::TensorProto_DataType_FLOAT);
+        tensor_type->mutable_shape()->add_dim()->set_dim_value(static_cast<int64_t>(weights.size()));
+    };
+    add_value_info(graph->add_input(), "x");
+    add_value_info(graph->add_output(), "y");
+
+    auto* initializer = graph->add_initializer();
+    initializer->set_name("w");
+    initializer->set_data_type(TensorProto_DataType::TensorProto_DataType_FLOAT);
+    initializer->add_dims(static_cast<int64_t>(weights.size()));
+    initializer->set_raw_data(weights.data(), weights.size() * sizeof(float));
+
+    auto* node = graph->add_node();
+    node->set_op_type("Add");
+    node->add_input("x");
+    node->add_input("w");
+    node->add_output("y");
+
+    // the producer name is serialized ahead of the graph, so it shifts the data of the initializer
+    const std::string raw_data = initializer->raw_data();
+    std::string serialized;
+    for (std::string producer;; producer += "_") {
+        model.set_producer_name(producer);
+        serialized = model.SerializeAsString();
+        const auto offset = serialized.find(raw_data);
+        if ((offset % sizeof(float) != 0) == misaligned) {
+            break;
+        }
+    }
+
+    const auto path = ov::test::utils::generateTestFilePrefix() + "_large_initializer.onnx";
+    std::ofstream file(path, std::ios::binary);
+    file.write(serialized.data(), static_cast<std::streamsize>(serialized.size()));
+    return path;
+}
+}  // namespace
+
+// The raw data of the large initializers is left in the model file and accessed as external data
+TEST(FrontEndGraphIteratorTest, large_raw_initializer_stays_in_file) {
+    std::vector<float> weights(4096);
+    for (size_t i = 0; i < weights.size(); ++i) {
+        weights[i] = static_cast<float>(i) * 0.5f;
+    }
+    const auto model_path = save_model_with_large_initializer(weights);
+
+    for (const auto mode : {ov::frontend::onnx::GraphIteratorProtoMemoryManagementMode::Internal_MMAP,
+                            ov::frontend::onnx::GraphIteratorProtoMemoryManagementMode::Internal_Stream}) {
+        auto iterator = std::make_shared<GraphIteratorProtoAccessor>(mode);
+        iterator->initialize(model_path);
+        iterator->reset();
+
+        const auto& initializer = iterator->get_graph()->initializer(0);
+        EXPECT_FALSE(initializer.has_raw_data());
+        EXPECT_EQ(initializer.data_location(), TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL);
+        const auto& tensor_info = iterator->get_tensor_by_name("w")->get_tensor_info();
+        ASSERT_NE(tensor_info.m_external_location, nullptr);
+        EXPECT_EQ(tensor_info.m_tensor_data_size, weights.size() * sizeof(float));
+
+        auto frontend = ov::frontend::FrontEndManager().load_by_framework("onnx");
+        ASSERT_NE(frontend, nullptr);
+        auto input_model = frontend->load(std::dynamic_pointer_cast<ov::frontend::onnx::GraphIterator>(iterator));
+        ASSERT_NE(input_model, nullptr);
+        auto model = frontend->convert(input_model);
+        ASSERT_NE(model, nullptr);
+
+        std::vector<float> expected(weights.size());
+        for (size_t i = 0; i < weights.size(); ++i) {
+            expected[i] = weights[i] + 1.0f;
+        }
+        ov::test::TestCase test_case(model);
+        test_case.add_input<float>(std::vector<float>(weights.size(), 1.0f));
+        test_case.add_expected_output<float>(ov::Shape{weights.size()}, expected);
+        test_case.run();
+    }
+    ov::test::utils::removeFile(model_path);
+}
+
+// The large initializer which data is misaligned in the model file is copied into the model instead of the view of the
+// file, since the constant accesses the elements in place
+TEST(FrontEndGraphIteratorTest, misaligned_large_raw_initializer_is_copied) {
+    std::vector<float> weights(4096);
+    for (size_t i = 0; i < weights.size(); ++i) {
+        weights[i] = static_cast<float>(i) * 0.5f;
+    }
+    const auto model_path = save_model_with_large_initializer(weights, true);
+
+    auto iterator = std::make_shared<GraphIteratorProtoAccessor>(
+        ov::frontend::onnx::GraphIteratorProtoMemoryManagementMode::Internal_MMAP);
+    iterator->initialize(model_path);
+    iterator->reset();
+
+    const auto& initializer = iterator->get_graph()->initializer(0);
+    EXPECT_TRUE(initializer.has_raw_data());
+    EXPECT_NE(initializer.data_location(), TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL);
+    const auto& tensor_info = iterator->get_tensor_by_name("w")->get_tensor_info();
+    EXPECT_EQ(tensor_info.m_external_location, nullptr);
+    ASSERT_EQ(tensor_info.m_tensor_data_size, weights.size() * sizeof(float));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(tensor_info.m_tensor_data) % alignof(float), 0U);
+
+    auto frontend = ov::frontend::FrontEndManager().load_by_framework("onnx");
+    ASSERT_NE(frontend, nullptr);
+    auto input_model = frontend->load(std::dynamic_pointer_cast<ov::frontend::onnx::GraphIterator>(iterator));
+    ASSERT_NE(input_model, nullptr);
+    auto model = frontend->convert(input_model);
+    ASSERT_NE(model, nullptr);
+
+    std::vector<float> expected(weights.size());
+    for (size_t i = 0; i < weights.size(); ++i) {
+        expected[i] = weights[i] + 1.0f;
+    }
+    ov::test::TestCase test_case(model);
+    test_case.add_input<float>(std::vector<float>(weights.size(), 1.0f));
+    test_case.add_expected_output<float>(ov::Shape{weights.size()}, expected);
+    test_case.run();
+
+    ov::test::utils::removeFile(model_path);
+}
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -57,6 +58,33 @@ protected:
      */
     virtual ~IVariableState();
 
+public:
+    /**
+     * @brief Sets the value of another variable state for the next inference, the default implementation copies it
+     * via get_state()
+     * @param source The state of the same variable
+     */
+    virtual void fork_from(const std::shared_ptr<IVariableState>& source);
+
+    /**
+     * @brief Keeps only the first elements of the state along its sequence axis. The default implementation throws
+     * ov::NotImplemented, the plugins override it for the states which have a sequence axis
+     * @param length The number of the elements to keep
+     */
+    virtual void truncate(size_t length);
+
+    /**
+     * @brief Moves the state out of the working memory until the next inference, the default implementation keeps the
+     * state as is
+     */
+    virtual void offload();
+
+    /**
+     * @brief Starts restoring of the offloaded state in background, the default implementation does nothing
+     */
+    virtual void prefetch();
+
+protected:
     std::string m_name;
     ov::SoPtr<ov::ITensor> m_state;
 };
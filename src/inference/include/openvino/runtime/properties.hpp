@@ -960,6 +960,16 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to set the target latency (in ms) of a request executed by the auto-batching.
+ * When set to a non-zero value, the auto-batching compiles a ladder of batch sizes (powers of two up to the device
+ * batch size) and executes the collected requests with the largest batches which are expected to meet the target
+ * latency according to the observed execution times, instead of waiting for the full batch until the timeout.
+ * Zero value (default) disables the adaptive batching.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_target_latency{"AUTO_BATCH_TARGET_LATENCY"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
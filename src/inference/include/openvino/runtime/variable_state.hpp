@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -74,6 +75,37 @@ public:
      * @param state The current state to set.
      */
     void set_state(const Tensor& state);
+
+    /**
+     * @brief Sets the value of another variable state for the next inference.
+     * A plugin may share the data of both states until one of them is changed, so forking a long state, e.g. the
+     * KV-cache of a conversation for the beam search or the speculative decoding, doesn't copy it.
+     * @param source The state of the same variable, e.g. of another infer request of the compiled model. Its infer
+     * request must not be running.
+     */
+    void fork_from(const VariableState& source);
+
+    /**
+     * @brief Keeps only the first elements of the state along its sequence axis for the next inference, e.g. to roll
+     * back the tokens of the KV-cache rejected by the speculative decoding.
+     * @note The operation is optional: only the states which have a sequence axis support it (i.e. the KV-cache states
+     * of the CPU plugin), the other ones throw ov::NotImplemented. The caller may fall back to get_state() and
+     * set_state() of the truncated copy in this case.
+     * @param length The number of the elements to keep, it must not exceed the current sequence length of the state.
+     */
+    void truncate(size_t length);
+
+    /**
+     * @brief Moves the state out of the working memory of the infer request until the next inference, e.g. to keep the
+     * idle sessions of a service. The state is restored on the next inference or access.
+     * A plugin may ignore the hint, the restored state is the same as the offloaded one.
+     */
+    void offload();
+
+    /**
+     * @brief Starts restoring of the offloaded state in background ahead of the next inference.
+     */
+    void prefetch();
 };
 
 }  // namespace ov
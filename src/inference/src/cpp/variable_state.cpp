@@ -49,4 +49,21 @@ void VariableState::set_state(const Tensor& state) {
     OV_VARIABLE_CALL_STATEMENT(_impl->set_state(get_tensor_impl(state)));
 }
 
+void VariableState::fork_from(const VariableState& source) {
+    OPENVINO_ASSERT(source._impl != nullptr, "The source VariableState was not initialized.");
+    OV_VARIABLE_CALL_STATEMENT(_impl->fork_from(source._impl));
+}
+
+void VariableState::truncate(size_t length) {
+    OV_VARIABLE_CALL_STATEMENT(_impl->truncate(length));
+}
+
+void VariableState::offload() {
+    OV_VARIABLE_CALL_STATEMENT(_impl->offload());
+}
+
+void VariableState::prefetch() {
+    OV_VARIABLE_CALL_STATEMENT(_impl->prefetch());
+}
+
 }  // namespace ov
@@ -76,10 +76,14 @@ std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& mod
     OPENVINO_ASSERT(model);
 
     uint64_t seed = 0;
-    // 1. Calculate hash on function, skipping weights if model path is provided
-    ov::pass::Manager m;
-    m.register_pass<ov::pass::Hash>(seed, !model_path.empty());
-    m.run_passes(std::const_pointer_cast<ov::Model>(model));
+    // 1. Calculate hash on function, skipping weights if model path is provided.
+    // The digests of the weights are memoized by the constant buffers, so only the first hashing of a model reads them
+    {
+        OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "ModelCache::compute_hash - Hash pass");
+        ov::pass::Manager m;
+        m.register_pass<ov::pass::Hash>(seed, !model_path.empty());
+        m.run_passes(std::const_pointer_cast<ov::Model>(model));
+    }
 
     // 2. Compute hash on serialized data and options
     seed = hash_combine_options(seed, compile_options);
@@ -25,3 +25,18 @@ void ov::IVariableState::set_state(const ov::SoPtr<ov::ITensor>& state) {
 ov::SoPtr<ov::ITensor> ov::IVariableState::get_state() const {
     return m_state;
 }
+
+void ov::IVariableState::fork_from(const std::shared_ptr<IVariableState>& source) {
+    OPENVINO_ASSERT(source, "The source variable state is not initialized.");
+    if (source.get() != this) {
+        set_state(source->get_state());
+    }
+}
+
+void ov::IVariableState::truncate(size_t) {
+    OPENVINO_NOT_IMPLEMENTED;
+}
+
+void ov::IVariableState::offload() {}
+
+void ov::IVariableState::prefetch() {}
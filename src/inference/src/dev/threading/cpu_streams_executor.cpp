@@ -6,6 +6,8 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -336,6 +338,86 @@ struct CPUStreamsExecutor::Impl {
         std::thread::id _executor_thread_id;
     };
 
+    // Bounded multi-producer multi-consumer queue of the tasks of a stream. The cells are sequenced as in the queue of
+    // D. Vyukov, so neither the submission nor the stealing takes a lock.
+    class StreamTaskQueue {
+    public:
+        explicit StreamTaskQueue(const size_t capacity) : _cells(new Cell[capacity]), _mask(capacity - 1) {
+            for (size_t i = 0; i < capacity; ++i) {
+                _cells[i]._sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        // the task is moved only if it is queued
+        bool push(Task& task) {
+            auto pos = _tail.load(std::memory_order_relaxed);
+            for (;;) {
+                auto& cell = _cells[pos & _mask];
+                const auto sequence = cell._sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+                if (diff == 0) {
+                    // sequentially consistent, so the parking workers don't miss the task
+                    if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_seq_cst)) {
+                        cell._task = std::move(task);
+                        cell._sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = _tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool pop(Task& task) {
+            auto pos = _head.load(std::memory_order_relaxed);
+            for (;;) {
+                auto& cell = _cells[pos & _mask];
+                const auto sequence = cell._sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+                if (diff == 0) {
+                    if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        task = std::move(cell._task);
+                        cell._task = nullptr;
+                        cell._sequence.store(pos + _mask + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = _head.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool empty() const {
+            return _head.load(std::memory_order_seq_cst) >= _tail.load(std::memory_order_seq_cst);
+        }
+
+    private:
+        struct Cell {
+            std::atomic<size_t> _sequence{0};
+            Task _task;
+        };
+        std::unique_ptr<Cell[]> _cells;
+        const size_t _mask;
+        alignas(64) std::atomic<size_t> _head{0};
+        alignas(64) std::atomic<size_t> _tail{0};
+    };
+
+    // The tasks are queued to the idle workers or to the busy ones in turn, an idle worker steals the tasks of the
+    // workers on the same numa node and then of the other nodes
+    struct alignas(64) Worker {
+        explicit Worker(const size_t capacity) : _tasks(capacity) {}
+        StreamTaskQueue _tasks;
+        // numa node of the worker stream, unknown until the stream is created
+        std::atomic<int> _numaNodeId{-1};
+        std::atomic<bool> _sleeping{false};
+        std::mutex _mutex;
+        std::condition_variable _condVar;
+    };
+
     explicit Impl(const Config& config) : _config{config} {
         _streams = std::make_shared<CustomThreadLocal>(
             [this] {
@@ -352,6 +434,9 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = std::move(numaNodes);
         }
+        for (auto streamId = 0; streamId < streams_num; ++streamId) {
+            _workers.emplace_back(new Worker{_workerQueueCapacity});
+        }
         for (auto streamId = 0; streamId < streams_num; ++streamId) {
             if (_config.get_cpu_reservation()) {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
@@ -359,20 +444,21 @@ struct CPUStreamsExecutor::Impl {
             }
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                auto& worker = *_workers[streamId];
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                    if (Take(streamId, task)) {
+                        // the stream (with its arena and pinning) is created by the first task as before, until then
+                        // the numa node of the worker is unknown and it steals from any node
+                        auto stream = _streams->local();
+                        if (worker._numaNodeId.load(std::memory_order_relaxed) < 0) {
+                            worker._numaNodeId.store(stream->_numaNodeId, std::memory_order_relaxed);
                         }
-                    }
-                    if (task) {
-                        Execute(task, *(_streams->local()));
+                        Execute(task, *stream);
+                    } else if (_isStopped) {
+                        break;
+                    } else {
+                        Park(streamId);
                     }
                 }
             });
@@ -380,11 +466,112 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
+        const auto first = _nextWorker.fetch_add(1, std::memory_order_relaxed);
+        // an idle worker gets the task first, so the task doesn't wait behind the running ones
+        for (size_t i = 0; i < _workers.size(); ++i) {
+            auto& worker = *_workers[(first + i) % _workers.size()];
+            if (worker._sleeping.load() && worker._tasks.push(task)) {
+                WakeUp(worker);
+                return;
+            }
+        }
+        for (size_t i = 0; i < _workers.size(); ++i) {
+            const auto workerId = (first + i) % _workers.size();
+            if (_workers[workerId]->_tasks.push(task)) {
+                // the worker could park since the check above, otherwise a peer steals the task
+                WakeUpPeer(workerId);
+                return;
+            }
+        }
+        // all the stream queues are full, any worker takes the task
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
+            _taskQueueSize.fetch_add(1);
         }
-        _queueCondVar.notify_one();
+        for (auto& worker : _workers) {
+            if (WakeUp(*worker)) {
+                break;
+            }
+        }
+    }
+
+    // wakes the worker up or one of its peers, the ones on the same numa node first
+    void WakeUpPeer(const size_t workerId) {
+        if (WakeUp(*_workers[workerId])) {
+            return;
+        }
+        const auto numaNodeId = _workers[workerId]->_numaNodeId.load();
+        for (const bool sameNode : {true, false}) {
+            for (size_t i = 1; i < _workers.size(); ++i) {
+                auto& peer = *_workers[(workerId + i) % _workers.size()];
+                if ((peer._numaNodeId.load() == numaNodeId) == sameNode && WakeUp(peer)) {
+                    return;
+                }
+            }
+        }
+    }
+
+    bool Take(const size_t workerId, Task& task) {
+        if (_workers[workerId]->_tasks.pop(task)) {
+            return true;
+        }
+        // the tasks of the other numa nodes are stolen only if there is nothing to do on the own one
+        const auto numaNodeId = _workers[workerId]->_numaNodeId.load(std::memory_order_relaxed);
+        for (const bool sameNode : {true, false}) {
+            for (size_t i = 1; i < _workers.size(); ++i) {
+                auto& victim = *_workers[(workerId + i) % _workers.size()];
+                if ((victim._numaNodeId.load(std::memory_order_relaxed) == numaNodeId) == sameNode &&
+                    victim._tasks.pop(task)) {
+                    return true;
+                }
+            }
+        }
+        if (_taskQueueSize.load() > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                _taskQueueSize.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool HasTasks() const {
+        for (const auto& worker : _workers) {
+            if (!worker->_tasks.empty()) {
+                return true;
+            }
+        }
+        return _taskQueueSize.load() > 0;
+    }
+
+    void Park(const size_t workerId) {
+        auto& worker = *_workers[workerId];
+        // the flag is raised before the queues are checked again, so a task queued meanwhile either is seen here or
+        // wakes the worker up
+        worker._sleeping.store(true);
+        if (HasTasks() || _isStopped) {
+            worker._sleeping.store(false);
+            return;
+        }
+        std::unique_lock<std::mutex> lock(worker._mutex);
+        worker._condVar.wait(lock, [&] {
+            return !worker._sleeping.load() || _isStopped;
+        });
+    }
+
+    bool WakeUp(Worker& worker) {
+        if (!worker._sleeping.exchange(false)) {
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(worker._mutex);
+        }
+        worker._condVar.notify_one();
+        return true;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -452,10 +639,14 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
+    // capacity of the queue of each stream, the tasks above it are queued to the shared queue
+    static constexpr size_t _workerQueueCapacity = 1024;
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::atomic<size_t> _nextWorker{0};
     std::mutex _mutex;
-    std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    std::atomic<size_t> _taskQueueSize{0};
+    std::atomic<bool> _isStopped{false};
     std::vector<int> _usedNumaNodes;
     std::shared_ptr<CustomThreadLocal> _streams;
     bool _isExit = false;
@@ -512,11 +703,11 @@ void CPUStreamsExecutor::cpu_reset() {
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) : _impl{new Impl{config}} {}
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
-    {
-        std::lock_guard<std::mutex> lock(_impl->_mutex);
-        _impl->_isStopped = true;
+    _impl->_isStopped = true;
+    for (auto& worker : _impl->_workers) {
+        std::lock_guard<std::mutex> lock(worker->_mutex);
+        worker->_condVar.notify_all();
     }
-    _impl->_queueCondVar.notify_all();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
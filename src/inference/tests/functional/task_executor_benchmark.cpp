@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "openvino/runtime/system_conf.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+
+using namespace ov::threading;
+
+namespace {
+
+// Submission overhead of the tiny tasks, it is not a regular test, so it is disabled and is run explicitly:
+// ov_inference_functional_tests --gtest_filter=*TaskExecutorBenchmark* --gtest_also_run_disabled_tests
+class TaskExecutorBenchmark : public ::testing::TestWithParam<int> {
+protected:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int tasks = 100000;
+    static constexpr int producers = 4;
+};
+
+TEST_P(TaskExecutorBenchmark, DISABLED_Throughput) {
+    const auto streams = GetParam();
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TaskExecutorBenchmark", streams, 1}};
+    std::atomic<int> done{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+
+    const auto start = Clock::now();
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < tasks / producers; i++) {
+                executor.run([&] {
+                    if (++done == tasks) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        finished.notify_one();
+                    }
+                });
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&] {
+            return done == tasks;
+        });
+    }
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+
+    std::cout << "streams: " << streams << ", tasks per second: " << static_cast<int64_t>(tasks / elapsed.count())
+              << std::endl;
+}
+
+TEST_P(TaskExecutorBenchmark, DISABLED_SubmitToStartLatency) {
+    const auto streams = GetParam();
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TaskExecutorBenchmark", streams, 1}};
+    constexpr int samples = 10000;
+    std::vector<std::chrono::nanoseconds> latencies(samples);
+    std::atomic<int> done{0};
+
+    for (int i = 0; i < samples; i++) {
+        const auto submitted = Clock::now();
+        executor.run([&, i, submitted] {
+            latencies[i] = Clock::now() - submitted;
+            done++;
+        });
+        // the executor is kept lightly loaded, so the wake up of the streams is measured as well
+        if (i % streams == streams - 1) {
+            while (done.load() <= i) {
+                std::this_thread::yield();
+            }
+        }
+    }
+    while (done.load() < samples) {
+        std::this_thread::yield();
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << "streams: " << streams << ", latency p50: " << latencies[samples / 2].count()
+              << " ns, p99: " << latencies[samples * 99 / 100].count() << " ns" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(TaskExecutorBenchmark,
+                         TaskExecutorBenchmark,
+                         ::testing::Values(1, 4, 16, 32, ov::get_number_of_logical_cpu_cores()));
+
+}  // namespace
@@ -5,11 +5,14 @@
 #include <gtest/gtest.h>
 
 #include <future>
+#include <numeric>
+#include <set>
 #include <thread>
 
 #include "common_test_utils/test_assertions.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
+#include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/immediate_executor.hpp"
 
 using namespace ::testing;
@@ -263,3 +266,110 @@ static auto AsyncExecutors = ::testing::Values(
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+TEST(CPUStreamsExecutorTests, tasksAboveStreamQueueCapacityAreExecutedInOrder) {
+    // the stream queue holds 1024 tasks, the rest of them waits in the shared queue of the executor
+    constexpr size_t numberOfTasks = 1024 * 2 + 100;
+    std::vector<size_t> order;
+    std::promise<void> done;
+    std::promise<void> started;
+    std::promise<void> released;
+    auto isReleased = released.get_future().share();
+    auto executor =
+        std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1});
+
+    executor->run([&started, isReleased] {
+        started.set_value();
+        isReleased.wait();
+    });
+    started.get_future().wait();
+    for (size_t i = 0; i < numberOfTasks; ++i) {
+        executor->run([&order, &done, i] {
+            order.push_back(i);
+            if (order.size() == numberOfTasks) {
+                done.set_value();
+            }
+        });
+    }
+    released.set_value();
+
+    ASSERT_EQ(std::future_status::ready, done.get_future().wait_for(std::chrono::seconds(60)));
+    std::vector<size_t> expected(numberOfTasks);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(expected, order);
+}
+
+TEST(CPUStreamsExecutorTests, tasksOfBusyNumaNodeAreStolenByIdleNode) {
+    if (get_num_numa_nodes() < 2) {
+        GTEST_SKIP() << "The work stealing across the numa nodes needs at least 2 numa nodes";
+    }
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::set<int> numaNodes;
+    std::set<int> releasedNodes;
+    bool releaseAll = false;
+    int blocked = 0;
+    auto release = [&](bool all) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            releaseAll = all;
+            releasedNodes = numaNodes;
+            // the streams of the first numa node stay busy
+            releasedNodes.erase(releasedNodes.begin());
+        }
+        cv.notify_all();
+    };
+    constexpr size_t numberOfTasks = 1000;
+    std::atomic<size_t> executedOnBusyNode{0};
+    auto streams = get_number_of_cpu_cores();
+    auto threads = parallel_get_max_threads();
+    auto executor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, threads / streams});
+
+    // every stream is blocked until its numa node is released
+    for (int i = 0; i < streams; ++i) {
+        executor->run([&] {
+            const auto numaNodeId = executor->get_numa_node_id();
+            std::unique_lock<std::mutex> lock(mutex);
+            numaNodes.insert(numaNodeId);
+            ++blocked;
+            cv.notify_all();
+            cv.wait(lock, [&] {
+                return releaseAll || releasedNodes.count(numaNodeId) != 0;
+            });
+        });
+    }
+    int busyNode = 0;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] {
+            return blocked == streams;
+        });
+        busyNode = *numaNodes.begin();
+    }
+    if (numaNodes.size() < 2) {
+        release(true);
+        GTEST_SKIP() << "The streams of the executor are placed on a single numa node";
+    }
+
+    // the tasks are queued to all the streams, while only the streams of the other numa nodes are released
+    std::vector<Future> futures;
+    for (size_t i = 0; i < numberOfTasks; ++i) {
+        futures.emplace_back(async(executor, [&] {
+            if (executor->get_numa_node_id() == busyNode) {
+                executedOnBusyNode++;
+            }
+        }));
+    }
+    release(false);
+
+    size_t executed = 0;
+    for (auto& future : futures) {
+        if (future.wait_for(std::chrono::seconds(60)) == std::future_status::ready) {
+            executed++;
+        }
+    }
+    release(true);
+    EXPECT_EQ(numberOfTasks, executed);
+    EXPECT_EQ(0U, executedOnBusyNode.load());
+}
@@ -381,6 +381,27 @@ TEST(NetworkContext_ModelName, HashOfExistingFile) {
               ov::ModelCache::compute_hash(file2, {{"key", "value"}}));
 }
 
+TEST(NetworkContext, HashOfLargeWeights) {
+    auto make_model = [](float value) {
+        auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1024, 1024});
+        auto weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1024, 1024}, {1.f});
+        auto bias = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1024, 1024}, {value});
+        auto mul = std::make_shared<ov::op::v1::Multiply>(data, weights);
+        auto add = std::make_shared<ov::op::v1::Add>(mul, bias);
+        auto res = std::make_shared<ov::op::v0::Result>(add);
+        return std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{data});
+    };
+    auto model1 = make_model(1.f);
+    auto model2 = make_model(2.f);
+    const auto hash1 = ov::ModelCache::compute_hash(model1, {});
+    // the second hashing uses the digests memoized by the constants
+    ASSERT_EQ(hash1, ov::ModelCache::compute_hash(model1, {}));
+    ASSERT_EQ(hash1, ov::ModelCache::compute_hash(model1->clone(), {}));
+    ASSERT_EQ(hash1, ov::ModelCache::compute_hash(make_model(1.f), {}));
+    ASSERT_NE(hash1, ov::ModelCache::compute_hash(model2, {}));
+    ASSERT_NE(hash1, ov::ModelCache::compute_hash(model1, {{"key", "value"}}));
+}
+
 TEST(NetworkContext, HashOfSameModelWithClone) {
     auto model1 = create_simple_model();
     // test model with friendly name
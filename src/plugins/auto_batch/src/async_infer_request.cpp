@@ -65,10 +65,12 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
+                _this->m_sync_request->m_enqueue_time = std::chrono::steady_clock::now();
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
-                if (sz == workerInferRequest->_batch_size) {
+                // the adaptive worker re-evaluates its flush deadline on every new request
+                if (sz == workerInferRequest->_batch_size || workerInferRequest->_adaptive) {
                     workerInferRequest->_is_wakeup = true;
                     workerInferRequest->_cond.notify_one();
                 }
@@ -83,6 +85,7 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                  if (batchReq->_exception_ptr)  // when the batchN execution failed
                      std::rethrow_exception(batchReq->_exception_ptr);
                  // in the case of non-batched execution the tensors were set explicitly
+                 // the adaptive smaller batches copy the outputs on completion
                  if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED ==
                      this->m_sync_request->m_batched_request_status) {
                      this->m_sync_request->copy_outputs_if_needed();
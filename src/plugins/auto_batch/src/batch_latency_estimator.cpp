@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "batch_latency_estimator.hpp"
+
+#include <algorithm>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace autobatch_plugin {
+
+BatchLatencyEstimator::BatchLatencyEstimator(std::vector<uint32_t> batch_sizes, double smoothing)
+    : m_batch_sizes(std::move(batch_sizes)),
+      m_smoothing(smoothing) {
+    OPENVINO_ASSERT(m_smoothing > 0 && m_smoothing <= 1, "Unexpected smoothing factor ", m_smoothing);
+    m_batch_sizes.push_back(1);
+    std::sort(m_batch_sizes.begin(), m_batch_sizes.end());
+    m_batch_sizes.erase(std::unique(m_batch_sizes.begin(), m_batch_sizes.end()), m_batch_sizes.end());
+    m_batch_sizes.erase(std::remove(m_batch_sizes.begin(), m_batch_sizes.end(), 0u), m_batch_sizes.end());
+    m_times_us.resize(m_batch_sizes.size(), 0.0);
+}
+
+void BatchLatencyEstimator::update(uint32_t batch_size, Duration duration) {
+    const auto it = std::lower_bound(m_batch_sizes.begin(), m_batch_sizes.end(), batch_size);
+    if (it == m_batch_sizes.end() || *it != batch_size)
+        return;
+    const auto observed = static_cast<double>(std::max<Duration::rep>(duration.count(), 1));
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& time = m_times_us[it - m_batch_sizes.begin()];
+    time = time > 0 ? time + m_smoothing * (observed - time) : observed;
+}
+
+BatchLatencyEstimator::Duration BatchLatencyEstimator::estimate(uint32_t batch_size) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return estimate_unlocked(batch_size);
+}
+
+BatchLatencyEstimator::Duration BatchLatencyEstimator::estimate_unlocked(uint32_t batch_size) const {
+    // the closest observed batch size which is not greater than the requested one
+    for (size_t i = m_batch_sizes.size(); i > 0; i--) {
+        if (m_batch_sizes[i - 1] <= batch_size && m_times_us[i - 1] > 0) {
+            return Duration(
+                static_cast<Duration::rep>(m_times_us[i - 1] * batch_size / static_cast<double>(m_batch_sizes[i - 1])));
+        }
+    }
+    // nothing smaller is observed, the larger batches are not expected to be faster
+    for (size_t i = 0; i < m_batch_sizes.size(); i++) {
+        if (m_batch_sizes[i] > batch_size && m_times_us[i] > 0) {
+            return Duration(static_cast<Duration::rep>(m_times_us[i]));
+        }
+    }
+    return Duration(0);
+}
+
+std::vector<uint32_t> BatchLatencyEstimator::split(size_t num_requests, Duration budget) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const bool budget_exceeded = estimate_unlocked(1) > budget;
+    std::vector<uint32_t> batches;
+    while (num_requests > 0) {
+        uint32_t selected = 1;
+        for (const auto batch_size : m_batch_sizes) {
+            if (batch_size > num_requests)
+                break;
+            if (budget_exceeded || estimate_unlocked(batch_size) <= budget)
+                selected = batch_size;
+        }
+        batches.push_back(selected);
+        num_requests -= selected;
+    }
+    return batches;
+}
+
+}  // namespace autobatch_plugin
+}  // namespace ov
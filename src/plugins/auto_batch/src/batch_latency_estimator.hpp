@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace ov {
+namespace autobatch_plugin {
+
+/**
+ * @brief Keeps the observed execution times of the batch sizes compiled for the adaptive auto-batching and splits the
+ * collected requests into the batches which are expected to meet the target latency
+ */
+class BatchLatencyEstimator {
+public:
+    using Duration = std::chrono::microseconds;
+
+    /**
+     * @param batch_sizes available batch sizes, the batch of 1 is always available
+     * @param smoothing weight of the new observation in the exponential moving average
+     */
+    explicit BatchLatencyEstimator(std::vector<uint32_t> batch_sizes, double smoothing = 0.2);
+
+    void update(uint32_t batch_size, Duration duration);
+
+    /**
+     * @brief Expected execution time of the batch. Not yet observed batch sizes are extrapolated linearly from the
+     * closest observed smaller batch (or take the time of the closest observed larger one), zero is returned when
+     * nothing is observed yet
+     */
+    Duration estimate(uint32_t batch_size) const;
+
+    /**
+     * @brief Splits \p num_requests requests into the available batch sizes. The largest batches which are expected
+     * to be executed within \p budget are taken first. When even the batch of 1 doesn't fit the budget, the target is
+     * already missed, so the largest batches are taken to maximize the throughput.
+     */
+    std::vector<uint32_t> split(size_t num_requests, Duration budget) const;
+
+    const std::vector<uint32_t>& batch_sizes() const {
+        return m_batch_sizes;
+    }
+
+private:
+    Duration estimate_unlocked(uint32_t batch_size) const;
+
+    std::vector<uint32_t> m_batch_sizes;  // ascending
+    std::vector<double> m_times_us;       // zero means "not observed"
+    const double m_smoothing;
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace autobatch_plugin
+}  // namespace ov
@@ -5,6 +5,9 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "compiled_model.hpp"
 
+#include <algorithm>
+#include <future>
+
 #include "async_infer_request.hpp"
 
 namespace ov {
@@ -17,18 +20,31 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::set<std::size_t>& batched_outputs,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                             const ov::SoPtr<ov::IRemoteContext>& context)
+                             const ov::SoPtr<ov::IRemoteContext>& context,
+                             const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>& compiled_models_ladder)
     : ov::ICompiledModel(model, plugin, context),
       m_config(config),
       m_batched_inputs(batched_inputs),
       m_batched_outputs(batched_outputs),
       m_compiled_model_with_batch(compiled_model_with_batch),
-      m_compiled_model_without_batch(compiled_model_without_batch) {
+      m_compiled_model_without_batch(compiled_model_without_batch),
+      m_compiled_models_ladder(compiled_models_ladder) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     m_device_info = device_info;
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto target_latency = config.find(ov::auto_batch_target_latency.name());
+    if (target_latency != config.end())
+        m_target_latency = target_latency->second.as<std::uint32_t>();
+    m_adaptive = m_target_latency > 0 && m_compiled_model_with_batch && m_device_info.device_batch_size > 1;
+    if (m_adaptive) {
+        std::vector<uint32_t> batch_sizes = {1};
+        for (const auto& ladder : m_compiled_models_ladder)
+            batch_sizes.push_back(ladder.first);
+        batch_sizes.push_back(m_device_info.device_batch_size);
+        m_latency_estimator = std::make_unique<BatchLatencyEstimator>(std::move(batch_sizes));
+    }
 }
 
 CompiledModel::~CompiledModel() {
@@ -65,10 +81,15 @@ CompiledModel::GetWorkerInferRequest() const {
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
         workerRequestPtr->_is_wakeup = false;
+        workerRequestPtr->_adaptive = m_adaptive;
         workerRequestPtr->_infer_request_batched->set_callback(
-            [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
+            [workerRequestPtr, this](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                else if (workerRequestPtr->_adaptive)
+                    m_latency_estimator->update(workerRequestPtr->_batch_size,
+                                                std::chrono::duration_cast<BatchLatencyEstimator::Duration>(
+                                                    std::chrono::steady_clock::now() - workerRequestPtr->_start_time));
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
@@ -80,6 +101,10 @@ CompiledModel::GetWorkerInferRequest() const {
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            if (workerRequestPtr->_adaptive) {
+                run_adaptive_worker(*workerRequestPtr);
+                return;
+            }
             while (1) {
                 std::cv_status status;
                 {
@@ -96,15 +121,11 @@ CompiledModel::GetWorkerInferRequest() const {
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
                     if (sz == workerRequestPtr->_batch_size) {
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+                        std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks(sz);
                         for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            workerRequestPtr->_completion_tasks[n] = std::move(t.second);
-                            t.first->m_sync_request->copy_inputs_if_needed();
-                            t.first->m_sync_request->m_batched_request_status =
-                                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
+                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(tasks[n]));
                         }
-                        workerRequestPtr->_infer_request_batched->start_async();
+                        execute_full_batch(*workerRequestPtr, tasks);
                     } else if ((status == std::cv_status::timeout) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
@@ -138,6 +159,170 @@ CompiledModel::GetWorkerInferRequest() const {
     return {m_worker_requests.back(), static_cast<int>(batch_id)};
 }
 
+void CompiledModel::execute_full_batch(
+    WorkerInferRequest& worker,
+    std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>& tasks) const {
+    for (size_t n = 0; n < tasks.size(); n++) {
+        worker._completion_tasks[n] = std::move(tasks[n].second);
+        tasks[n].first->m_sync_request->copy_inputs_if_needed();
+        tasks[n].first->m_sync_request->m_batched_request_status =
+            ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
+    }
+    worker._start_time = std::chrono::steady_clock::now();
+    worker._infer_request_batched->start_async();
+}
+
+void CompiledModel::execute_partial_batch(
+    WorkerInferRequest& worker,
+    std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>& tasks,
+    BatchLatencyEstimator::Duration budget) const {
+    using eExecutionFlavor = ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor;
+    // the state of a chunk is owned by the callback of its request, as the worker does not wait for the completion
+    struct PartialBatch {
+        std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks;
+        ov::SoPtr<ov::IAsyncInferRequest> request;
+        uint32_t batch_size = 0;
+        std::chrono::steady_clock::time_point start;
+    };
+    const auto elapsed = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration_cast<BatchLatencyEstimator::Duration>(std::chrono::steady_clock::now() - start);
+    };
+    auto* worker_ptr = &worker;
+    const auto complete_chunk = [worker_ptr](const std::shared_ptr<PartialBatch>& chunk, std::exception_ptr p) {
+        for (size_t slot = 0; slot < chunk->tasks.size(); slot++) {
+            auto& sync_request = chunk->tasks[slot].first->m_sync_request;
+            if (!p) {
+                try {
+                    sync_request->copy_outputs_from_batch_slot(chunk->request, slot, chunk->batch_size);
+                } catch (...) {
+                    sync_request->m_exception_ptr = std::current_exception();
+                }
+            } else {
+                sync_request->m_exception_ptr = p;
+            }
+        }
+        if (chunk->request) {
+            std::lock_guard<std::mutex> lock(worker_ptr->_ladder_requests_mutex);
+            worker_ptr->_idle_ladder_requests[chunk->batch_size].push_back(std::move(chunk->request));
+        }
+        // the requests are notified last, as the worker and the compiled model may be released right after that
+        for (auto& task : chunk->tasks) {
+            task.second();
+        }
+    };
+
+    size_t offset = 0;
+    for (const auto batch_size : m_latency_estimator->split(tasks.size(), budget)) {
+        const auto start = std::chrono::steady_clock::now();
+        if (batch_size == 1) {
+            auto t = tasks[offset];
+            try {
+                t.first->m_request_without_batch->set_callback([this, t, start, elapsed](std::exception_ptr p) {
+                    if (p)
+                        t.first->m_sync_request->m_exception_ptr = p;
+                    else
+                        m_latency_estimator->update(1, elapsed(start));
+                    t.second();
+                });
+                t.first->m_sync_request->m_batched_request_status = eExecutionFlavor::TIMEOUT_EXECUTED;
+                t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
+                t.first->m_request_without_batch->start_async();
+            } catch (...) {
+                t.first->m_sync_request->m_exception_ptr = std::current_exception();
+                t.second();
+            }
+        } else {
+            auto chunk = std::make_shared<PartialBatch>();
+            chunk->tasks.assign(tasks.begin() + offset, tasks.begin() + offset + batch_size);
+            chunk->batch_size = batch_size;
+            chunk->start = start;
+            try {
+                {
+                    // the chunks of the same size may run concurrently, so each one takes its own request
+                    std::lock_guard<std::mutex> lock(worker._ladder_requests_mutex);
+                    auto& idle = worker._idle_ladder_requests[batch_size];
+                    if (!idle.empty()) {
+                        chunk->request = std::move(idle.back());
+                        idle.pop_back();
+                    }
+                }
+                if (!chunk->request) {
+                    const auto& compiled_model = m_compiled_models_ladder.at(batch_size);
+                    chunk->request = {compiled_model->create_infer_request(), compiled_model._so};
+                }
+                for (size_t slot = 0; slot < batch_size; slot++) {
+                    chunk->tasks[slot].first->m_sync_request->copy_inputs_to_batch_slot(chunk->request,
+                                                                                        slot,
+                                                                                        batch_size);
+                    chunk->tasks[slot].first->m_sync_request->m_batched_request_status =
+                        eExecutionFlavor::ADAPTIVE_BATCH_EXECUTED;
+                }
+                chunk->request->set_callback([this, chunk, complete_chunk, elapsed](std::exception_ptr p) {
+                    if (!p)
+                        m_latency_estimator->update(chunk->batch_size, elapsed(chunk->start));
+                    complete_chunk(chunk, p);
+                });
+                chunk->request->start_async();
+            } catch (...) {
+                complete_chunk(chunk, std::current_exception());
+            }
+        }
+        offset += batch_size;
+    }
+}
+
+void CompiledModel::run_adaptive_worker(WorkerInferRequest& worker) const {
+    using Duration = BatchLatencyEstimator::Duration;
+    std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> pending;
+    auto wait_time = std::chrono::milliseconds(m_time_out);
+    while (!m_terminate) {
+        {
+            std::unique_lock<std::mutex> lock(worker._mutex);
+            worker._cond.wait_for(lock, wait_time, [&worker] {
+                return worker._is_wakeup;
+            });
+            worker._is_wakeup = false;
+        }
+        if (m_terminate)
+            break;
+        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+        while (worker._tasks.try_pop(t))
+            pending.push_back(std::move(t));
+        wait_time = std::chrono::milliseconds(m_time_out);
+        if (pending.empty())
+            continue;
+        if (pending.size() == static_cast<size_t>(worker._batch_size)) {
+            // the batch is collected, the zero-copy path of the regular auto-batching is used
+            execute_full_batch(worker, pending);
+            pending.clear();
+            continue;
+        }
+
+        // the oldest request defines how long the rest of the batch can be waited for
+        const auto oldest = std::min_element(pending.begin(), pending.end(), [](const auto& a, const auto& b) {
+            return a.first->m_sync_request->m_enqueue_time < b.first->m_sync_request->m_enqueue_time;
+        });
+        const auto waited = std::chrono::duration_cast<Duration>(std::chrono::steady_clock::now() -
+                                                                 oldest->first->m_sync_request->m_enqueue_time);
+        const Duration target = std::chrono::milliseconds(m_target_latency);
+        Duration flush_at = std::chrono::milliseconds(m_time_out);
+        if (target.count() > 0) {
+            // waiting makes sense only while the full batch is still expected to meet the target latency
+            const auto full_batch_time = m_latency_estimator->estimate(worker._batch_size);
+            flush_at = std::min(flush_at, std::max(Duration(0), target - full_batch_time));
+        }
+        if (waited < flush_at) {
+            wait_time = std::max(std::chrono::milliseconds(1),
+                                 std::chrono::ceil<std::chrono::milliseconds>(flush_at - waited));
+            continue;
+        }
+        // the worker does not wait for the partial batch: its requests can't be resubmitted before the completion, so
+        // the full batch is not collected in the meantime, while the new requests may form the next partial batches
+        execute_partial_batch(worker, pending, target.count() > 0 ? target - waited : Duration::max());
+        pending.clear();
+    }
+}
+
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     ov::SoPtr<ov::IAsyncInferRequest> infer_request_without_batch = {
         m_compiled_model_without_batch->create_infer_request(),
@@ -170,11 +355,21 @@ void CompiledModel::set_property(const ov::AnyMap& properties) {
         if (property.first == ov::auto_batch_timeout.name()) {
             m_time_out = property.second.as<std::uint32_t>();
             m_config[ov::auto_batch_timeout.name()] = property.second.as<std::uint32_t>();
+        } else if (property.first == ov::auto_batch_target_latency.name()) {
+            const auto target_latency = property.second.as<std::uint32_t>();
+            // the smaller batch sizes are compiled only when the target latency is set on the compilation
+            OPENVINO_ASSERT(m_adaptive || target_latency == 0,
+                            "The adaptive auto-batching can be enabled only on the model compilation via ",
+                            ov::auto_batch_target_latency.name());
+            m_target_latency = target_latency;
+            m_config[ov::auto_batch_target_latency.name()] = target_latency;
         } else {
             OPENVINO_THROW("AutoBatching Compiled Model dosen't support property",
                            property.first,
-                           ". The only property that can be changed on the fly is the ",
-                           ov::auto_batch_timeout.name());
+                           ". The only properties that can be changed on the fly are the ",
+                           ov::auto_batch_timeout.name(),
+                           " and ",
+                           ov::auto_batch_target_latency.name());
         }
     }
 }
@@ -212,10 +407,14 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_target_latency.name(), ov::PropertyMutability::RW}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == ov::auto_batch_target_latency) {
+            uint32_t target_latency = m_target_latency;
+            return target_latency;
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
@@ -6,8 +6,10 @@
 #pragma once
 
 #include <condition_variable>
+#include <map>
 #include <thread>
 
+#include "batch_latency_estimator.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/threading/thread_safe_containers.hpp"
@@ -31,6 +33,12 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+        // adaptive batching: the worker executes the partial batches with the smaller batch sizes
+        bool _adaptive = false;
+        std::chrono::steady_clock::time_point _start_time;
+        // the requests of the smaller batch sizes which are not executing a partial batch at the moment
+        std::map<uint32_t, std::vector<ov::SoPtr<ov::IAsyncInferRequest>>> _idle_ladder_requests;
+        std::mutex _ladder_requests_mutex;
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -41,7 +49,8 @@ public:
                   const std::set<std::size_t>& batched_outputs,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                  const ov::SoPtr<ov::IRemoteContext>& context);
+                  const ov::SoPtr<ov::IRemoteContext>& context,
+                  const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>& compiled_models_ladder = {});
 
     void set_property(const ov::AnyMap& properties) override;
 
@@ -68,17 +77,31 @@ protected:
 
     std::pair<std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>, int> GetWorkerInferRequest()
         const;
+    void run_adaptive_worker(WorkerInferRequest& worker) const;
+    void execute_full_batch(
+        WorkerInferRequest& worker,
+        std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>& tasks) const;
+    void execute_partial_batch(
+        WorkerInferRequest& worker,
+        std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>& tasks,
+        BatchLatencyEstimator::Duration budget) const;
+
     mutable std::vector<std::shared_ptr<WorkerInferRequest>> m_worker_requests;
     mutable std::mutex m_worker_requests_mutex;
 
     mutable std::atomic_size_t m_num_requests_created = {0};
     std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    std::atomic<std::uint32_t> m_target_latency = {0};  // in ms, zero disables the adaptive batching
+    bool m_adaptive = false;
 
     const std::set<std::size_t> m_batched_inputs;
     const std::set<std::size_t> m_batched_outputs;
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+    // the smaller batch sizes compiled for the adaptive batching
+    std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>> m_compiled_models_ladder;
+    std::unique_ptr<BatchLatencyEstimator> m_latency_estimator;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
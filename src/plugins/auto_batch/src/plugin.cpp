@@ -22,6 +22,7 @@ namespace autobatch_plugin {
 std::vector<ov::PropertyName> supported_configKeys = {
     ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{ov::auto_batch_target_latency.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW}};
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
@@ -118,6 +119,7 @@ OV_DEFINE_PLUGIN_CREATE_FUNCTION(Plugin, version)
 Plugin::Plugin() {
     set_device_name("BATCH");
     m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_target_latency(0));  // adaptive batching is disabled by default
     m_plugin_config.insert(ov::enable_profiling(false));
 }
 
@@ -268,29 +270,46 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), c.first))
             compiled_model_config.insert(c);
     }
+    auto compile_with_batch = [&](uint32_t batch_size) {
+        auto reshaped = model->clone();
+        auto inputs = reshaped->inputs();
+        std::map<std::size_t, ov::PartialShape> partial_shapes;
+        for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
+            auto input_shape = inputs[input_id].get_shape();
+            if (batched_inputs.find(input_id) != batched_inputs.end()) {
+                input_shape[0] = batch_size;
+            }
+            partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
+        }
+
+        reshaped->reshape(partial_shapes);
+        return context ? core->compile_model(reshaped, context, device_config_no_auto_batch)
+                       : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+    };
     ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
-    auto reshaped = model->clone();
     if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
         try {
-            auto inputs = reshaped->inputs();
-            std::map<std::size_t, ov::PartialShape> partial_shapes;
-            for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
-                auto input_shape = inputs[input_id].get_shape();
-                if (batched_inputs.find(input_id) != batched_inputs.end()) {
-                    input_shape[0] = meta_device.device_batch_size;
-                }
-                partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
-            }
-
-            reshaped->reshape(partial_shapes);
-            compiled_model_with_batch = context
-                                            ? core->compile_model(reshaped, context, device_config_no_auto_batch)
-                                            : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+            compiled_model_with_batch = compile_with_batch(meta_device.device_batch_size);
         } catch (const ov::Exception&) {
             meta_device.device_batch_size = 1;
         }
     }
 
+    // with the target latency set, the partially collected batch is executed with the ladder of the smaller
+    // (power of two) batch sizes instead of falling back to the batch1 on the timeout
+    std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>> compiled_models_ladder;
+    const auto target_latency = full_properties.find(ov::auto_batch_target_latency.name());
+    if (compiled_model_with_batch && target_latency != full_properties.end() &&
+        target_latency->second.as<uint32_t>() > 0) {
+        for (uint32_t batch_size = 2; batch_size < meta_device.device_batch_size; batch_size *= 2) {
+            try {
+                compiled_models_ladder[batch_size] = compile_with_batch(batch_size);
+            } catch (const ov::Exception&) {
+                // the batch size is just skipped, the requests are split into the other ones
+            }
+        }
+    }
+
     ov::SoPtr<ov::IRemoteContext> device_context;
     if (!context) {
         try {
@@ -311,7 +330,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
                                            batched_outputs,
                                            compiled_model_with_batch,
                                            compiled_model_without_batch,
-                                           device_context);
+                                           device_context,
+                                           compiled_models_ladder);
 }
 
 ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
@@ -112,21 +112,47 @@ void SyncInferRequest::copy_inputs_if_needed() {
     }
 }
 
+void SyncInferRequest::copy_inputs_to_batch_slot(ov::SoPtr<ov::IAsyncInferRequest>& req,
+                                                 size_t slot,
+                                                 size_t batch_size) {
+    for (const auto& it : get_inputs()) {
+        auto dst_tensor = req->get_tensor(it);
+        copy_tensor_if_needed(get_tensor(it), dst_tensor, true, slot, batch_size);
+    }
+}
+
+void SyncInferRequest::copy_outputs_from_batch_slot(ov::SoPtr<ov::IAsyncInferRequest>& req,
+                                                    size_t slot,
+                                                    size_t batch_size) {
+    for (const auto& it : get_outputs()) {
+        auto dst_tensor = get_tensor(it);
+        copy_tensor_if_needed(req->get_tensor(it), dst_tensor, false, slot, batch_size);
+    }
+}
+
 void SyncInferRequest::copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
                                              ov::SoPtr<ov::ITensor>& dst,
                                              const bool bInput) {
+    copy_tensor_if_needed(src, dst, bInput, m_batch_id, m_batch_size);
+}
+
+void SyncInferRequest::copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
+                                             ov::SoPtr<ov::ITensor>& dst,
+                                             const bool bInput,
+                                             size_t batch_id,
+                                             size_t batch_size) {
     auto ptrDst = static_cast<char*>(dst->data());
     auto ptrSrc = static_cast<char*>(src->data());
     ptrdiff_t szDst = dst->get_byte_size();
     ptrdiff_t szSrc = src->get_byte_size();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? m_batch_id * szDst / m_batch_size : 0;
+        ptrdiff_t offset = szSrc != szDst ? batch_id * szDst / batch_size : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? m_batch_id * szSrc / m_batch_size : 0;
+        ptrdiff_t offset = szSrc != szDst ? batch_id * szSrc / batch_size : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -5,6 +5,8 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <chrono>
+
 #include "compiled_model.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 
@@ -27,6 +29,11 @@ public:
 
     void copy_outputs_if_needed();
 
+    // Adaptive batching: copies the data to/from the given slot of a request compiled with a smaller batch
+    void copy_inputs_to_batch_slot(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t slot, size_t batch_size);
+
+    void copy_outputs_from_batch_slot(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t slot, size_t batch_size);
+
     void infer() override;
 
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
@@ -40,14 +47,24 @@ public:
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
-        TIMEOUT_EXECUTED
+        TIMEOUT_EXECUTED,
+        ADAPTIVE_BATCH_EXECUTED
     } m_batched_request_status = eExecutionFlavor::NOT_EXECUTED;
 
     size_t get_batch_size() const;
 
+    // the moment the request was queued to the worker, used by the adaptive batching
+    std::chrono::steady_clock::time_point m_enqueue_time;
+
 protected:
     void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src, ov::SoPtr<ov::ITensor>& dst, const bool bInput);
 
+    static void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
+                                      ov::SoPtr<ov::ITensor>& dst,
+                                      const bool bInput,
+                                      size_t batch_id,
+                                      size_t batch_size);
+
     void share_tensors_with_batched_req(const std::set<std::size_t>& batched_inputs,
                                         const std::set<std::size_t>& batched_outputs);
 
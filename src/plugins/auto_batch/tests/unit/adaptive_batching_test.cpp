@@ -0,0 +1,192 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+
+#include "async_infer_request.hpp"
+#include "common_test_utils/subgraph_builders/multi_single_conv.hpp"
+#include "mock_common.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icore.hpp"
+
+using eExecutionFlavor = SyncInferRequest::eExecutionFlavor;
+
+namespace {
+
+// the hardware request which completes the inference right on the start
+class ImmediateAsyncInferRequest : public ov::IAsyncInferRequest {
+public:
+    ImmediateAsyncInferRequest(const std::shared_ptr<ov::IInferRequest>& request, std::atomic<size_t>& started)
+        : IAsyncInferRequest(request, nullptr, nullptr),
+          m_started(started) {
+        m_pipeline = {};
+    }
+
+    void set_callback(std::function<void(std::exception_ptr)> callback) override {
+        m_completion = std::move(callback);
+    }
+
+    void start_async() override {
+        m_started++;
+        if (m_completion)
+            m_completion(nullptr);
+    }
+
+private:
+    std::function<void(std::exception_ptr)> m_completion;
+    std::atomic<size_t>& m_started;
+};
+
+}  // namespace
+
+class AutoBatchAdaptiveWorkerTest : public ::testing::Test {
+public:
+    static constexpr uint32_t m_batch_size = 4;
+    static constexpr uint32_t m_ladder_batch_size = 2;
+
+    std::shared_ptr<ov::Model> m_model;
+    std::shared_ptr<NiceMock<ov::MockICore>> m_core;
+    std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>> m_auto_batch_plugin;
+    std::shared_ptr<NiceMock<MockIPlugin>> m_hardware_plugin;
+
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_without_batch;
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_with_batch;
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_ladder;
+
+    std::set<std::size_t> m_batched_inputs;
+    std::set<std::size_t> m_batched_outputs;
+
+    // the number of the started inferences of each compiled model
+    std::atomic<size_t> m_started_without_batch{0};
+    std::atomic<size_t> m_started_with_batch{0};
+    std::atomic<size_t> m_started_ladder{0};
+
+    std::shared_ptr<CompiledModel> m_auto_batch_compile_model;
+    std::vector<std::shared_ptr<AsyncInferRequest>> m_requests;
+
+    static std::shared_ptr<ov::Model> reshape(const std::shared_ptr<ov::Model>& model, uint32_t batch_size) {
+        auto reshaped = model->clone();
+        std::map<std::size_t, ov::PartialShape> partial_shapes;
+        const auto inputs = reshaped->inputs();
+        for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
+            auto input_shape = inputs[input_id].get_shape();
+            input_shape[0] = batch_size;
+            partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
+        }
+        reshaped->reshape(partial_shapes);
+        return reshaped;
+    }
+
+    void mock_requests(const std::shared_ptr<NiceMock<MockICompiledModel>>& compiled_model,
+                       std::atomic<size_t>& started) {
+        // the mock must not own itself
+        std::weak_ptr<NiceMock<MockICompiledModel>> weak_compiled_model = compiled_model;
+        ON_CALL(*compiled_model, create_infer_request()).WillByDefault([weak_compiled_model, &started]() {
+            auto sync_request = std::make_shared<NiceMock<MockISyncInferRequest>>(weak_compiled_model.lock());
+            return std::make_shared<ImmediateAsyncInferRequest>(sync_request, started);
+        });
+    }
+
+    void SetUp() override {
+        m_model = ov::test::utils::make_multi_single_conv();
+        for (size_t input_id = 0; input_id < m_model->get_parameters().size(); input_id++)
+            m_batched_inputs.insert(input_id);
+        for (size_t output_id = 0; output_id < m_model->get_results().size(); output_id++)
+            m_batched_outputs.insert(output_id);
+
+        m_core = std::shared_ptr<NiceMock<ov::MockICore>>(new NiceMock<ov::MockICore>());
+        m_auto_batch_plugin =
+            std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>>(new NiceMock<MockAutoBatchInferencePlugin>());
+        m_auto_batch_plugin->set_core(m_core);
+        m_hardware_plugin = std::shared_ptr<NiceMock<MockIPlugin>>(new NiceMock<MockIPlugin>());
+
+        m_i_compile_model_without_batch = std::make_shared<NiceMock<MockICompiledModel>>(m_model, m_hardware_plugin);
+        m_i_compile_model_with_batch =
+            std::make_shared<NiceMock<MockICompiledModel>>(reshape(m_model, m_batch_size), m_hardware_plugin);
+        m_i_compile_model_ladder =
+            std::make_shared<NiceMock<MockICompiledModel>>(reshape(m_model, m_ladder_batch_size), m_hardware_plugin);
+        mock_requests(m_i_compile_model_without_batch, m_started_without_batch);
+        mock_requests(m_i_compile_model_with_batch, m_started_with_batch);
+        mock_requests(m_i_compile_model_ladder, m_started_ladder);
+    }
+
+    void TearDown() override {
+        m_requests.clear();
+        // joins the worker threads
+        m_auto_batch_compile_model.reset();
+    }
+
+    void compile(uint32_t timeout, uint32_t target_latency) {
+        const ov::AnyMap config = {{ov::auto_batch_timeout.name(), timeout},
+                                   {ov::auto_batch_target_latency.name(), target_latency}};
+        const DeviceInformation device_info = {"CPU", {}, m_batch_size};
+        OV_ASSERT_NO_THROW(m_auto_batch_compile_model = std::make_shared<CompiledModel>(
+                               m_model->clone(),
+                               m_auto_batch_plugin,
+                               config,
+                               device_info,
+                               m_batched_inputs,
+                               m_batched_outputs,
+                               ov::SoPtr<ov::ICompiledModel>{m_i_compile_model_with_batch, {}},
+                               ov::SoPtr<ov::ICompiledModel>{m_i_compile_model_without_batch, {}},
+                               ov::SoPtr<ov::IRemoteContext>{},
+                               std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>{
+                                   {m_ladder_batch_size, {m_i_compile_model_ladder, {}}}}));
+        // the requests of the same worker, i.e. of the same full batch
+        for (uint32_t i = 0; i < m_batch_size; i++) {
+            auto request =
+                std::dynamic_pointer_cast<AsyncInferRequest>(m_auto_batch_compile_model->create_infer_request());
+            ASSERT_NE(request, nullptr);
+            m_requests.push_back(request);
+        }
+    }
+
+    // starts the first \p load requests at once and waits for all of them
+    std::vector<eExecutionFlavor> infer(size_t load) {
+        for (size_t i = 0; i < load; i++)
+            m_requests[i]->start_async();
+        std::vector<eExecutionFlavor> flavors;
+        for (size_t i = 0; i < load; i++) {
+            m_requests[i]->wait();
+            flavors.push_back(m_requests[i]->m_sync_request->m_batched_request_status);
+        }
+        std::sort(flavors.begin(), flavors.end());
+        return flavors;
+    }
+};
+
+TEST_F(AutoBatchAdaptiveWorkerTest, PartialBatchIsFlushedOnTimeout) {
+    constexpr uint32_t timeout = 50;
+    compile(timeout, 1000);
+
+    const auto start = std::chrono::steady_clock::now();
+    // the full batch is never collected, so the worker splits the requests into the smaller batches on the timeout
+    const auto flavors = infer(m_batch_size - 1);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(timeout));
+    EXPECT_EQ(flavors,
+              std::vector<eExecutionFlavor>({eExecutionFlavor::TIMEOUT_EXECUTED,
+                                             eExecutionFlavor::ADAPTIVE_BATCH_EXECUTED,
+                                             eExecutionFlavor::ADAPTIVE_BATCH_EXECUTED}));
+    EXPECT_EQ(m_started_ladder.load(), 1U);
+    EXPECT_EQ(m_started_without_batch.load(), 1U);
+    EXPECT_EQ(m_started_with_batch.load(), 0U);
+}
+
+TEST_F(AutoBatchAdaptiveWorkerTest, BatchSizeGrowsWithLoad) {
+    // the timeout is not reached, the partial batches are flushed when the target latency is about to be missed
+    compile(10000, 200);
+
+    EXPECT_EQ(infer(1), std::vector<eExecutionFlavor>({eExecutionFlavor::TIMEOUT_EXECUTED}));
+    EXPECT_EQ(m_started_without_batch.load(), 1U);
+
+    EXPECT_EQ(infer(m_ladder_batch_size),
+              std::vector<eExecutionFlavor>(m_ladder_batch_size, eExecutionFlavor::ADAPTIVE_BATCH_EXECUTED));
+    EXPECT_EQ(m_started_ladder.load(), 1U);
+
+    // the full batch is executed right away by the zero-copy path
+    EXPECT_EQ(infer(m_batch_size), std::vector<eExecutionFlavor>(m_batch_size, eExecutionFlavor::BATCH_EXECUTED));
+    EXPECT_EQ(m_started_with_batch.load(), 1U);
+    EXPECT_EQ(m_started_without_batch.load(), 1U);
+    EXPECT_EQ(m_started_ladder.load(), 1U);
+}
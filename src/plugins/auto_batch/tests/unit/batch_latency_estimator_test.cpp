@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "batch_latency_estimator.hpp"
+
+using ov::autobatch_plugin::BatchLatencyEstimator;
+using std::chrono::microseconds;
+
+TEST(BatchLatencyEstimatorTest, NothingObserved) {
+    BatchLatencyEstimator estimator({2, 4, 8});
+    EXPECT_EQ(estimator.batch_sizes(), std::vector<uint32_t>({1, 2, 4, 8}));
+    EXPECT_EQ(estimator.estimate(4).count(), 0);
+    // no observations yet, so every batch fits the budget
+    EXPECT_EQ(estimator.split(7, microseconds(1000)), std::vector<uint32_t>({4, 2, 1}));
+}
+
+TEST(BatchLatencyEstimatorTest, Extrapolation) {
+    BatchLatencyEstimator estimator({2, 4, 8});
+    estimator.update(2, microseconds(200));
+    EXPECT_EQ(estimator.estimate(2).count(), 200);
+    EXPECT_EQ(estimator.estimate(4).count(), 400);
+    // the batch of 1 is not expected to be faster than the closest observed larger batch
+    EXPECT_EQ(estimator.estimate(1).count(), 200);
+    // not supported batch sizes are ignored
+    estimator.update(3, microseconds(1));
+    EXPECT_EQ(estimator.estimate(2).count(), 200);
+}
+
+TEST(BatchLatencyEstimatorTest, MovingAverage) {
+    BatchLatencyEstimator estimator({4}, 0.5);
+    estimator.update(4, microseconds(400));
+    estimator.update(4, microseconds(800));
+    EXPECT_EQ(estimator.estimate(4).count(), 600);
+}
+
+TEST(BatchLatencyEstimatorTest, SplitWithinBudget) {
+    BatchLatencyEstimator estimator({2, 4, 8});
+    estimator.update(1, microseconds(100));
+    estimator.update(2, microseconds(150));
+    estimator.update(4, microseconds(300));
+    estimator.update(8, microseconds(500));
+    EXPECT_EQ(estimator.split(7, microseconds(1000)), std::vector<uint32_t>({4, 2, 1}));
+    // the batch of 4 doesn't fit the budget
+    EXPECT_EQ(estimator.split(7, microseconds(200)), std::vector<uint32_t>({2, 2, 2, 1}));
+    // the target is already missed, the throughput is maximized
+    EXPECT_EQ(estimator.split(7, microseconds(50)), std::vector<uint32_t>({4, 2, 1}));
+    EXPECT_EQ(estimator.split(7, microseconds(-50)), std::vector<uint32_t>({4, 2, 1}));
+}
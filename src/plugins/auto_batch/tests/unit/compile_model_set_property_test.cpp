@@ -102,6 +102,9 @@ TEST_P(CompileModelSetPropertyTest, CompileModelSetPropertyTestCase) {
 
 const std::vector<set_property_param> compile_model_set_property_param_test = {
     set_property_param{{{ov::auto_batch_timeout(static_cast<uint32_t>(100))}}, false},
+    set_property_param{{{ov::auto_batch_target_latency(static_cast<uint32_t>(0))}}, false},
+    // the adaptive batching is not enabled on the compilation
+    set_property_param{{{ov::auto_batch_target_latency(static_cast<uint32_t>(10))}}, true},
     set_property_param{{{"INCORRECT_CONFIG", 2}}, true},
 };
 
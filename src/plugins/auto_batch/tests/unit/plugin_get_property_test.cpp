@@ -58,6 +58,7 @@ TEST_P(GetPropertyTest, GetPropertyTestCase) {
 
 const std::vector<get_property_params> get_property_params_test = {
     get_property_params{ov::auto_batch_timeout.name(), false},
+    get_property_params{ov::auto_batch_target_latency.name(), false},
     get_property_params{ov::device::priorities.name(), true},
     get_property_params{ov::cache_dir.name(), true},
     get_property_params{ov::hint::performance_mode.name(), true},
@@ -40,7 +40,9 @@ ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model
 }
 
 void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::SubmodelInfo>& submodels) {
-    const bool add_exclusive = submodels.size() > 1;
+    // The concurrent stages keep their own executors, so the stages of the consecutive requests run concurrently.
+    // Otherwise the requests of the split model share a single executor per device.
+    const bool add_exclusive = submodels.size() > 1 && !m_cfg.concurrentStages;
     const auto& hetero_plugin = get_hetero_plugin();
     const auto& core = hetero_plugin->get_core();
     const auto& device_properties = m_cfg.get_device_properties();
@@ -255,11 +257,14 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
     } else if (ov::loaded_from_cache == name) {
         return decltype(ov::loaded_from_cache)::value_type{m_loaded_from_cache};
     } else if (ov::optimal_number_of_infer_requests == name) {
+        // every concurrent stage processes its own requests, so the requests of all stages are in flight
+        const bool concurrent = m_cfg.concurrentStages;
         unsigned int value = 0u;
         for (const auto& comp_model_desc : m_compiled_submodels) {
-            value = std::max(value,
-                             comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
-                                 .as<unsigned int>());
+            const auto stage_value =
+                comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
+                    .as<unsigned int>();
+            value = concurrent ? value + stage_value : std::max(value, stage_value);
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (ov::execution_devices == name) {
@@ -381,7 +381,8 @@ ov::Any ov::hetero::Plugin::get_property(const std::string& name, const ov::AnyM
         return decltype(ov::supported_properties)::value_type(std::move(supported_properties));
     } else if (ov::internal::supported_properties == name) {
         return decltype(ov::internal::supported_properties)::value_type{
-            ov::PropertyName{ov::internal::caching_properties.name(), ov::PropertyMutability::RO}};
+            ov::PropertyName{ov::internal::caching_properties.name(), ov::PropertyMutability::RO},
+            ov::PropertyName{ov::hetero::concurrent_stages.name(), ov::PropertyMutability::RW}};
     } else if (ov::device::full_name == name) {
         return decltype(ov::device::full_name)::value_type{get_device_name()};
     } else if (ov::internal::caching_properties == name) {
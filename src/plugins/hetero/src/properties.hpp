@@ -17,5 +17,12 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  * @brief Read-only property showing number of compiled submodels
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
+
+/**
+ * @brief Defines whether the submodels of the split model keep their own executors, so the stages of the consecutive
+ * requests run concurrently, e.g. for the pipeline-parallel model. The optimal number of the infer requests is the sum
+ * over the stages then. By default the requests of the split model share a single executor per device.
+ */
+static constexpr Property<bool, PropertyMutability::RW> concurrent_stages{"HETERO_CONCURRENT_STAGES"};
 }  // namespace hetero
 }  // namespace ov
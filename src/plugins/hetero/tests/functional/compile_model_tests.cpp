@@ -1,11 +1,17 @@
 // Copyright (C) 2018-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <vector>
+
 #include "common_test_utils/test_constants.hpp"
 #include "hetero_tests.hpp"
 #include "openvino/runtime/exec_model_info.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "properties.hpp"
 
 using namespace ov::hetero::tests;
 
@@ -99,6 +105,81 @@ TEST_F(HeteroTests, compile_with_device_properties_no_exclusive) {
     EXPECT_EQ(6, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
 }
 
+TEST_F(HeteroTests, compile_pipeline_parallel_keeps_exclusive_requests) {
+    const std::set<ov::hint::ModelDistributionPolicy> pipeline_parallel = {
+        ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL};
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"),
+                         ov::hint::model_distribution_policy(pipeline_parallel),
+                         ov::device::properties("MOCK0", ov::num_streams(4)),
+                         ov::device::properties("MOCK1", ov::num_streams(6))};
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    EXPECT_FALSE(compiled_model.get_property(ov::hetero::concurrent_stages));
+    auto device_properties = compiled_model.get_property(ov::device::properties.name()).as<ov::AnyMap>();
+    ASSERT_TRUE(device_properties.count("MOCK0.0"));
+    auto mock0_properties = device_properties.at("MOCK0.0").as<ov::AnyMap>();
+    EXPECT_EQ(1, mock0_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
+    ASSERT_TRUE(device_properties.count("MOCK1.0"));
+    auto mock1_properties = device_properties.at("MOCK1.0").as<ov::AnyMap>();
+    EXPECT_EQ(6, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
+    EXPECT_EQ(6u, compiled_model.get_property(ov::optimal_number_of_infer_requests));
+}
+
+TEST_F(HeteroTests, compile_concurrent_stages_keeps_device_streams) {
+    const std::set<ov::hint::ModelDistributionPolicy> pipeline_parallel = {
+        ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL};
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"),
+                         ov::hint::model_distribution_policy(pipeline_parallel),
+                         ov::hetero::concurrent_stages(true),
+                         ov::device::properties("MOCK0", ov::num_streams(4)),
+                         ov::device::properties("MOCK1", ov::num_streams(6))};
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    auto device_properties = compiled_model.get_property(ov::device::properties.name()).as<ov::AnyMap>();
+    ASSERT_TRUE(device_properties.count("MOCK0.0"));
+    auto mock0_properties = device_properties.at("MOCK0.0").as<ov::AnyMap>();
+    EXPECT_EQ(4, mock0_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
+    ASSERT_TRUE(device_properties.count("MOCK1.0"));
+    auto mock1_properties = device_properties.at("MOCK1.0").as<ov::AnyMap>();
+    EXPECT_EQ(6, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
+    // the requests of both stages are in flight
+    EXPECT_EQ(10u, compiled_model.get_property(ov::optimal_number_of_infer_requests));
+}
+
+TEST_F(HeteroTests, infer_concurrent_stages_concurrent_requests) {
+    const std::set<ov::hint::ModelDistributionPolicy> pipeline_parallel = {
+        ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL};
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"),
+                         ov::hint::model_distribution_policy(pipeline_parallel),
+                         ov::hetero::concurrent_stages(true)};
+    auto model = create_model_with_subtract();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    const auto num_requests = compiled_model.get_property(ov::optimal_number_of_infer_requests) * 2;
+
+    std::vector<ov::InferRequest> requests;
+    std::vector<ov::Tensor> inputs;
+    for (unsigned int i = 0; i < num_requests; i++) {
+        auto input =
+            create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape());
+        auto data = input.data<int64_t>();
+        std::for_each(data, data + input.get_size(), [i](int64_t& value) {
+            value += i;
+        });
+        requests.push_back(compiled_model.create_infer_request());
+        requests.back().set_input_tensor(input);
+        inputs.push_back(input);
+    }
+    for (auto& request : requests) {
+        request.start_async();
+    }
+    for (unsigned int i = 0; i < num_requests; i++) {
+        requests[i].wait();
+        auto output = requests[i].get_output_tensor();
+        ASSERT_EQ(inputs[i].get_byte_size(), output.get_byte_size());
+        EXPECT_EQ(memcmp(inputs[i].data(), output.data(), output.get_byte_size()), 0);
+    }
+}
+
 TEST_F(HeteroTests, get_runtime_model) {
     ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1")};
     auto model = create_model_with_subtract_reshape();
@@ -274,6 +274,8 @@ public:
             return m_config.count(ov::num_streams.name()) ? m_config.at(ov::num_streams.name()) : ov::streams::Num(1);
         } else if (name == ov::enable_profiling) {
             return m_config.count(ov::enable_profiling.name()) ? m_config.at(ov::enable_profiling.name()) : false;
+        } else if (name == ov::optimal_number_of_infer_requests) {
+            return static_cast<unsigned int>(get_property(ov::num_streams.name()).as<ov::streams::Num>().num);
         } else {
             OPENVINO_THROW("get property: " + name);
         }
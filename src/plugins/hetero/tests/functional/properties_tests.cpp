@@ -26,7 +26,8 @@ TEST_F(HeteroTests, get_property_supported_properties) {
 }
 
 TEST_F(HeteroTests, get_property_internal_supported_properties) {
-    const std::vector<ov::PropertyName> supported_properties = {ov::internal::caching_properties};
+    const std::vector<ov::PropertyName> supported_properties = {ov::internal::caching_properties,
+                                                                ov::hetero::concurrent_stages};
     auto actual_supported_properties =
         core.get_property(ov::test::utils::DEVICE_HETERO, ov::internal::supported_properties);
     EXPECT_EQ(supported_properties.size(), actual_supported_properties.size());
@@ -65,6 +66,13 @@ TEST_F(HeteroTests, set_property_ModelDistributionPolicy) {
     ASSERT_NO_THROW(value = core.get_property(ov::test::utils::DEVICE_HETERO, ov::hint::model_distribution_policy));
     ASSERT_EQ(model_policy, value);
 }
+
+TEST_F(HeteroTests, set_property_concurrent_stages) {
+    EXPECT_FALSE(core.get_property(ov::test::utils::DEVICE_HETERO, ov::hetero::concurrent_stages));
+    core.set_property(ov::test::utils::DEVICE_HETERO, ov::hetero::concurrent_stages(true));
+    EXPECT_TRUE(core.get_property(ov::test::utils::DEVICE_HETERO, ov::hetero::concurrent_stages));
+}
+
 }  // namespace tests
 }  // namespace hetero
 }  // namespace ov
\ No newline at end of file
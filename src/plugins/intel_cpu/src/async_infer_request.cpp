@@ -4,6 +4,7 @@
 
 #include "async_infer_request.h"
 
+#include <chrono>
 #include <memory>
 #include <vector>
 
@@ -51,5 +52,11 @@ void ov::intel_cpu::AsyncInferRequest::setSubInferRequest(
 }
 
 void ov::intel_cpu::AsyncInferRequest::infer() {
+    m_submitted = std::chrono::steady_clock::now();
     m_infer_func();
 }
+
+void ov::intel_cpu::AsyncInferRequest::start_async() {
+    m_submitted = std::chrono::steady_clock::now();
+    ov::IAsyncInferRequest::start_async();
+}
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -26,6 +27,8 @@ public:
 
     void infer() override;
 
+    void start_async() override;
+
     void setSubInferRequest(const std::vector<std::shared_ptr<IAsyncInferRequest>>& requests);
 
     std::vector<std::shared_ptr<ov::IAsyncInferRequest>> getSubInferRequest() const {
@@ -43,6 +46,8 @@ public:
     std::shared_ptr<IInferRequest> m_internal_request;
     std::shared_ptr<ov::threading::IStreamsExecutor> m_stream_executor;
     std::function<void()> m_infer_func;
+    // time of the last submission, to account the queueing delay
+    std::chrono::steady_clock::time_point m_submitted;
 };
 
 }  // namespace ov::intel_cpu
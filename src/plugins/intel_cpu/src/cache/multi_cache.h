@@ -9,15 +9,21 @@
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "cache_entry.h"
+#include "openvino/util/common_util.hpp"
+#include "shared_cache.h"
 
 namespace ov::intel_cpu {
 
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention This implementation IS NOT THREAD SAFE! Unless it is constructed over a SharedCache, in which case the
+ * requests for the value types allowed by SharedBetweenStreams are forwarded to the thread safe shared storage, while
+ * the other values are kept in the own (per stream) storage.
  */
 
 class MultiCache {
@@ -34,6 +40,12 @@ public:
      */
     explicit MultiCache(size_t capacity) : _capacity(capacity) {}
 
+    /**
+     * @param capacity the records limit for each entry of the own storage, see above
+     * @param shared the thread safe storage shared with other MultiCache instances (i.e. between the streams)
+     */
+    MultiCache(size_t capacity, SharedCachePtr shared) : _capacity(capacity), _shared(std::move(shared)) {}
+
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
      * nothing was found) using the key and the builder functor and adds the new record to the cache
@@ -47,10 +59,29 @@ public:
               typename BuilderType,
               typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
     typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
+        if (_lookUps) {
+            _lookUps->push_back(
+                ov::util::hash_combine({getTypeId<EntryTypeT<KeyType, ValueType>>(), static_cast<size_t>(key.hash())}));
+        }
+        if constexpr (SharedBetweenStreams<ValueType>::value) {
+            if (_shared) {
+                return _shared->getOrCreate<KeyType, BuilderType, ValueType>(key, std::move(builder));
+            }
+        }
         auto entry = getEntry<KeyType, ValueType>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+     * @brief Starts recording the identifiers of the looked up records into \p lookUps (nullptr stops it). The callers
+     * which looked up the same identifier may get the same value object, so they must not use it concurrently if the
+     * value is not stateless
+     * @return the previous recording target, so the nested recordings (i.e. inner graphs) can restore it
+     */
+    std::vector<size_t>* recordLookUps(std::vector<size_t>* lookUps) {
+        return std::exchange(_lookUps, lookUps);
+    }
+
 private:
     template <typename T>
     size_t getTypeId();
@@ -60,6 +91,8 @@ private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
     std::unordered_map<size_t, EntryBasePtr> _storage;
+    SharedCachePtr _shared;
+    std::vector<size_t>* _lookUps = nullptr;
 };
 
 template <typename T>
@@ -0,0 +1,270 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "cache_entry.h"
+#include "openvino/util/common_util.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Defines whether the values of the type may be stored in the SharedCache and used by several streams at once.
+ * Only the values which are not modified during the execution (i.e. don't keep scratch buffers inside and take the
+ * scratchpad from the stream context) are allowed, so the trait is false by default and the stateless value types
+ * opt in by specializing it. The other values are cached per stream.
+ */
+template <typename T>
+struct SharedBetweenStreams : std::false_type {};
+
+/**
+ * @brief Approximate memory footprint of a cache record used for the byte based capacity accounting.
+ * The default implementation accounts the object itself, the values stored by shared pointers are accounted by the
+ * pointed object. The value types which own dynamically allocated memory (i.e. the primitive descriptors of oneDNN)
+ * specialize the trait to account it as well.
+ */
+template <typename T>
+struct CacheFootprint {
+    static size_t get([[maybe_unused]] const T& value) {
+        return sizeof(T);
+    }
+};
+
+template <typename T>
+struct CacheFootprint<std::shared_ptr<T>> {
+    static size_t get(const std::shared_ptr<T>& value) {
+        if constexpr (std::is_void_v<T> || std::is_abstract_v<T>) {
+            return sizeof(value);
+        } else {
+            return sizeof(value) + (value ? CacheFootprint<T>::get(*value) : 0);
+        }
+    }
+};
+
+/**
+ * @brief Thread safe preemptive cache for different key/value pair types with LRU eviction policy and the capacity
+ * defined in bytes. The cache is supposed to be shared between the streams of a compiled model.
+ *
+ * The records are distributed between a number of independently locked shards, so the concurrent lookups of
+ * different keys rarely contend. Concurrent misses of the same key are coalesced: the value is built only once, while
+ * the other callers wait for the result and get it as a cache hit.
+ *
+ * @note As the values are shared between the streams, they must not be modified during the execution, see
+ * SharedBetweenStreams.
+ * Default constructed value objects are treated as empty objects and are never stored.
+ */
+class SharedCache {
+public:
+    using LookUpStatus = CacheEntryBase::LookUpStatus;
+
+    struct Statistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        size_t bytes = 0;
+        size_t records = 0;
+    };
+
+    static constexpr size_t default_shards_number = 16;
+
+    /**
+     * @param byteCapacity the max total footprint of the records in bytes, zero means that nothing is stored
+     * @param shardsNumber number of independently locked shards, the capacity is evenly distributed between them
+     */
+    explicit SharedCache(size_t byteCapacity, size_t shardsNumber = default_shards_number)
+        : m_capacity(byteCapacity),
+          m_shardsNumber(std::max<size_t>(shardsNumber, 1)),
+          m_shardCapacity(byteCapacity / m_shardsNumber),
+          m_shards(new Shard[m_shardsNumber]) {}
+
+    SharedCache(const SharedCache&) = delete;
+    SharedCache& operator=(const SharedCache&) = delete;
+
+    /**
+     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
+     * nothing was found) using the key and the builder functor and adds the new record to the cache
+     * @param key is the search key
+     * @param builder is a callable object that creates the ValType object from the KeyType lval reference
+     * @return result of the operation which is a pair of the requested object of ValType and the status of whether the
+     * cache hit or miss occurred
+     */
+    template <typename KeyType,
+              typename BuilderType,
+              typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
+    std::pair<ValueType, LookUpStatus> getOrCreate(const KeyType& key, BuilderType builder) {
+        if (0 == m_capacity) {
+            m_misses.fetch_add(1, std::memory_order_relaxed);
+            return {builder(key), LookUpStatus::Miss};
+        }
+
+        using RecordType = Record<KeyType, ValueType>;
+        const size_t typeId = getTypeId<RecordType>();
+        const size_t hash = ov::util::hash_combine({typeId, static_cast<size_t>(key.hash())});
+        auto& shard = m_shards[hash % m_shardsNumber];
+
+        std::promise<ValueType> promise;
+        std::shared_future<ValueType> cached;
+        RecordIterator itr;
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto range = shard.index.equal_range(hash);
+            for (auto it = range.first; it != range.second; ++it) {
+                const auto& record = *it->second;
+                if (record->typeId == typeId && static_cast<const RecordType&>(*record).key == key) {
+                    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+                    cached = static_cast<const RecordType&>(*record).value;
+                    break;
+                }
+            }
+            if (!cached.valid()) {
+                shard.lru.emplace_front(std::make_unique<RecordType>(typeId, hash, key, promise.get_future().share()));
+                itr = shard.lru.begin();
+                shard.index.emplace(hash, itr);
+            }
+        }
+
+        if (cached.valid()) {
+            m_hits.fetch_add(1, std::memory_order_relaxed);
+            // the value may be still in flight, so it is waited for outside of the lock
+            return {cached.get(), LookUpStatus::Hit};
+        }
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+
+        ValueType value;
+        try {
+            value = builder(key);
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            erase(shard, itr);
+            throw;
+        }
+        promise.set_value(value);
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (value == ValueType()) {
+            erase(shard, itr);
+        } else {
+            auto& record = **itr;
+            record.ready = true;
+            record.bytes = sizeof(RecordType) + CacheFootprint<KeyType>::get(key) + CacheFootprint<ValueType>::get(value);
+            shard.bytes += record.bytes;
+            evict(shard);
+        }
+        return {value, LookUpStatus::Miss};
+    }
+
+    [[nodiscard]] Statistics getStatistics() const {
+        Statistics stats;
+        stats.hits = m_hits.load(std::memory_order_relaxed);
+        stats.misses = m_misses.load(std::memory_order_relaxed);
+        stats.evictions = m_evictions.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < m_shardsNumber; i++) {
+            std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+            stats.bytes += m_shards[i].bytes;
+            stats.records += m_shards[i].lru.size();
+        }
+        return stats;
+    }
+
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return m_capacity;
+    }
+
+private:
+    struct RecordBase {
+        RecordBase(size_t typeId, size_t hash) : typeId(typeId), hash(hash) {}
+        virtual ~RecordBase() = default;
+
+        size_t typeId;
+        size_t hash;
+        size_t bytes = 0;
+        // the value is built and accounted, records in flight are never evicted
+        bool ready = false;
+    };
+
+    template <typename KeyType, typename ValueType>
+    struct Record : public RecordBase {
+        Record(size_t typeId, size_t hash, KeyType key, std::shared_future<ValueType> value)
+            : RecordBase(typeId, hash),
+              key(std::move(key)),
+              value(std::move(value)) {}
+
+        KeyType key;
+        std::shared_future<ValueType> value;
+    };
+
+    using RecordList = std::list<std::unique_ptr<RecordBase>>;
+    using RecordIterator = RecordList::iterator;
+
+    struct Shard {
+        mutable std::mutex mutex;
+        RecordList lru;
+        std::unordered_multimap<size_t, RecordIterator> index;
+        size_t bytes = 0;
+    };
+
+    static void eraseFromIndex(Shard& shard, const RecordIterator& itr) {
+        auto range = shard.index.equal_range((*itr)->hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == itr) {
+                shard.index.erase(it);
+                return;
+            }
+        }
+    }
+
+    static void erase(Shard& shard, const RecordIterator& itr) {
+        eraseFromIndex(shard, itr);
+        shard.bytes -= (*itr)->bytes;
+        shard.lru.erase(itr);
+    }
+
+    void evict(Shard& shard) {
+        auto itr = shard.lru.end();
+        while (shard.bytes > m_shardCapacity && itr != shard.lru.begin()) {
+            --itr;
+            if (!(*itr)->ready) {
+                continue;
+            }
+            auto victim = itr++;
+            erase(shard, victim);
+            m_evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename T>
+    static size_t getTypeId() {
+        static const size_t id = m_typeIdCounter.fetch_add(1);
+        return id;
+    }
+
+    inline static std::atomic_size_t m_typeIdCounter{0};
+
+    const size_t m_capacity;
+    const size_t m_shardsNumber;
+    const size_t m_shardCapacity;
+    std::unique_ptr<Shard[]> m_shards;
+
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+    std::atomic<uint64_t> m_evictions{0};
+};
+
+using SharedCachePtr = std::shared_ptr<SharedCache>;
+
+}  // namespace ov::intel_cpu
@@ -9,34 +9,47 @@
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <oneapi/dnnl/dnnl.hpp>
 #include <ostream>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/shared_cache.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "graph.h"
 #include "graph_context.h"
+#include "host_scheduler.hpp"
 #include "infer_request.h"
 #include "internal_properties.hpp"
+#include "itt.h"
+#include "kernel_warmup_cache.hpp"
 #include "low_precision/low_precision.hpp"
+#include "nodes/executors/executor_autotuner.hpp"
+#include "nodes/input.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type/element_type.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/iplugin.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "shape_buckets.hpp"
 #include "sub_memory_manager.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
+#include "utils/graph_serializer/packed_weights.hpp"
 #include "utils/graph_serializer/serializer.hpp"
 #include "utils/memory_stats_dump.hpp"
 
@@ -59,6 +72,10 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
     std::mutex _mutex;
 };
 
+static std::string packedWeightsIsa() {
+    return std::to_string(static_cast<size_t>(dnnl::get_effective_cpu_isa()));
+}
+
 CompiledModel::~CompiledModel() {
     if (m_has_sub_compiled_models) {
         m_sub_compiled_models.clear();
@@ -75,7 +92,9 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              Config cfg,
                              const bool loaded_from_cache,
-                             std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                             std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                             const PackedWeights::CPtr& packed_weights,
+                             ExecutorAutotuner::Decisions executor_decisions)
     : ov::ICompiledModel::ICompiledModel(model, plugin),
       m_model(model),
       m_plugin(plugin),
@@ -84,6 +103,29 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_loaded_from_cache(loaded_from_cache),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
+    if (m_cfg.rtCacheShared && m_cfg.rtCacheCapacity > 0) {
+        m_sharedParamsCache = std::make_shared<SharedCache>(m_cfg.rtCacheByteCapacity);
+    }
+    if (m_cfg.intermediateMemoryArena) {
+        m_memoryArena = std::make_shared<IntermediateMemoryArena>();
+    }
+    // the imported decisions are followed even if the tuning is disabled
+    if (m_cfg.executorAutotune || !executor_decisions.empty()) {
+        m_executorAutotuner =
+            std::make_shared<ExecutorAutotuner>(m_cfg.executorAutotune, std::move(executor_decisions));
+    }
+    // the layouts chosen by the executors depend on the ISA, so the weights packed on another machine are repacked
+    if (packed_weights && packed_weights->isa == packedWeightsIsa()) {
+        m_socketWeights.setImportedPackedWeights(packed_weights);
+    }
+    // sub compiled models share the input shapes with the main one
+    if (m_cfg.numSubStreams == 0 && !m_sub_memory_manager) {
+        m_kernelWarmupCache = KernelWarmupCache::create(m_cfg.kernelCacheDir, m_model, m_cfg);
+    }
+    if (!m_sub_memory_manager) {
+        m_schedulerRegistration =
+            std::make_unique<HostScheduler::Registration>(*HostScheduler::instance(), m_cfg.modelPriority);
+    }
     const auto& core = m_plugin->get_core();
     OPENVINO_ASSERT(core, "Unable to get API version. Core is unavailable");
 
@@ -205,7 +247,10 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                                                          isQuantizedFlag,
                                                          streamsExecutor,
                                                          cpuParallel,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         m_sharedParamsCache,
+                                                         m_memoryArena,
+                                                         m_executorAutotuner);
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
@@ -251,6 +296,76 @@ std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() co
     return async_infer_request;
 }
 
+void CompiledModel::warm_up_kernels() const {
+    if (!m_kernelWarmupCache) {
+        return;
+    }
+    OV_ITT_SCOPED_TASK(itt::domains::ov_intel_cpu, "CompiledModel::warm_up_kernels");
+
+    const auto records = m_kernelWarmupCache->getRecords(KernelWarmupCache::max_warm_up_records);
+    const auto& modelInputs = inputs();
+    std::mutex mutex;
+    std::vector<bool> replayed(records.size(), false);
+    std::vector<bool> warmedGraphs(m_graphs.size(), false);
+
+    auto warmUp = [&] {
+        size_t graph_idx = 0;
+        if (m_graphs.size() > 1) {
+            auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+            if (nullptr != streamsExecutor) {
+                graph_idx = streamsExecutor->get_stream_id() % m_graphs.size();
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (warmedGraphs[graph_idx]) {
+                return;
+            }
+            warmedGraphs[graph_idx] = true;
+        }
+        auto request = std::static_pointer_cast<SyncInferRequest>(create_sync_infer_request());
+        for (size_t r = 0; r < records.size(); r++) {
+            const auto& shapes = records[r];
+            if (shapes.size() != modelInputs.size()) {
+                continue;
+            }
+            try {
+                for (size_t i = 0; i < shapes.size(); i++) {
+                    auto tensor = ov::make_tensor(modelInputs[i].get_element_type(), ov::Shape(shapes[i]));
+                    // only the shape subgraphs are executed, but prepareParams() of some nodes reads the input data
+                    if (tensor->get_element_type() != ov::element::string) {
+                        std::memset(tensor->data(), 0, tensor->get_byte_size());
+                    }
+                    request->set_tensor(modelInputs[i], tensor);
+                }
+                const bool prepared = request->prepare_kernels();
+                std::lock_guard<std::mutex> lock(mutex);
+                replayed[r] = replayed[r] || prepared;
+            } catch (const std::exception& e) {
+                DEBUG_LOG("Kernel warm-up failed for the cached shapes #", r, ": ", e.what());
+            }
+        }
+    };
+
+    if (!records.empty()) {
+        if (m_graphs.size() > 1) {
+            // run_and_wait doesn't guarantee that each stream takes a task, so it's repeated for the streams left,
+            // the streams which are still cold after max_warm_up_rounds generate the kernels on the first inference
+            constexpr size_t max_warm_up_rounds = 4;
+            std::vector<Task> tasks(m_graphs.size(), warmUp);
+            for (size_t round = 0; round < max_warm_up_rounds &&
+                                   std::find(warmedGraphs.begin(), warmedGraphs.end(), false) != warmedGraphs.end();
+                 round++) {
+                m_task_executor->run_and_wait(tasks);
+            }
+        } else {
+            warmUp();
+        }
+    }
+
+    m_kernelWarmupCache->completeWarmUp(static_cast<size_t>(std::count(replayed.begin(), replayed.end(), true)));
+}
+
 std::shared_ptr<const ov::Model> CompiledModel::get_runtime_model() const {
     OPENVINO_ASSERT(!m_graphs.empty(), "No graph was found");
 
@@ -296,6 +411,7 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::hint::scheduling_core_type.name()),
             RO_property(ov::hint::model_distribution_policy.name()),
             RO_property(ov::hint::enable_hyper_threading.name()),
+            RO_property(ov::hint::model_priority.name()),
             RO_property(ov::execution_devices.name()),
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::log::level.name()),
@@ -307,7 +423,36 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::key_cache_precision.name()),
             RO_property(ov::value_cache_precision.name()),
             RO_property(ov::key_cache_group_size.name()),
-            RO_property(ov::value_cache_group_size.name())};
+            RO_property(ov::value_cache_group_size.name()),
+            RO_property(ov::intel_cpu::cpu_memory_plan_actual_size.name()),
+            RO_property(ov::intel_cpu::cpu_memory_plan_optimal_size.name()),
+            RO_property(ov::intel_cpu::cpu_memory_plan_current_size.name()),
+            RO_property(ov::intel_cpu::cpu_weights_shared_bytes.name()),
+            RO_property(ov::intel_cpu::cpu_weights_copied_bytes.name())};
+
+        if (m_sharedParamsCache) {
+            ro_properties.emplace_back(RO_property(ov::intel_cpu::cpu_runtime_cache_hits.name()));
+            ro_properties.emplace_back(RO_property(ov::intel_cpu::cpu_runtime_cache_misses.name()));
+            ro_properties.emplace_back(RO_property(ov::intel_cpu::cpu_runtime_cache_evictions.name()));
+            ro_properties.emplace_back(RO_property(ov::intel_cpu::cpu_runtime_cache_bytes.name()));
+            ro_properties.emplace_back(RO_property(ov::intel_cpu::cpu_runtime_cache_records.name()));
+        }
+
+        if (m_memoryArena) {
+            ro_properties.emplace_back(RO_property(ov::intel_cpu::cpu_intermediate_memory_arena_bytes.name()));
+        }
+
+        if (m_cfg.shapeBuckets > 0) {
+            ro_properties.emplace_back(RO_property(ov::intel_cpu::cpu_shape_bucket_hits.name()));
+            ro_properties.emplace_back(RO_property(ov::intel_cpu::cpu_shape_bucket_misses.name()));
+            ro_properties.emplace_back(RO_property(ov::intel_cpu::cpu_shape_bucket_evictions.name()));
+        }
+
+        if (m_kernelWarmupCache) {
+            ro_properties.emplace_back(RO_property(ov::intel_cpu::cpu_kernel_cache_hits.name()));
+            ro_properties.emplace_back(RO_property(ov::intel_cpu::cpu_kernel_cache_misses.name()));
+            ro_properties.emplace_back(RO_property(ov::intel_cpu::cpu_kernel_cache_warmed_shapes.name()));
+        }
 
         return ro_properties;
     }
@@ -363,6 +508,9 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         const bool use_ht = config.enableHyperThreading;
         return static_cast<decltype(ov::hint::enable_hyper_threading)::value_type>(use_ht);
     }
+    if (name == ov::hint::model_priority) {
+        return config.modelPriority;
+    }
     if (name == ov::hint::execution_mode) {
         return config.executionMode;
     }
@@ -406,6 +554,105 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     if (name == ov::value_cache_group_size) {
         return static_cast<decltype(ov::value_cache_group_size)::value_type>(config.valueCacheGroupSize);
     }
+    if (any_of(name,
+               ov::intel_cpu::cpu_memory_plan_actual_size.name(),
+               ov::intel_cpu::cpu_memory_plan_optimal_size.name(),
+               ov::intel_cpu::cpu_memory_plan_current_size.name())) {
+        const auto stats = graph.getGraphContext()->getAuxiliaryNetworkMemoryControl()->getPlanStatistics();
+        if (name == ov::intel_cpu::cpu_memory_plan_actual_size) {
+            return static_cast<decltype(ov::intel_cpu::cpu_memory_plan_actual_size)::value_type>(stats.actual_size);
+        }
+        if (name == ov::intel_cpu::cpu_memory_plan_optimal_size) {
+            return static_cast<decltype(ov::intel_cpu::cpu_memory_plan_optimal_size)::value_type>(stats.optimal_size);
+        }
+        return static_cast<decltype(ov::intel_cpu::cpu_memory_plan_current_size)::value_type>(stats.current_size);
+    }
+    if (m_sharedParamsCache && any_of(name,
+                                      ov::intel_cpu::cpu_runtime_cache_hits.name(),
+                                      ov::intel_cpu::cpu_runtime_cache_misses.name(),
+                                      ov::intel_cpu::cpu_runtime_cache_evictions.name(),
+                                      ov::intel_cpu::cpu_runtime_cache_bytes.name(),
+                                      ov::intel_cpu::cpu_runtime_cache_records.name())) {
+        const auto stats = m_sharedParamsCache->getStatistics();
+        if (name == ov::intel_cpu::cpu_runtime_cache_hits) {
+            return static_cast<decltype(ov::intel_cpu::cpu_runtime_cache_hits)::value_type>(stats.hits);
+        }
+        if (name == ov::intel_cpu::cpu_runtime_cache_misses) {
+            return static_cast<decltype(ov::intel_cpu::cpu_runtime_cache_misses)::value_type>(stats.misses);
+        }
+        if (name == ov::intel_cpu::cpu_runtime_cache_evictions) {
+            return static_cast<decltype(ov::intel_cpu::cpu_runtime_cache_evictions)::value_type>(stats.evictions);
+        }
+        if (name == ov::intel_cpu::cpu_runtime_cache_bytes) {
+            return static_cast<decltype(ov::intel_cpu::cpu_runtime_cache_bytes)::value_type>(stats.bytes);
+        }
+        return static_cast<decltype(ov::intel_cpu::cpu_runtime_cache_records)::value_type>(stats.records);
+    }
+    if (any_of(name, ov::intel_cpu::cpu_weights_shared_bytes.name(), ov::intel_cpu::cpu_weights_copied_bytes.name())) {
+        uint64_t sharedBytes = 0;
+        uint64_t copiedBytes = 0;
+        // the weights cache keeps the cloned and the repacked weights, the repacked weights imported from the blob
+        // are views of its buffer
+        for (const auto& [socketId, statistics] : m_socketWeights.dumpStatistics()) {
+            sharedBytes += statistics.external_size;
+            copiedBytes += statistics.total_size - statistics.external_size;
+        }
+        const bool hasWeightsCache = graph.getGraphContext()->getWeightsCache() != nullptr;
+        for (const auto& node : graph.GetNodes()) {
+            const auto input = std::dynamic_pointer_cast<node::Input>(node);
+            if (!input || !input->isConstant()) {
+                continue;
+            }
+            if (input->isConstantDataShared()) {
+                sharedBytes += input->getMemoryPtr()->getSize();
+            } else if (!hasWeightsCache) {
+                copiedBytes += input->getMemoryPtr()->getSize();
+            }
+        }
+        if (name == ov::intel_cpu::cpu_weights_shared_bytes) {
+            return static_cast<decltype(ov::intel_cpu::cpu_weights_shared_bytes)::value_type>(sharedBytes);
+        }
+        return static_cast<decltype(ov::intel_cpu::cpu_weights_copied_bytes)::value_type>(copiedBytes);
+    }
+    if (m_memoryArena && name == ov::intel_cpu::cpu_intermediate_memory_arena_bytes) {
+        return static_cast<decltype(ov::intel_cpu::cpu_intermediate_memory_arena_bytes)::value_type>(
+            m_memoryArena->allocatedBytes());
+    }
+    if (m_kernelWarmupCache && any_of(name,
+                                      ov::intel_cpu::cpu_kernel_cache_hits.name(),
+                                      ov::intel_cpu::cpu_kernel_cache_misses.name(),
+                                      ov::intel_cpu::cpu_kernel_cache_warmed_shapes.name())) {
+        const auto stats = m_kernelWarmupCache->getStatistics();
+        if (name == ov::intel_cpu::cpu_kernel_cache_hits) {
+            return static_cast<decltype(ov::intel_cpu::cpu_kernel_cache_hits)::value_type>(stats.hits);
+        }
+        if (name == ov::intel_cpu::cpu_kernel_cache_misses) {
+            return static_cast<decltype(ov::intel_cpu::cpu_kernel_cache_misses)::value_type>(stats.misses);
+        }
+        return static_cast<decltype(ov::intel_cpu::cpu_kernel_cache_warmed_shapes)::value_type>(stats.warmedShapes);
+    }
+    if (m_cfg.shapeBuckets > 0 && any_of(name,
+                                         ov::intel_cpu::cpu_shape_bucket_hits.name(),
+                                         ov::intel_cpu::cpu_shape_bucket_misses.name(),
+                                         ov::intel_cpu::cpu_shape_bucket_evictions.name())) {
+        // the statistics of the streams are summed, the graphs which are not created yet have no buckets
+        ShapeBuckets::Statistics total;
+        for (const auto& streamGraph : m_graphs) {
+            if (const auto* shapeBuckets = streamGraph.getShapeBuckets()) {
+                const auto stats = shapeBuckets->getStatistics();
+                total.hits += stats.hits;
+                total.misses += stats.misses;
+                total.evictions += stats.evictions;
+            }
+        }
+        if (name == ov::intel_cpu::cpu_shape_bucket_hits) {
+            return static_cast<decltype(ov::intel_cpu::cpu_shape_bucket_hits)::value_type>(total.hits);
+        }
+        if (name == ov::intel_cpu::cpu_shape_bucket_misses) {
+            return static_cast<decltype(ov::intel_cpu::cpu_shape_bucket_misses)::value_type>(total.misses);
+        }
+        return static_cast<decltype(ov::intel_cpu::cpu_shape_bucket_evictions)::value_type>(total.evictions);
+    }
     if (name == ov::weights_path) {
         return static_cast<decltype(ov::weights_path)::value_type>("");
     }
@@ -413,7 +660,20 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
 }
 
 void CompiledModel::export_model(std::ostream& modelStream) const {
-    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE);
+    const bool weightless = m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE;
+    PackedWeights::Ptr packedWeights;
+    // the size optimized blob doesn't store the weights, so the packed ones aren't stored as well.
+    // The weights are packed when the executors are created, i.e. on the first inference in case of dynamic shapes,
+    // so nothing is collected if the model is exported before it
+    if (!weightless) {
+        packedWeights = m_socketWeights.collectPackedWeights();
+        packedWeights->isa = packedWeightsIsa();
+    }
+    ModelSerializer serializer(modelStream,
+                               m_cfg.cacheEncrypt,
+                               weightless,
+                               packedWeights,
+                               m_executorAutotuner ? m_executorAutotuner->decisions() : ExecutorAutotuner::Decisions{});
     serializer << m_model;
 }
 
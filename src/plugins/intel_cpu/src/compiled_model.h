@@ -13,8 +13,13 @@
 #include <utility>
 #include <vector>
 
+#include "cache/shared_cache.h"
 #include "config.h"
 #include "graph.h"
+#include "host_scheduler.hpp"
+#include "kernel_warmup_cache.hpp"
+#include "memory_arena.hpp"
+#include "nodes/executors/executor_autotuner.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -24,6 +29,7 @@
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 #include "sub_memory_manager.hpp"
+#include "utils/graph_serializer/packed_weights.hpp"
 #include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
@@ -44,7 +50,9 @@ public:
                   const std::shared_ptr<const ov::IPlugin>& plugin,
                   Config cfg,
                   bool loaded_from_cache,
-                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                  const PackedWeights::CPtr& packed_weights = nullptr,
+                  ExecutorAutotuner::Decisions executor_decisions = {});
 
     ~CompiledModel() override;
 
@@ -63,6 +71,12 @@ public:
 
     void release_memory() override;
 
+    /**
+     * @brief Replays the input shapes recorded by the persistent kernel cache in each stream, so the kernels are
+     * generated before the first inference. Does nothing if the cache is disabled or empty.
+     */
+    void warm_up_kernels() const;
+
     std::string name() const {
         return m_name;
     }
@@ -87,6 +101,17 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // runtime parameters cache shared between the streams, only if cpu_runtime_cache_shared is enabled
+    SharedCachePtr m_sharedParamsCache = nullptr;
+    // intermediate memory shared between the streams, only if cpu_intermediate_memory_arena is enabled
+    IntermediateMemoryArena::Ptr m_memoryArena = nullptr;
+    // executor implementations chosen by timing, only if cpu_executor_autotune is enabled or the model is imported
+    // with the decisions
+    ExecutorAutotuner::Ptr m_executorAutotuner = nullptr;
+    // persistent cache of the input shapes, only if cpu_kernel_cache_dir is set
+    KernelWarmupCache::Ptr m_kernelWarmupCache = nullptr;
+    // priority of the model in the host scheduler, the sub compiled models run under the tickets of the main one
+    std::unique_ptr<HostScheduler::Registration> m_schedulerRegistration = nullptr;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -152,6 +177,15 @@ public:
         return m_id;
     }
 
+    [[nodiscard]] const KernelWarmupCache::Ptr& kernelWarmupCache() const {
+        return m_compiled_model->m_kernelWarmupCache;
+    }
+
+    // the sub compiled models of the tensor parallel inference
+    [[nodiscard]] bool isSubModel() const {
+        return m_compiled_model->m_sub_memory_manager && !m_compiled_model->m_has_sub_compiled_models;
+    }
+
 private:
     std::shared_ptr<const CompiledModel> m_compiled_model;
     const Graph* m_graph;
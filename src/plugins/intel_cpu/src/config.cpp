@@ -168,6 +168,16 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             } catch (ov::Exception&) {
                 error_info();
             }
+        } else if (key == ov::hint::model_priority.name()) {
+            try {
+                modelPriority = val.as<ov::hint::Priority>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               "for property key ",
+                               ov::hint::model_priority.name(),
+                               ". Expected only ov::hint::Priority::LOW/MEDIUM/HIGH");
+            }
         } else if (key == ov::hint::enable_hyper_threading.name()) {
             try {
                 enableHyperThreading = val.as<bool>();
@@ -285,6 +295,94 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_runtime_cache_shared.name() == key) {
+            try {
+                rtCacheShared = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_shared.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_runtime_cache_byte_capacity.name() == key) {
+            try {
+                rtCacheByteCapacity = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_byte_capacity.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (ov::intel_cpu::cpu_kernel_cache_dir.name() == key) {
+            try {
+                kernelCacheDir = val.as<std::string>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::cpu_kernel_cache_dir.name());
+            }
+        } else if (ov::intel_cpu::cpu_memory_budget.name() == key) {
+            try {
+                memoryBudget = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_memory_budget.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (ov::intel_cpu::cpu_intermediate_memory_arena.name() == key) {
+            try {
+                intermediateMemoryArena = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_intermediate_memory_arena.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_executor_autotune.name() == key) {
+            try {
+                executorAutotune = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_executor_autotune.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_shape_buckets.name() == key) {
+            try {
+                shapeBuckets = val.as<uint32_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_shape_buckets.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (ov::intel_cpu::cpu_priority_core_share.name() == key) {
+            float share = 0.0F;
+            try {
+                share = val.as<float>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::cpu_priority_core_share.name(),
+                               ". Expected only float numbers");
+            }
+            OPENVINO_ASSERT(share >= 0.F && share <= 1.F,
+                            "Wrong value for property key ",
+                            ov::intel_cpu::cpu_priority_core_share.name(),
+                            ". Core share must be in range [0.0f,1.0f]");
+            priorityCoreShare = share;
+        } else if (ov::intel_cpu::cpu_kv_cache_offload_dir.name() == key) {
+            try {
+                kvCacheOffloadDir = val.as<std::string>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::cpu_kv_cache_offload_dir.name(),
+                               ". Expected only a path string");
+            }
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -475,6 +573,16 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             } catch (ov::Exception&) {
                 OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_sage_attn.name());
             }
+        } else if (key == ov::intel_cpu::enable_inter_op_parallelism.name()) {
+            try {
+                enableInterOpParallelism = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::enable_inter_op_parallelism.name(),
+                               ". Expected only true/false");
+            }
         } else if (key == ov::enable_weightless.name()) {
             try {
                 enableWeightless = val.as<bool>();
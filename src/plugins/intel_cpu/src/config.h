@@ -73,6 +73,16 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    bool rtCacheShared = false;
+    size_t rtCacheByteCapacity = 256UL * 1024UL * 1024UL;
+    std::string kernelCacheDir;
+    size_t memoryBudget = 0UL;
+    bool intermediateMemoryArena = false;
+    bool executorAutotune = false;
+    size_t shapeBuckets = 0UL;
+    ov::hint::Priority modelPriority = ov::hint::Priority::MEDIUM;
+    float priorityCoreShare = 0.5F;
+    std::string kvCacheOffloadDir;
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -87,6 +97,7 @@ struct Config {
     CacheQuantMode keyCacheQuantMode = CacheQuantMode::AUTO;
     CacheQuantMode valueCacheQuantMode = CacheQuantMode::AUTO;
     bool enableSageAttn = false;
+    bool enableInterOpParallelism = false;
     ov::threading::IStreamsExecutor::Config streamExecutorConfig;
     int streams = 1;
     bool streamsChanged = false;
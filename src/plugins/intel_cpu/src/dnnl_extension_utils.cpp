@@ -248,6 +248,14 @@ std::string DnnlExtensionUtils::query_impl_info_str(const const_dnnl_primitive_d
     return res;
 }
 
+size_t DnnlExtensionUtils::query_memory_consumption(const const_dnnl_primitive_desc_t& pd) {
+    dnnl_dim_t res = 0;
+    dnnl_status_t status =
+        dnnl_primitive_desc_query(pd, dnnl_query_memory_consumption_s64, 0, reinterpret_cast<void*>(&res));
+    OPENVINO_ASSERT(status == dnnl_success, "query_memory_consumption failed.");
+    return static_cast<size_t>(std::max<dnnl_dim_t>(res, 0));
+}
+
 bool DnnlExtensionUtils::find_implementation(dnnl::primitive_desc& desc, impl_desc_type impl_type) {
     return DnnlExtensionUtils::find_implementation(desc, [impl_type](impl_desc_type cur_impl_type) {
         return cur_impl_type == impl_type;
@@ -306,8 +314,12 @@ bool DnnlExtensionUtils::isUnarySupportedAsPostOp([[maybe_unused]] Algorithm alg
 
 std::string DnnlExtensionUtils::computeWeightsStringHash(const std::shared_ptr<const IMemory>& memory,
                                                          const std::shared_ptr<DnnlMemoryDesc>& dstDesc) {
-    const auto desc_hash = dnnl::impl::primitive_hashing::get_md_hash(*dstDesc->getDnnlDesc().get());
+    const auto desc_hash = computeWeightsDescHash(dstDesc);
     return std::to_string(desc_hash) + "_" + std::to_string(reinterpret_cast<uint64_t>(memory->getData()));
 }
 
+size_t DnnlExtensionUtils::computeWeightsDescHash(const std::shared_ptr<DnnlMemoryDesc>& dstDesc) {
+    return dnnl::impl::primitive_hashing::get_md_hash(*dstDesc->getDnnlDesc().get());
+}
+
 }  // namespace ov::intel_cpu
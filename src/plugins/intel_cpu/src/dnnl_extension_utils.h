@@ -76,6 +76,11 @@ public:
                                                     const dnnl::query& what,
                                                     int idx = 0);
     static std::string query_impl_info_str(const const_dnnl_primitive_desc_t& pd);
+    /**
+     * @brief Returns the memory in bytes owned by the primitive created from the descriptor, additionally to the memory
+     * of its inputs and outputs
+     */
+    static size_t query_memory_consumption(const const_dnnl_primitive_desc_t& pd);
 
     template <typename T>
     static bool find_implementation(dnnl::primitive_desc& desc, T&& comparator) {
@@ -130,6 +135,13 @@ public:
      */
     static std::string computeWeightsStringHash(const std::shared_ptr<const IMemory>& memory,
                                                 const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
+
+    /**
+     * @brief Computes hash of the weights representation after repacking, which doesn't depend on the weights memory
+     * @param dstDesc descriptor defining weights representation after repacking
+     * @return hash
+     */
+    static size_t computeWeightsDescHash(const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
 };
 
 }  // namespace ov::intel_cpu
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -19,6 +20,7 @@ class DnnlScratchPad {
     MemoryBlockPtr blockPtr;
     MemoryBlockWithReuse* baseBlockPtr = nullptr;
     dnnl::engine eng;
+    std::atomic<size_t> m_requests{0};
 
 public:
     explicit DnnlScratchPad(dnnl::engine eng, int numa_node = -1) : eng(std::move(eng)) {
@@ -28,9 +30,18 @@ public:
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
+        m_requests.fetch_add(1, std::memory_order_relaxed);
         return std::make_shared<Memory>(eng, md, blockPtr);
     }
 
+    /**
+     * @brief Number of memory objects that have been created on top of the scratch pad so far.
+     * Allows to detect which nodes share the scratch pad memory, i.e. must not be executed concurrently.
+     */
+    [[nodiscard]] size_t requestsCount() const {
+        return m_requests.load(std::memory_order_relaxed);
+    }
+
     [[nodiscard]] size_t size() const {
         if (baseBlockPtr) {
             return baseBlockPtr->size();
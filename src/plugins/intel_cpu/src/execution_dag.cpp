@@ -0,0 +1,341 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "execution_dag.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "cpu_types.h"
+#include "edge.h"
+#include "node.h"
+#include "openvino/core/parallel.hpp"
+#include "utils/general_utils.h"
+
+#if OV_THREAD_USE_TBB
+#    include <tbb/task_group.h>
+#endif
+
+namespace ov::intel_cpu {
+
+namespace {
+
+constexpr size_t npos = static_cast<size_t>(-1);
+
+/**
+ * Disjoint memory segments sorted by the begin address with the last node writing the segment and the nodes reading it
+ * since. An access depends on the last writer and a write depends on the readers as well, the earlier accesses are
+ * the dependencies of these ones already.
+ */
+class MemoryAccessTracker {
+public:
+    void access(uintptr_t begin, uintptr_t end, size_t nodeIdx, bool write, std::vector<size_t>& deps) {
+        split(begin);
+        split(end);
+        auto it = m_segments.lower_bound(begin);
+        for (uintptr_t pos = begin; pos < end; ++it) {
+            if (it == m_segments.end() || it->first > pos) {
+                const auto gapEnd = it == m_segments.end() ? end : std::min(end, it->first);
+                it = m_segments.emplace_hint(it, pos, Segment{gapEnd, npos, {}});
+            }
+            auto& segment = it->second;
+            if (segment.writer != npos && segment.writer != nodeIdx) {
+                deps.push_back(segment.writer);
+            }
+            if (write) {
+                for (const auto reader : segment.readers) {
+                    if (reader != nodeIdx) {
+                        deps.push_back(reader);
+                    }
+                }
+                segment.writer = nodeIdx;
+                segment.readers.clear();
+            } else {
+                segment.readers.push_back(nodeIdx);
+            }
+            pos = segment.end;
+        }
+    }
+
+private:
+    struct Segment {
+        uintptr_t end;
+        size_t writer;
+        std::vector<size_t> readers;
+    };
+
+    // splits the segment containing the address, so a segment starts at it
+    void split(uintptr_t at) {
+        auto it = m_segments.upper_bound(at);
+        if (it == m_segments.begin()) {
+            return;
+        }
+        --it;
+        if (it->first < at && at < it->second.end) {
+            auto tail = it->second;
+            it->second.end = at;
+            m_segments.emplace_hint(std::next(it), at, std::move(tail));
+        }
+    }
+
+    std::map<uintptr_t, Segment> m_segments;
+};
+
+/**
+ * Nodes which have side effects beyond their input / output edges:
+ * - inner graphs allocated using the global memory control and executing on the same scratch pad
+ * - memory states which are shared between the nodes without an explicit edge
+ */
+bool isBarrier(const NodePtr& node) {
+    return any_of(node->getType(),
+                  Type::If,
+                  Type::TensorIterator,
+                  Type::SubModel,
+                  Type::LoRA,
+                  Type::MemoryInput,
+                  Type::MemoryOutput,
+                  Type::ScaledDotProductAttention,
+                  Type::PagedAttention);
+}
+
+/**
+ * Nodes which acquire the shared scratch pad memory lazily during the execution,
+ * so it cannot be observed at the primitive creation stage
+ */
+bool usesScratchPadLazily(const NodePtr& node) {
+    return any_of(node->getType(), Type::LLMMLP, Type::QKVProjection);
+}
+
+void trackMemoryAccesses(const std::vector<EdgeWeakPtr>& edges,
+                         size_t nodeIdx,
+                         bool write,
+                         MemoryAccessTracker& tracker,
+                         std::vector<size_t>& deps) {
+    for (const auto& weakEdge : edges) {
+        const auto edge = weakEdge.lock();
+        if (!edge) {
+            continue;
+        }
+        const auto memory = edge->getMemoryPtr();
+        if (!memory) {
+            continue;
+        }
+        const auto* data = memory->getData();
+        const auto size = memory->getSize();
+        // external (I/O) buffers may be not bound yet, the dependencies are defined by the edges in this case
+        if (data == nullptr || size == 0) {
+            continue;
+        }
+        const auto begin = reinterpret_cast<uintptr_t>(data);
+        tracker.access(begin, begin + size, nodeIdx, write, deps);
+    }
+}
+
+}  // namespace
+
+ExecutionDag::ExecutionDag(const std::vector<NodePtr>& executableNodes,
+                           const std::unordered_set<const Node*>& scratchPadUsers,
+                           const CacheLookUps& cacheLookUps) {
+    const size_t nodesNum = executableNodes.size();
+    m_successors.resize(nodesNum);
+    m_dependencies.resize(nodesNum, 0);
+
+    std::unordered_map<const Node*, size_t> execIndices;
+    for (size_t i = 0; i < nodesNum; i++) {
+        execIndices[executableNodes[i].get()] = i;
+    }
+
+    // executable producers of a non executable (optimized out, input, constant) node
+    std::unordered_map<const Node*, std::vector<size_t>> producersCache;
+    std::function<void(const NodePtr&, std::vector<size_t>&)> collectProducers;
+    collectProducers = [&](const NodePtr& node, std::vector<size_t>& producers) {
+        for (const auto& weakEdge : node->getParentEdges()) {
+            const auto edge = weakEdge.lock();
+            if (!edge) {
+                continue;
+            }
+            const auto parent = edge->getParent();
+            if (auto it = execIndices.find(parent.get()); it != execIndices.end()) {
+                producers.push_back(it->second);
+                continue;
+            }
+            auto cached = producersCache.find(parent.get());
+            if (cached == producersCache.end()) {
+                std::vector<size_t> parentProducers;
+                collectProducers(parent, parentProducers);
+                cached = producersCache.emplace(parent.get(), std::move(parentProducers)).first;
+            }
+            producers.insert(producers.end(), cached->second.begin(), cached->second.end());
+        }
+    };
+
+    MemoryAccessTracker memoryAccesses;
+    size_t lastBarrier = npos;
+    size_t lastScratchPadUser = npos;
+    // the last node which looked up a cache record
+    std::unordered_map<size_t, size_t> lastCacheUsers;
+
+    for (size_t j = 0; j < nodesNum; j++) {
+        const auto& node = executableNodes[j];
+        std::vector<size_t> deps;
+
+        collectProducers(node, deps);
+
+        trackMemoryAccesses(node->getParentEdges(), j, false, memoryAccesses, deps);
+        trackMemoryAccesses(node->getChildEdges(), j, true, memoryAccesses, deps);
+
+        if (scratchPadUsers.count(node.get()) || usesScratchPadLazily(node)) {
+            if (lastScratchPadUser != npos) {
+                deps.push_back(lastScratchPadUser);
+            }
+            lastScratchPadUser = j;
+        }
+
+        if (auto it = cacheLookUps.find(node.get()); it != cacheLookUps.end()) {
+            for (const auto record : it->second) {
+                auto [user, inserted] = lastCacheUsers.emplace(record, j);
+                if (!inserted && user->second != j) {
+                    deps.push_back(user->second);
+                    user->second = j;
+                }
+            }
+        }
+
+        if (isBarrier(node)) {
+            // all the nodes before the previous barrier are already its dependencies
+            for (size_t i = lastBarrier == npos ? 0 : lastBarrier; i < j; i++) {
+                deps.push_back(i);
+            }
+            lastBarrier = j;
+        } else if (lastBarrier != npos) {
+            deps.push_back(lastBarrier);
+        }
+
+        std::sort(deps.begin(), deps.end());
+        deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+        for (auto dep : deps) {
+            m_successors[dep].push_back(j);
+        }
+        m_dependencies[j] = deps.size();
+        if (deps.empty()) {
+            m_roots.push_back(j);
+        }
+    }
+
+    // the level of a node is the length of the longest dependency chain leading to it
+    std::vector<size_t> levels(nodesNum, 0);
+    std::vector<size_t> levelSizes;
+    for (size_t i = 0; i < nodesNum; i++) {
+        if (levelSizes.size() <= levels[i]) {
+            levelSizes.resize(levels[i] + 1, 0);
+        }
+        levelSizes[levels[i]]++;
+        for (auto succ : m_successors[i]) {
+            levels[succ] = std::max(levels[succ], levels[i] + 1);
+        }
+    }
+    m_width = levelSizes.empty() ? 0 : *std::max_element(levelSizes.begin(), levelSizes.end());
+}
+
+dnnl::stream ExecutionDag::acquireStream(const StreamFactory& makeStream) const {
+    {
+        std::lock_guard<std::mutex> lock(m_streamsMutex);
+        if (!m_freeStreams.empty()) {
+            auto stream = std::move(m_freeStreams.back());
+            m_freeStreams.pop_back();
+            return stream;
+        }
+    }
+    return makeStream();
+}
+
+void ExecutionDag::releaseStream(dnnl::stream stream) const {
+    std::lock_guard<std::mutex> lock(m_streamsMutex);
+    m_freeStreams.push_back(std::move(stream));
+}
+
+void ExecutionDag::run(const ExecuteFunc& execute, const StreamFactory& makeStream) const {
+#if OV_THREAD_USE_TBB
+    const size_t nodesNum = size();
+    std::unique_ptr<std::atomic<size_t>[]> pending(new std::atomic<size_t>[nodesNum]);
+    for (size_t i = 0; i < nodesNum; i++) {
+        pending[i].store(m_dependencies[i], std::memory_order_relaxed);
+    }
+
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    std::atomic<bool> failed{false};
+    tbb::task_group taskGroup;
+
+    std::function<void(size_t)> process;
+    process = [&](size_t idx) {
+        // the stream is used only by this task, the spawned tasks take their own ones
+        const auto stream = acquireStream(makeStream);
+        // the first ready successor is executed on the same thread to keep the chains cache friendly
+        while (idx != npos) {
+            if (!failed.load(std::memory_order_acquire)) {
+                try {
+                    execute(idx, stream);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                    failed.store(true, std::memory_order_release);
+                }
+            }
+
+            size_t next = npos;
+            for (auto succ : m_successors[idx]) {
+                if (pending[succ].fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                    continue;
+                }
+                if (next == npos) {
+                    next = succ;
+                } else {
+                    taskGroup.run([&process, succ] {
+                        process(succ);
+                    });
+                }
+            }
+            idx = next;
+        }
+        releaseStream(stream);
+    };
+
+    for (size_t i = 1; i < m_roots.size(); i++) {
+        taskGroup.run([&process, root = m_roots[i]] {
+            process(root);
+        });
+    }
+    if (!m_roots.empty()) {
+        process(m_roots.front());
+    }
+    taskGroup.wait();
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+#else
+    const auto stream = acquireStream(makeStream);
+    // the nodes are stored in a valid sequential order
+    for (size_t i = 0; i < size(); i++) {
+        execute(i, stream);
+    }
+    releaseStream(stream);
+#endif
+}
+
+}  // namespace ov::intel_cpu
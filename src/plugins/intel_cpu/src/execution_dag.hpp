@@ -0,0 +1,88 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "node.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Dependency graph over the executable nodes of a static graph used for the inter-op parallel execution.
+ *
+ * The nodes are expected in the sequential execution order. A dependency i -> j (i < j) is added when:
+ * - j consumes the data produced by i (directly or through the optimized out nodes)
+ * - i and j access overlapping memory and at least one of them writes it. This keeps the memory reuse plan
+ *   computed by MemoryControl::solve for the sequential execution order valid
+ * - both i and j use the shared scratch pad memory
+ * - both i and j looked up the same record of the runtime cache, so they may execute the same executor object,
+ *   which may keep mutable scratch buffers (i.e. Interpolate, SDPA)
+ * - either i or j has side effects which are not expressed by the edges (inner graphs, memory states).
+ *   Such nodes are executed as barriers
+ */
+class ExecutionDag {
+public:
+    using ExecuteFunc = std::function<void(size_t, const dnnl::stream&)>;
+    using StreamFactory = std::function<dnnl::stream()>;
+
+    using CacheLookUps = std::unordered_map<const Node*, std::vector<size_t>>;
+
+    ExecutionDag(const std::vector<NodePtr>& executableNodes,
+                 const std::unordered_set<const Node*>& scratchPadUsers,
+                 const CacheLookUps& cacheLookUps = {});
+
+    [[nodiscard]] size_t size() const {
+        return m_successors.size();
+    }
+
+    /**
+     * @brief The max number of nodes which can be executed concurrently
+     * (the number of nodes in the widest level of the dependency graph)
+     */
+    [[nodiscard]] size_t width() const {
+        return m_width;
+    }
+
+    [[nodiscard]] const std::vector<size_t>& successors(size_t idx) const {
+        return m_successors[idx];
+    }
+
+    [[nodiscard]] size_t dependenciesCount(size_t idx) const {
+        return m_dependencies[idx];
+    }
+
+    /**
+     * @brief Execute all the nodes calling \p execute with the node index as soon as all its dependencies are
+     * completed. Independent nodes are executed concurrently in the current task arena.
+     * Each task gets its own stream, so the concurrent nodes never share one. The streams are created by
+     * \p makeStream and are kept for the next runs.
+     * The first exception thrown by \p execute is rethrown after all the running nodes are completed,
+     * the nodes which are not started yet are skipped.
+     */
+    void run(const ExecuteFunc& execute, const StreamFactory& makeStream) const;
+
+private:
+    dnnl::stream acquireStream(const StreamFactory& makeStream) const;
+    void releaseStream(dnnl::stream stream) const;
+
+
+    std::vector<std::vector<size_t>> m_successors;
+    std::vector<size_t> m_dependencies;
+    std::vector<size_t> m_roots;
+    size_t m_width = 0;
+    // streams which are not used by the running tasks
+    mutable std::vector<dnnl::stream> m_freeStreams;
+    mutable std::mutex m_streamsMutex;
+};
+
+}  // namespace ov::intel_cpu
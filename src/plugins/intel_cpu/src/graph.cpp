@@ -20,6 +20,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -396,8 +397,14 @@ void Graph::Activate() {
     // OPENVINO_ASSERT(status == Status::Initialized, "Invalid graph status: ", static_cast<int>(status));
     Allocate();
 
+    RegisterConstantWeights();
+
     CreatePrimitivesAndExecConstants();
 
+    CreateExecutionDag();
+
+    CreateShapeBuckets();
+
 #ifndef CPU_DEBUG_CAPS
     for (auto& graphNode : graphNodes) {
         graphNode->cleanup();
@@ -531,7 +538,38 @@ void Graph::InitOptimalPrimitiveDescriptors() {
     }
 }
 
-void Graph::CreatePrimitivesAndExecConstants() const {
+static size_t ScratchPadRequestsCount(const GraphContext::CPtr& context) {
+    size_t count = 0;
+    for (const auto& scratchPad : context->getScratchPads()) {
+        count += scratchPad->requestsCount();
+    }
+    return count;
+}
+
+/**
+ * Registers the memory of the constants in the weights cache under the names, which don't depend on the compilation,
+ * so the weights repacked from them can be stored in the exported model and reused on import
+ */
+void Graph::RegisterConstantWeights() const {
+    const auto& weightsCache = m_context->getWeightsCache();
+    if (!weightsCache) {
+        return;
+    }
+
+    for (const auto& edge : graphEdges) {
+        const auto& parent = edge->getParent();
+        if (!parent->isConstant() || !edge->getMemoryPtr()) {
+            continue;
+        }
+        if (parent->getType() == Type::Input) {
+            weightsCache->registerConstant(edge->getMemoryPtr()->getData(), parent->getName());
+        } else if (edge->isUseExternalMemory()) {
+            weightsCache->registerConstant(edge->getMemoryPtr()->getData(), edge->hash());
+        }
+    }
+}
+
+void Graph::CreatePrimitivesAndExecConstants() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::CreatePrimitivesAndExecConstants");
     using shared_memory_ptr = WeightsSharing::SharedMemory::Ptr;
 
@@ -558,11 +596,31 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    const bool trackScratchPadUsers = getConfig().enableInterOpParallelism;
+
     for (const auto& node : graphNodes) {
         {
             OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, node->profiling.createPrimitive);
             DEBUG_LOG(*node);
+            const auto scratchPadRequests = trackScratchPadUsers ? ScratchPadRequestsCount(m_context) : 0;
+            std::vector<size_t> lookUps;
+            std::vector<size_t>* outerLookUps = nullptr;
+            std::vector<size_t>* outerSnippetsLookUps = nullptr;
+            if (trackScratchPadUsers) {
+                outerLookUps = m_context->getParamsCache()->recordLookUps(&lookUps);
+                outerSnippetsLookUps = m_context->getSnippetsParamsCache()->recordLookUps(&lookUps);
+            }
             node->createPrimitive();
+            if (trackScratchPadUsers) {
+                m_context->getParamsCache()->recordLookUps(outerLookUps);
+                m_context->getSnippetsParamsCache()->recordLookUps(outerSnippetsLookUps);
+                if (ScratchPadRequestsCount(m_context) != scratchPadRequests) {
+                    m_scratchPadUsers.insert(node.get());
+                }
+                if (!lookUps.empty()) {
+                    m_cacheLookUps.emplace(node.get(), std::move(lookUps));
+                }
+            }
         }
 
         if (!node->isConstant() || !node->isExecutable()) {
@@ -1358,24 +1416,137 @@ VecMemoryDescs Graph::getOutputMemoryDescriptors() const {
     return result;
 }
 
+void Graph::CreateExecutionDag() {
+    m_executionDag.reset();
+    // the memory of the dynamic nodes is reallocated at runtime, so the memory conflicts cannot be resolved in advance
+    if (!IsStatic() || !getConfig().enableInterOpParallelism || parallel_get_max_threads() < 2) {
+        return;
+    }
+
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::CreateExecutionDag");
+    auto executionDag = std::make_unique<ExecutionDag>(m_executableGraphNodes, m_scratchPadUsers, m_cacheLookUps);
+    DEBUG_LOG("Graph: ", GetName(), " execution DAG width: ", executionDag->width());
+    // there is nothing to execute concurrently, so avoid the scheduling overheads
+    if (executionDag->width() > 1) {
+        m_executionDag = std::move(executionDag);
+    }
+}
+
+namespace {
+
+// nodes the output values of which are defined by the input shapes of the graph
+class ShapeDefinedNodes {
+public:
+    // the parents of the node must be added before
+    void add(const Node& node) {
+        const auto& parentEdges = node.getParentEdges();
+        if (node.isConstant() || node.getType() == Type::ShapeOf ||
+            (!parentEdges.empty() &&
+             none_of(node.getType(), Type::Input, Type::MemoryInput, Type::RandomUniform, Type::Multinomial) &&
+             std::all_of(parentEdges.begin(), parentEdges.end(), [&](const EdgeWeakPtr& edge) {
+                 return contains(*edge.lock()->getParent());
+             }))) {
+            m_nodes.insert(&node);
+        }
+    }
+
+    [[nodiscard]] bool contains(const Node& node) const {
+        return m_nodes.count(&node) > 0;
+    }
+
+private:
+    std::unordered_set<const Node*> m_nodes;
+};
+
+}  // namespace
+
+void Graph::CreateShapeBuckets() {
+    m_shapeBuckets.reset();
+    if (!IsDynamic() || getConfig().shapeBuckets == 0) {
+        return;
+    }
+
+    ShapeDefinedNodes shapeDefined;
+    const auto isShapeDefined = [&shapeDefined](const Node& node) {
+        return shapeDefined.contains(node);
+    };
+    // the nodes are topologically sorted, so the parents are checked before the children
+    for (const auto& node : graphNodes) {
+        shapeDefined.add(*node);
+
+        if (!node->isDynamicNode()) {
+            continue;
+        }
+        // the shapes of the states and the shapes inferred from the data are not defined by the input shapes
+        if (node->getType() == Type::MemoryInput || node->outputShapeDataDependency(isShapeDefined)) {
+            DEBUG_LOG("Graph: ", GetName(), " shape buckets are not applicable due to node ", node->getName());
+            return;
+        }
+    }
+
+    m_shapeBuckets = std::make_unique<ShapeBuckets>(getConfig().shapeBuckets, m_executableGraphNodes.size());
+}
+
+bool Graph::SelectShapeBucket() {
+    if (!m_shapeBuckets) {
+        return false;
+    }
+    ShapeBuckets::InputShapes shapes;
+    shapes.reserve(inputNodes.size());
+    for (const auto& input : inputNodes) {
+        shapes.push_back(input ? input->getDstMemoryAtPort(0)->getStaticDims() : VectorDims{});
+    }
+    return m_shapeBuckets->select(shapes);
+}
+
 void Graph::InferStatic(SyncInferRequest* request, int numaId) {
     for (const auto& node : m_executableGraphNodes) {
+        if (request) {
+            request->preemption_point();
+        }
         ExecuteNodeWithCatch(node, request, numaId);
     }
 }
 
+void Graph::InferStaticConcurrent(SyncInferRequest* request, int numaId) {
+    // the ticket of the request is not thread safe, so the tasks yield one by one and the others wait at their next
+    // preemption point while the inference is preempted
+    std::mutex preemptionMutex;
+    m_executionDag->run(
+        [&](size_t nodeIdx, const dnnl::stream& stream) {
+            if (request) {
+                std::lock_guard<std::mutex> lock(preemptionMutex);
+                request->preemption_point();
+            }
+            ExecuteNodeWithCatch(m_executableGraphNodes[nodeIdx], stream, request, numaId);
+        },
+        [this] {
+            return make_stream(getEngine(), m_context->getCpuParallel()->get_thread_pool());
+        });
+}
+
 namespace {
 
+// the shape inference result of the node is replayed from the selected bucket if the buckets are enabled
+void updateNodeShapes(const NodePtr& node, ShapeBuckets* shapeBuckets, size_t nodeIndx) {
+    if (shapeBuckets) {
+        node->updateShapes(&shapeBuckets->entry(nodeIndx));
+    } else {
+        node->updateShapes();
+    }
+}
+
 class UpdateNodesSeq {
 public:
-    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes, ShapeBuckets* shapeBuckets = nullptr)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_shapeBuckets(shapeBuckets) {}
 
     void operator()(size_t stopIndx) {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                updateNodeShapes(node, m_shapeBuckets, prepareCounter);
                 node->updateDynamicParams();
             }
         }
@@ -1384,6 +1555,7 @@ public:
 private:
     size_t prepareCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
+    ShapeBuckets* m_shapeBuckets;
 };
 
 #if (OV_THREAD == OV_THREAD_SEQ)
@@ -1395,14 +1567,15 @@ using UpdateNodes = UpdateNodesSeq;
 
 class UpdateNodesBase {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes, ShapeBuckets* shapeBuckets = nullptr)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_shapeBuckets(shapeBuckets) {}
     void updateShapes(size_t node_indx, size_t stop_indx) {
         try {
             for (size_t i = node_indx; i < stop_indx; i++) {
                 const auto& node = m_executableGraphNodes[i];
                 if (node->isDynamicNode()) {
-                    node->updateShapes();
+                    updateNodeShapes(node, m_shapeBuckets, i);
                 }
                 m_prepareCounter.store(i, std::memory_order_release);
             }
@@ -1435,6 +1608,7 @@ protected:
     std::atomic<size_t> m_prepareCounter{0};
     std::atomic<bool> m_completion{false};
     std::vector<NodePtr>& m_executableGraphNodes;
+    ShapeBuckets* m_shapeBuckets;
 };
 
 // NOLINTBEGIN(misc-include-cleaner) tbb has multiple implicit includes, which are not supposed to be included directly
@@ -1607,18 +1781,32 @@ public:
     DEBUG_LOG(*(node));
 
 inline void Graph::ExecuteNode(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+    ExecuteNode(node, m_stream, request, numaId);
+}
+
+inline void Graph::ExecuteNode(const NodePtr& node,
+                               const dnnl::stream& stream,
+                               SyncInferRequest* request,
+                               int numaId) const {
     if (request) {
         request->throw_if_canceled();
     }
 
-    node->execute(m_stream, numaId);
+    node->execute(stream, numaId);
 }
 
 inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+    ExecuteNodeWithCatch(node, m_stream, request, numaId);
+}
+
+inline void Graph::ExecuteNodeWithCatch(const NodePtr& node,
+                                        const dnnl::stream& stream,
+                                        SyncInferRequest* request,
+                                        int numaId) const {
     VERBOSE_PERF_DUMP_ITT_DEBUG_LOG(itt::domains::ov_op_cpu_exec, node, getConfig());
 
     try {
-        ExecuteNode(node, request, numaId);
+        ExecuteNode(node, stream, request, numaId);
     } catch (const ov::Cancelled&) {
         throw;
     } catch (const std::exception& exp) {
@@ -1635,6 +1823,9 @@ void Graph::InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&&
         for (; inferCounter < stopIndx; ++inferCounter) {
             auto& node = m_executableGraphNodes[inferCounter];
 
+            if (request) {
+                request->preemption_point();
+            }
             ExecuteNodeWithCatch(node, request, numaId);
         }
     }
@@ -1659,13 +1850,21 @@ void Graph::Infer(SyncInferRequest* request) {
 
     switch (status) {
     case Status::ReadyDynamic:
-        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes));
+        // the replayed shapes still go through the parallel update, since prepareParams() of the nodes which input
+        // shapes changed since the previous inference dominates the update
+        SelectShapeBucket();
+        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes, m_shapeBuckets.get()));
         break;
     case Status::ReadyDynamicSeq:
-        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes));
+        SelectShapeBucket();
+        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes, m_shapeBuckets.get()));
         break;
     case Status::ReadyStatic:
-        InferStatic(request, numaId);
+        if (m_executionDag) {
+            InferStaticConcurrent(request, numaId);
+        } else {
+            InferStatic(request, numaId);
+        }
         break;
     default:
         OPENVINO_ASSERT(IsReady(),
@@ -1678,6 +1877,39 @@ void Graph::Infer(SyncInferRequest* request) {
     }
 }
 
+bool Graph::PrepareKernels() {
+    if (!IsDynamic()) {
+        return true;
+    }
+
+    ShapeDefinedNodes shapeDefined;
+    for (const auto& node : graphNodes) {
+        shapeDefined.add(*node);
+    }
+    const auto isShapeDefined = [&shapeDefined](const Node& node) {
+        return shapeDefined.contains(node);
+    };
+
+    const int numaId = GetNumaNodeId(m_context);
+    m_context->allocateMemory();
+
+    for (const auto& node : m_executableGraphNodes) {
+        if (node->isDynamicNode()) {
+            // the shapes of the states and the shapes inferred from the data are known only at the inference
+            if (node->getType() == Type::MemoryInput || node->outputShapeDataDependency(isShapeDefined)) {
+                DEBUG_LOG("Graph: ", GetName(), " kernels preparation stopped at node ", node->getName());
+                return false;
+            }
+            node->updateShapes();
+            node->updateDynamicParams();
+        }
+        if (shapeDefined.contains(*node)) {
+            ExecuteNodeWithCatch(node, nullptr, numaId);
+        }
+    }
+    return true;
+}
+
 void Graph::SortTopologically() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::SortTopologically");
 
@@ -16,6 +16,7 @@
 #include "allocation_context.hpp"
 #include "config.h"
 #include "edge.h"
+#include "execution_dag.hpp"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_state.h"
@@ -26,6 +27,7 @@
 #include "openvino/runtime/so_ptr.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "proxy_mem_blk.h"
+#include "shape_buckets.hpp"
 #include "utils/general_utils.h"
 
 namespace ov::intel_cpu {
@@ -100,6 +102,13 @@ public:
 
     void Infer(SyncInferRequest* request = nullptr);
 
+    /**
+     * Generates the kernels of the dynamic nodes for the current input shapes without running the inference: only
+     * the nodes computing the values the shape inference depends on (i.e. the ShapeOf subgraphs) are executed.
+     * @return false if the preparation stopped at a node the output shapes of which depend on the other data
+     */
+    bool PrepareKernels();
+
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -286,6 +295,11 @@ public:
         return m_outputNodesMemBlocks;
     }
 
+    // nullptr if the shape buckets are disabled or not applicable to the graph
+    const ShapeBuckets* getShapeBuckets() const {
+        return m_shapeBuckets.get();
+    }
+
     friend class GraphOptimizer;
 
 protected:
@@ -297,6 +311,10 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         m_executableSyncNodesInds.clear();
+        m_scratchPadUsers.clear();
+        m_cacheLookUps.clear();
+        m_executionDag.reset();
+        m_shapeBuckets.reset();
     }
     Status status{Status::NotReady};
 
@@ -326,8 +344,13 @@ protected:
     void ResolveComplexInplaceConflicts();
     bool ProcessDynNodes() const;
     void AllocateWithReuse(const std::vector<size_t>& syncNodesInds, GlobalExecutionIndex globalExecIndex);
-    void CreatePrimitivesAndExecConstants() const;
+    void RegisterConstantWeights() const;
+    void CreatePrimitivesAndExecConstants();
     std::vector<size_t> CreateExecutionGraph();
+    void CreateExecutionDag();
+    void CreateShapeBuckets();
+    // selects the shape bucket of the current input shapes, returns true if the bucket is known
+    bool SelectShapeBucket();
 
     /**
      * Execute a given \p node within \p request using \p numaId
@@ -348,7 +371,15 @@ protected:
      */
     void ExecuteNode(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
 
+    // the same as above using \p stream instead of the graph one, i.e. by the concurrently executed nodes
+    void ExecuteNodeWithCatch(const NodePtr& node,
+                              const dnnl::stream& stream,
+                              SyncInferRequest* request,
+                              int numaId) const;
+    void ExecuteNode(const NodePtr& node, const dnnl::stream& stream, SyncInferRequest* request, int numaId) const;
+
     void InferStatic(SyncInferRequest* request, int numaId);
+    void InferStaticConcurrent(SyncInferRequest* request, int numaId);
     template <typename UpdateStrategy>
     void InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update);
 
@@ -372,6 +403,15 @@ private:
     std::vector<NodePtr> m_executableGraphNodes;
     std::vector<size_t> m_executableSyncNodesInds;
 
+    // nodes which requested the shared scratch pad memory during the primitives creation
+    std::unordered_set<const Node*> m_scratchPadUsers;
+    // runtime cache records looked up by the nodes during the primitives creation
+    ExecutionDag::CacheLookUps m_cacheLookUps;
+    // dependency graph of m_executableGraphNodes, is built only if the inter-op parallelism is enabled
+    std::unique_ptr<ExecutionDag> m_executionDag;
+    // shape inference results of m_executableGraphNodes per input shapes, only if cpu_shape_buckets is set
+    std::unique_ptr<ShapeBuckets> m_shapeBuckets;
+
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
 };
@@ -12,7 +12,9 @@
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "dnnl_scratch_pad.h"
+#include "memory_arena.hpp"
 #include "memory_control.hpp"
+#include "nodes/executors/executor_autotuner.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "sub_memory_manager.hpp"
@@ -37,7 +39,10 @@ public:
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
                  std::shared_ptr<CpuParallel> cpuParallel = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 SharedCachePtr sharedParamsCache = nullptr,
+                 IntermediateMemoryArena::Ptr memoryArena = nullptr,
+                 ExecutorAutotuner::Ptr executorAutotuner = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -81,6 +86,10 @@ public:
         return m_subMemoryManager;
     }
 
+    [[nodiscard]] const ExecutorAutotuner::Ptr& getExecutorAutotuner() const {
+        return m_executorAutotuner;
+    }
+
     [[nodiscard]] int getNumNumaNodes() const {
         return m_numNumaNodes;
     }
@@ -130,6 +139,8 @@ private:
     std::shared_ptr<CpuParallel> m_cpuParallel = nullptr;
     // numa submemory manager
     std::shared_ptr<SubMemoryManager> m_subMemoryManager;
+    // implementation choices of the executors shared by the streams, only if autotuning is enabled or imported
+    ExecutorAutotuner::Ptr m_executorAutotuner;
 
     int m_numNumaNodes = 1;
     int m_numaNodeId = 0;
@@ -119,6 +119,11 @@ std::map<std::string, std::string> extract_node_metadata(const NodePtr& node) {
     serialization_info[ov::exec_model_info::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
     serialization_info[ov::exec_model_info::RUNTIME_PRECISION] = node->getRuntimePrecision().get_type_name();
+    // record the executor implementation chosen by the autotuning
+    const auto autotunedImplementation = node->getAutotunedImplementation();
+    if (!autotunedImplementation.empty()) {
+        serialization_info["autotuned_implementation"] = autotunedImplementation;
+    }
     // record kv cache precision for ScaledDotProductAttention node
     if (node->getType() == Type::ScaledDotProductAttention) {
         auto* sdpa_node = dynamic_cast<ov::intel_cpu::node::ScaledDotProductAttention*>(node.get());
@@ -0,0 +1,175 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "host_scheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
+
+namespace ov::intel_cpu {
+
+HostScheduler::HostScheduler(int threads) : m_threads(threads) {}
+
+const HostScheduler::Ptr& HostScheduler::instance() {
+    // the streams occupy the physical cores by default
+    static const auto scheduler = std::make_shared<HostScheduler>(get_number_of_cpu_cores());
+    return scheduler;
+}
+
+size_t HostScheduler::index(ov::hint::Priority priority) {
+    switch (priority) {
+    case ov::hint::Priority::LOW:
+        return 0;
+    case ov::hint::Priority::MEDIUM:
+        return 1;
+    case ov::hint::Priority::HIGH:
+        return 2;
+    default:
+        OPENVINO_THROW("Unexpected model priority: ", priority);
+    }
+}
+
+bool HostScheduler::admissible(size_t priority, int threads) const {
+    const auto highest = m_highestDemand.load();
+    // the inference counts in the limits of all the priorities above it
+    int usage = 0;
+    for (size_t p = 0; p < priority; p++) {
+        usage += m_demands[p].threads;
+    }
+    for (size_t p = priority; static_cast<int>(p) < highest; p++) {
+        usage += m_demands[p].threads;
+        float reservedShare = 0.0F;
+        for (size_t higher = p + 1; higher < priorities; higher++) {
+            if (!m_demands[higher].coreShares.empty()) {
+                reservedShare = std::max(reservedShare, *m_demands[higher].coreShares.rbegin());
+            }
+        }
+        const auto limit = static_cast<int>(std::floor((1.0F - reservedShare) * static_cast<float>(m_threads)));
+        if (usage + threads > limit) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void HostScheduler::updateHighestDemand() {
+    int highest = -1;
+    for (size_t p = 0; p < priorities; p++) {
+        if (m_demands[p].running + m_demands[p].waiting > 0) {
+            highest = static_cast<int>(p);
+        }
+    }
+    m_highestDemand.store(highest);
+}
+
+bool HostScheduler::prioritized() const {
+    size_t registered = 0;
+    for (const auto& models : m_models) {
+        registered += models.load(std::memory_order_relaxed) > 0 ? 1 : 0;
+    }
+    return registered > 1;
+}
+
+void HostScheduler::record(size_t priority, Clock::time_point submitted) {
+    const auto delay = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - submitted);
+    m_inferences[priority].fetch_add(1, std::memory_order_relaxed);
+    m_queueingDelayNs[priority].fetch_add(delay.count(), std::memory_order_relaxed);
+}
+
+HostScheduler::Statistics HostScheduler::getStatistics(ov::hint::Priority priority) const {
+    const auto p = index(priority);
+    Statistics statistics;
+    statistics.inferences = m_inferences[p].load(std::memory_order_relaxed);
+    statistics.queueingDelay = std::chrono::nanoseconds{m_queueingDelayNs[p].load(std::memory_order_relaxed)};
+    return statistics;
+}
+
+HostScheduler::Registration::Registration(HostScheduler& scheduler, ov::hint::Priority priority)
+    : m_scheduler(scheduler),
+      m_priority(index(priority)) {
+    m_scheduler.m_models[m_priority]++;
+}
+
+HostScheduler::Registration::~Registration() {
+    m_scheduler.m_models[m_priority]--;
+}
+
+HostScheduler::Ticket::Ticket(HostScheduler& scheduler,
+                              ov::hint::Priority priority,
+                              float coreShare,
+                              int threads,
+                              Clock::time_point submitted)
+    : m_scheduler(scheduler),
+      m_priority(index(priority)),
+      m_coreShare(coreShare),
+      m_threads(threads),
+      m_active(scheduler.prioritized()) {
+    if (!m_active) {
+        m_scheduler.record(m_priority, submitted);
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_scheduler.m_mutex);
+    auto& demand = m_scheduler.m_demands[m_priority];
+    demand.waiting++;
+    demand.coreShares.insert(m_coreShare);
+    m_scheduler.updateHighestDemand();
+    m_scheduler.m_admission.wait(lock, [&] {
+        return m_scheduler.admissible(m_priority, m_threads);
+    });
+    demand.waiting--;
+    demand.running++;
+    demand.threads += m_threads;
+    lock.unlock();
+
+    m_scheduler.record(m_priority, submitted);
+}
+
+HostScheduler::Ticket::~Ticket() {
+    if (!m_active) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_scheduler.m_mutex);
+        auto& demand = m_scheduler.m_demands[m_priority];
+        demand.running--;
+        demand.threads -= m_threads;
+        demand.coreShares.erase(demand.coreShares.find(m_coreShare));
+        m_scheduler.updateHighestDemand();
+    }
+    m_scheduler.m_admission.notify_all();
+}
+
+void HostScheduler::Ticket::yield() {
+    // the inference is not limited or nothing of a higher priority is running or waiting
+    if (!m_active || static_cast<int>(m_priority) >= m_scheduler.m_highestDemand.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_scheduler.m_mutex);
+    auto& demand = m_scheduler.m_demands[m_priority];
+    demand.threads -= m_threads;
+    if (!m_scheduler.admissible(m_priority, m_threads)) {
+        demand.running--;
+        demand.waiting++;
+        // the released threads may admit the other inferences
+        m_scheduler.m_admission.notify_all();
+        m_scheduler.m_admission.wait(lock, [&] {
+            return m_scheduler.admissible(m_priority, m_threads);
+        });
+        demand.waiting--;
+        demand.running++;
+    }
+    demand.threads += m_threads;
+}
+
+}  // namespace ov::intel_cpu
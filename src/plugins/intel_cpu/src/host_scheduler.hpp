@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+
+#include "openvino/runtime/properties.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Admission of the inferences of all the compiled models on the host by their ov::hint::model_priority.
+ *
+ * While there are running or waiting inferences of a higher priority, the inferences of the lower priorities together
+ * may occupy only the threads which are not reserved by the core share of the higher priority ones. The lower priority
+ * inferences over the limit wait for the admission at the start and are suspended at the preemption points between the
+ * graph nodes. While the compiled models of the process are registered with a single priority, the tickets bypass the
+ * scheduler without locking, so it costs nothing without priorities.
+ */
+class HostScheduler {
+public:
+    using Ptr = std::shared_ptr<HostScheduler>;
+    using Clock = std::chrono::steady_clock;
+
+    struct Statistics {
+        uint64_t inferences = 0;
+        // total delay between the submission of the inferences and their start
+        std::chrono::nanoseconds queueingDelay{0};
+    };
+
+    /**
+     * @param threads number of the threads of the host shared by the inferences
+     */
+    explicit HostScheduler(int threads);
+
+    HostScheduler(const HostScheduler&) = delete;
+    HostScheduler& operator=(const HostScheduler&) = delete;
+
+    /**
+     * @brief The scheduler of the host, it is shared by all the compiled models of the process
+     */
+    static const Ptr& instance();
+
+    /**
+     * @brief Registered compiled model of a priority, the registration is dropped on the destruction
+     */
+    class Registration {
+    public:
+        Registration(HostScheduler& scheduler, ov::hint::Priority priority);
+        ~Registration();
+
+        Registration(const Registration&) = delete;
+        Registration& operator=(const Registration&) = delete;
+
+    private:
+        HostScheduler& m_scheduler;
+        const size_t m_priority;
+    };
+
+    /**
+     * @brief Admitted inference, the threads are released on the destruction
+     */
+    class Ticket {
+    public:
+        /**
+         * @brief Waits for the admission of the inference. The ticket is inactive and doesn't wait if the registered
+         * models have a single priority. The inferences started before a model of another priority is registered
+         * are not limited.
+         * @param coreShare share of the host threads reserved for the inferences of \p priority against the lower
+         * priorities
+         * @param threads number of the threads occupied by the inference
+         * @param submitted time of the inference submission, to account the queueing delay
+         */
+        Ticket(HostScheduler& scheduler,
+               ov::hint::Priority priority,
+               float coreShare,
+               int threads,
+               Clock::time_point submitted);
+        ~Ticket();
+
+        Ticket(const Ticket&) = delete;
+        Ticket& operator=(const Ticket&) = delete;
+
+        /**
+         * @brief Preemption point, suspends the inference while it exceeds the threads left by the higher priorities
+         */
+        void yield();
+
+        [[nodiscard]] bool active() const {
+            return m_active;
+        }
+
+    private:
+        HostScheduler& m_scheduler;
+        const size_t m_priority;
+        const float m_coreShare;
+        const int m_threads;
+        const bool m_active;
+    };
+
+    [[nodiscard]] Statistics getStatistics(ov::hint::Priority priority) const;
+
+private:
+    static constexpr size_t priorities = 3;
+
+    struct Demand {
+        size_t waiting = 0;
+        size_t running = 0;
+        // threads of the running inferences
+        int threads = 0;
+        // core shares of the running and the waiting inferences
+        std::multiset<float> coreShares;
+    };
+
+    static size_t index(ov::hint::Priority priority);
+
+    // checks the limits of the priorities from priority to the highest one, the lock is held
+    [[nodiscard]] bool admissible(size_t priority, int threads) const;
+
+    // the lock is held
+    void updateHighestDemand();
+
+    // more than one priority has the registered models
+    [[nodiscard]] bool prioritized() const;
+
+    void record(size_t priority, Clock::time_point submitted);
+
+    const int m_threads;
+    std::array<Demand, priorities> m_demands;
+    std::array<std::atomic<size_t>, priorities> m_models{};
+    std::array<std::atomic<uint64_t>, priorities> m_inferences{};
+    std::array<std::atomic<int64_t>, priorities> m_queueingDelayNs{};
+    // highest priority with the running or the waiting inferences, the preemption points check it without the lock
+    std::atomic<int> m_highestDemand{-1};
+    mutable std::mutex m_mutex;
+    std::condition_variable m_admission;
+};
+
+}  // namespace ov::intel_cpu
@@ -4,6 +4,7 @@
 
 #include "infer_request.h"
 
+#include <chrono>
 #include <cstddef>
 #include <exception>
 #include <functional>
@@ -22,6 +23,9 @@
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
 #include "edge.h"
+#include "graph.h"
+#include "graph_context.h"
+#include "host_scheduler.hpp"
 #include "itt.h"
 #include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -30,6 +34,7 @@
 #include "nodes/common/cpu_convert.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/node_output.hpp"
 #include "openvino/core/shape.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -49,6 +54,51 @@
 using OvString = ov::element_type_traits<ov::element::string>::value_type;
 
 namespace ov::intel_cpu {
+
+namespace {
+
+// Returns the intermediate memory to the arena when the inference completes or throws, so the idle stream keeps only
+// the I/O and the states memory
+class IntermediateMemoryLease {
+public:
+    explicit IntermediateMemoryLease(const Graph& graph)
+        : m_context(graph.getConfig().intermediateMemoryArena ? graph.getGraphContext() : nullptr) {}
+
+    IntermediateMemoryLease(const IntermediateMemoryLease&) = delete;
+    IntermediateMemoryLease& operator=(const IntermediateMemoryLease&) = delete;
+
+    ~IntermediateMemoryLease() {
+        if (m_context) {
+            m_context->releaseMemory();
+        }
+    }
+
+private:
+    GraphContext::CPtr m_context;
+};
+
+// Publishes the ticket of the running inference to the preemption points and withdraws it when the inference
+// completes or throws, so the request never refers to the ticket of the past inference
+class ActiveTicket {
+public:
+    ActiveTicket(HostScheduler::Ticket*& slot, HostScheduler::Ticket& ticket) : m_slot(slot) {
+        // the inactive ticket has no preemption points
+        m_slot = ticket.active() ? &ticket : nullptr;
+    }
+
+    ActiveTicket(const ActiveTicket&) = delete;
+    ActiveTicket& operator=(const ActiveTicket&) = delete;
+
+    ~ActiveTicket() {
+        m_slot = nullptr;
+    }
+
+private:
+    HostScheduler::Ticket*& m_slot;
+};
+
+}  // namespace
+
 SyncInferRequest::SyncInferRequest(CompiledModelHolder compiled_model)
     : ov::ISyncInferRequest(compiled_model.compiled_model()),
       m_compiled_model(std::move(compiled_model)) {
@@ -90,6 +140,16 @@ void SyncInferRequest::redefine_memory_for_input_nodes(Graph& graph) {
     }
 }
 
+KernelWarmupCache::InputShapes SyncInferRequest::get_input_shapes() const {
+    KernelWarmupCache::InputShapes shapes(m_input_ports_map.size());
+    for (const auto& input_port : m_input_ports_map) {
+        if (input_port.first < shapes.size()) {
+            shapes[input_port.first] = get_tensor_ptr(input_port.second)->get_shape();
+        }
+    }
+    return shapes;
+}
+
 void SyncInferRequest::update_external_tensor_ptrs() {
     // Update it due to batched_tensors case will update input tensor
     for (const auto& input : m_input_ports_map) {
@@ -108,6 +168,14 @@ void SyncInferRequest::infer() {
 
     throw_if_canceled();
     if (m_asyncRequest->m_has_sub_infers) {
+        // the sub-requests run under the ticket of the main one, they don't take their own tickets
+        const auto& config = graph.getConfig();
+        const int threads = config.streamExecutorConfig.get_threads();
+        HostScheduler::Ticket ticket(*HostScheduler::instance(),
+                                     config.modelPriority,
+                                     config.priorityCoreShare,
+                                     threads > 0 ? threads : parallel_get_max_threads(),
+                                     m_asyncRequest->m_submitted);
         sub_streams_infer();
         message->server_wait();
         return;
@@ -121,6 +189,9 @@ void SyncInferRequest::infer() {
 
     if (graph.hasDynamicInput()) {
         redefine_memory_for_input_nodes(graph);
+        if (const auto& kernelWarmupCache = m_compiled_model.kernelWarmupCache()) {
+            kernelWarmupCache->registerInference(get_input_shapes());
+        }
     }
 
     change_default_ptr(graph);
@@ -129,12 +200,29 @@ void SyncInferRequest::infer() {
 
     // state -> node
     if (!m_memory_states.empty()) {
+        for (auto&& state : m_memory_states) {
+            state->restore();
+        }
         graph.assignStates(m_memory_states);
     }
 
     push_input_data(graph);
 
-    graph.Infer(this);
+    // the memory is taken from the arena by the graph inference
+    IntermediateMemoryLease lease(graph);
+    if (m_compiled_model.isSubModel()) {
+        graph.Infer(this);
+    } else {
+        // waits for the threads left by the inferences of the higher priority models
+        const auto& config = graph.getConfig();
+        HostScheduler::Ticket ticket(*HostScheduler::instance(),
+                                     config.modelPriority,
+                                     config.priorityCoreShare,
+                                     parallel_get_max_threads(),
+                                     m_asyncRequest ? m_asyncRequest->m_submitted : std::chrono::steady_clock::now());
+        ActiveTicket activeTicket(m_ticket, ticket);
+        graph.Infer(this);
+    }
 
     throw_if_canceled();
 
@@ -148,6 +236,21 @@ void SyncInferRequest::infer() {
     graph.PullOutputData(m_outputs);
 }
 
+bool SyncInferRequest::prepare_kernels() {
+    auto graphLock = m_compiled_model.lock();
+    auto&& graph = graphLock._graph;
+    if (!graph.hasDynamicInput()) {
+        return true;
+    }
+
+    redefine_memory_for_input_nodes(graph);
+    change_default_ptr(graph);
+    push_input_data(graph);
+
+    IntermediateMemoryLease lease(graph);
+    return graph.PrepareKernels();
+}
+
 std::vector<ov::ProfilingInfo> SyncInferRequest::get_profiling_info() const {
     auto&& graph = m_compiled_model.graph();
     OPENVINO_ASSERT(graph.IsReady(), "Graph is not ready!");
@@ -15,6 +15,8 @@
 #include "cpu_shape.h"
 #include "cpu_tensor.h"
 #include "graph.h"
+#include "host_scheduler.hpp"
+#include "kernel_warmup_cache.hpp"
 #include "memory_state.h"
 #include "openvino/core/node.hpp"
 #include "openvino/core/node_output.hpp"
@@ -37,6 +39,13 @@ public:
 
     void infer() override;
 
+    /**
+     * @brief Generates the kernels for the shapes of the input tensors without running the inference, see
+     * Graph::PrepareKernels
+     * @return false if only a part of the kernels was generated
+     */
+    bool prepare_kernels();
+
     std::vector<ov::ProfilingInfo> get_profiling_info() const override;
 
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
@@ -63,6 +72,15 @@ public:
 
     void throw_if_canceled() const;
 
+    /**
+     * @brief Suspends the inference while the inferences of the higher priority models need its threads
+     */
+    void preemption_point() {
+        if (m_ticket != nullptr) {
+            m_ticket->yield();
+        }
+    }
+
 private:
     class OutputControlBlock {
     public:
@@ -112,6 +130,7 @@ private:
 
     void push_input_data(Graph& graph);
     void redefine_memory_for_input_nodes(Graph& graph);
+    KernelWarmupCache::InputShapes get_input_shapes() const;
     void update_external_tensor_ptrs();
     void change_default_ptr(Graph& graph);
 
@@ -127,6 +146,8 @@ private:
     openvino::itt::handle_t m_profiling_task = nullptr;
     std::vector<MemStatePtr> m_memory_states;
     AsyncInferRequest* m_asyncRequest = nullptr;
+    // admission of the running inference by the host scheduler
+    HostScheduler::Ticket* m_ticket = nullptr;
     CompiledModelHolder m_compiled_model;
 
     std::unordered_map<std::size_t, ov::Output<const ov::Node>> m_input_ports_map;
@@ -20,6 +20,133 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Define whether the CPU runtime parameters cache is shared between all the streams of a compiled model
+ * @param true - the stateless executors (i.e. oneDNN primitives) are kept in a single thread safe cache used by all the
+ * streams and bounded by cpu_runtime_cache_byte_capacity, the other ones are still cached per stream
+ * @param false - each stream has its own cache bounded by cpu_runtime_cache_capacity
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_runtime_cache_shared{"CPU_RUNTIME_CACHE_SHARED"};
+
+/**
+ * @brief Defines the approximate max size in bytes of the shared CPU runtime parameters cache
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_runtime_cache_byte_capacity{
+    "CPU_RUNTIME_CACHE_BYTE_CAPACITY"};
+
+/**
+ * @brief Read-only statistics of the shared CPU runtime parameters cache of a compiled model
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_runtime_cache_hits{"CPU_RUNTIME_CACHE_HITS"};
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_runtime_cache_misses{"CPU_RUNTIME_CACHE_MISSES"};
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_runtime_cache_evictions{"CPU_RUNTIME_CACHE_EVICTIONS"};
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_runtime_cache_bytes{"CPU_RUNTIME_CACHE_BYTES"};
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_runtime_cache_records{"CPU_RUNTIME_CACHE_RECORDS"};
+
+/**
+ * @brief Directory to persist the input shapes the kernels of a dynamic model were generated for. The recorded shapes
+ * are replayed when the model is compiled or imported again, so the first inference uses already generated kernels.
+ * Empty value (default) disables the cache.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_kernel_cache_dir{"CPU_KERNEL_CACHE_DIR"};
+
+/**
+ * @brief Read-only statistics of the persistent kernel cache of a compiled model: number of inferences with already
+ * known / new input shapes and the number of shapes replayed at load time
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_kernel_cache_hits{"CPU_KERNEL_CACHE_HITS"};
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_kernel_cache_misses{"CPU_KERNEL_CACHE_MISSES"};
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_kernel_cache_warmed_shapes{
+    "CPU_KERNEL_CACHE_WARMED_SHAPES"};
+
+/**
+ * @brief Defines the max size in bytes of the statically planned memory of the intermediate tensors of an inference, i.e.
+ * of all the memory control units of a stream graph including the inner graphs of its nodes. When the default plan
+ * exceeds the budget, other placements of the tensors are tried, the compilation fails if none fits.
+ * Zero (default) means unlimited.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_memory_budget{"CPU_MEMORY_BUDGET"};
+
+/**
+ * @brief Read-only statistics of the memory of the intermediate tensors of a compiled model graph in bytes: the size of
+ * the statically planned memory, its lower bound (the max total size of the tensors alive at the same time) and the
+ * currently allocated memory including the tensors of dynamic shapes
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_memory_plan_actual_size{"CPU_MEMORY_PLAN_ACTUAL_SIZE"};
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_memory_plan_optimal_size{
+    "CPU_MEMORY_PLAN_OPTIMAL_SIZE"};
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_memory_plan_current_size{
+    "CPU_MEMORY_PLAN_CURRENT_SIZE"};
+
+/**
+ * @brief Read-only sizes in bytes of the constants of a compiled model graph: the constants used in place as views of
+ * the ov::Constant data or of the repacked weights of the imported blob, and the weights copied into the plugin memory
+ * (cloned or repacked to the blocked layouts). Whether the ov::Constant data is mmapped depends on how the model was
+ * read, so the shared bytes are not necessarily backed by a file
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_weights_shared_bytes{"CPU_WEIGHTS_SHARED_BYTES"};
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_weights_copied_bytes{"CPU_WEIGHTS_COPIED_BYTES"};
+
+/**
+ * @brief Define whether the intermediate memory of the streams is taken from the arena shared by the streams of a
+ * compiled model at the inference start and returned on completion
+ * @param true - the intermediate memory is held only by the running inferences, the idle streams keep none
+ * @param false - each stream keeps its intermediate memory allocated between the inferences
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_intermediate_memory_arena{"CPU_INTERMEDIATE_MEMORY_ARENA"};
+
+/**
+ * @brief Read-only total size in bytes of the buffers allocated by the intermediate memory arena of a compiled model
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_intermediate_memory_arena_bytes{
+    "CPU_INTERMEDIATE_MEMORY_ARENA_BYTES"};
+
+/**
+ * @brief Define whether the implementation of the FullyConnected, MatMul and Convolution executors is chosen by timing
+ * the eligible implementations on the actual shapes instead of the static priority list. The decisions are made per
+ * shape bucket (each dimension is rounded up to a power of two) and are stored in the exported compiled model.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_executor_autotune{"CPU_EXECUTOR_AUTOTUNE"};
+
+/**
+ * @brief Defines the max number of the sets of the input shapes (buckets) a dynamic graph keeps the shape inference
+ * results of all its nodes for, per stream. The inference with the input shapes of a known bucket replays the results
+ * instead of the shape inference. Only the shape inference is skipped: the executors of the nodes are prepared as
+ * without the buckets and are taken from the runtime parameters cache (cpu_runtime_cache_capacity) for the known
+ * shapes. The buckets are not used if some output shapes depend on the data or the states.
+ * Zero (default) disables the buckets.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> cpu_shape_buckets{"CPU_SHAPE_BUCKETS"};
+
+/**
+ * @brief Read-only statistics of the shape buckets of a compiled model over all the streams: number of inferences with
+ * the input shapes of a known / new bucket and the number of evicted buckets
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_shape_bucket_hits{"CPU_SHAPE_BUCKET_HITS"};
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_shape_bucket_misses{"CPU_SHAPE_BUCKET_MISSES"};
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_shape_bucket_evictions{"CPU_SHAPE_BUCKET_EVICTIONS"};
+
+/**
+ * @brief Defines the share of the host cores (from 0 to 1) reserved for the inferences of a compiled model against the
+ * compiled models of a lower ov::hint::model_priority. While the model inferences run or wait, the lower priority ones
+ * are suspended between the graph nodes to keep the share free.
+ */
+static constexpr Property<float, PropertyMutability::RW> cpu_priority_core_share{"CPU_PRIORITY_CORE_SHARE"};
+
+/**
+ * @brief Read-only plugin property, the mean delay in microseconds between the submission of an inference and its
+ * start, over all the compiled models of the process with the given ov::hint::model_priority
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_queueing_delay_high{"CPU_QUEUEING_DELAY_HIGH"};
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_queueing_delay_medium{"CPU_QUEUEING_DELAY_MEDIUM"};
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_queueing_delay_low{"CPU_QUEUEING_DELAY_LOW"};
+
+/**
+ * @brief Defines the directory of the files for the offloaded KV-cache states (ov::VariableState::offload). By default
+ * the offloaded states are kept in the host memory.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_kv_cache_offload_dir{"CPU_KV_CACHE_OFFLOAD_DIR"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -80,4 +207,11 @@ static constexpr Property<bool, PropertyMutability::RW> enable_tensor_parallel{"
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_sage_attn{"ENABLE_SAGE_ATTN"};
 
+/**
+ * @brief Define whether to execute independent branches of a static graph concurrently inside a stream
+ * @param true - build the nodes dependency graph at compile time and execute ready nodes concurrently
+ * @param false - execute the nodes one by one in the topological order
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_inter_op_parallelism{"ENABLE_INTER_OP_PARALLELISM"};
+
 }  // namespace ov::intel_cpu
@@ -0,0 +1,231 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kernel_warmup_cache.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "config.h"
+#include "cpu_types.h"
+#include "openvino/core/model.hpp"
+#include "openvino/util/common_util.hpp"
+#include "openvino/util/file_util.hpp"
+#include "utils/debug_capabilities.h"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+constexpr const char* file_header = "OV_CPU_KERNEL_WARMUP_CACHE 1";
+
+/**
+ * The key covers everything what affects the selection of the kernels for the given input shapes:
+ * the topology of the (already transformed) model, the effective ISA and the relevant configuration options
+ */
+size_t computeKey(const std::shared_ptr<const ov::Model>& model, const Config& config) {
+    std::hash<std::string> strHash;
+    std::vector<size_t> hashes;
+    for (const auto& op : model->get_ordered_ops()) {
+        hashes.push_back(strHash(op->get_type_info().name));
+        hashes.push_back(strHash(op->get_type_info().version_id ? op->get_type_info().version_id : ""));
+        for (const auto& output : op->outputs()) {
+            hashes.push_back(strHash(output.get_element_type().to_string()));
+            hashes.push_back(strHash(output.get_partial_shape().to_string()));
+        }
+        for (const auto& input : op->inputs()) {
+            hashes.push_back(input.get_source_output().get_index());
+        }
+    }
+    hashes.push_back(static_cast<size_t>(dnnl::get_effective_cpu_isa()));
+    hashes.push_back(strHash(config.inferencePrecision.to_string()));
+    hashes.push_back(static_cast<size_t>(config.streamExecutorConfig.get_threads_per_stream()));
+    hashes.push_back(static_cast<size_t>(config.fcDynamicQuantizationGroupSize));
+    return ov::util::hash_combine(hashes);
+}
+
+std::string toString(const KernelWarmupCache::InputShapes& shapes) {
+    std::ostringstream os;
+    for (size_t i = 0; i < shapes.size(); i++) {
+        if (i > 0) {
+            os << ';';
+        }
+        for (size_t j = 0; j < shapes[i].size(); j++) {
+            if (j > 0) {
+                os << ',';
+            }
+            os << shapes[i][j];
+        }
+    }
+    return os.str();
+}
+
+bool fromString(const std::string& line, KernelWarmupCache::InputShapes& shapes) {
+    shapes.clear();
+    std::istringstream shapesStream(line);
+    std::string shapeStr;
+    while (std::getline(shapesStream, shapeStr, ';')) {
+        VectorDims dims;
+        std::istringstream dimsStream(shapeStr);
+        std::string dimStr;
+        while (std::getline(dimsStream, dimStr, ',')) {
+            try {
+                dims.push_back(std::stoull(dimStr));
+            } catch (const std::exception&) {
+                return false;
+            }
+        }
+        shapes.push_back(std::move(dims));
+    }
+    // getline doesn't return the trailing empty token, so the last scalar input is restored explicitly
+    if (line.empty() || line.back() == ';') {
+        shapes.emplace_back();
+    }
+    return true;
+}
+
+}  // namespace
+
+KernelWarmupCache::KernelWarmupCache(std::filesystem::path filePath, size_t maxRecords)
+    : m_filePath(std::move(filePath)),
+      m_maxRecords(maxRecords) {
+    load();
+}
+
+KernelWarmupCache::~KernelWarmupCache() {
+    flush();
+}
+
+KernelWarmupCache::Ptr KernelWarmupCache::create(const std::string& cacheDir,
+                                                 const std::shared_ptr<const ov::Model>& model,
+                                                 const Config& config) {
+    if (cacheDir.empty() || !model->is_dynamic()) {
+        return nullptr;
+    }
+
+    std::ostringstream fileName;
+    fileName << "cpu_kernels_" << std::hex << std::setw(16) << std::setfill('0') << computeKey(model, config)
+             << ".txt";
+    const auto dir = ov::util::make_path(cacheDir);
+    try {
+        ov::util::create_directory_recursive(dir);
+    } catch (const std::exception& e) {
+        DEBUG_LOG("Kernel warm-up cache is disabled: ", e.what());
+        return nullptr;
+    }
+    return std::make_shared<KernelWarmupCache>(dir / fileName.str());
+}
+
+void KernelWarmupCache::load() {
+    std::ifstream file(m_filePath);
+    if (!file.is_open()) {
+        return;
+    }
+    std::string line;
+    if (!std::getline(file, line) || line != file_header) {
+        DEBUG_LOG("Kernel warm-up cache file ", m_filePath, " has unexpected format and is ignored");
+        return;
+    }
+    InputShapes shapes;
+    while (m_records.size() < m_maxRecords && std::getline(file, line)) {
+        if (!fromString(line, shapes)) {
+            DEBUG_LOG("Kernel warm-up cache file ", m_filePath, " is corrupted, the rest of it is ignored");
+            break;
+        }
+        if (m_known.insert(shapes).second) {
+            m_records.push_back(shapes);
+        }
+    }
+}
+
+void KernelWarmupCache::store() const {
+    // write to a temporary file and rename it, so concurrent readers never see a partially written profile
+    auto tmpPath = m_filePath;
+    tmpPath += ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::trunc);
+        if (!file.is_open()) {
+            return;
+        }
+        file << file_header << '\n';
+        for (const auto& shapes : m_records) {
+            file << toString(shapes) << '\n';
+        }
+        if (!file.good()) {
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, m_filePath, ec);
+    if (ec) {
+        DEBUG_LOG("Failed to store the kernel warm-up cache file ", m_filePath, ": ", ec.message());
+        std::filesystem::remove(tmpPath, ec);
+    }
+}
+
+bool KernelWarmupCache::registerInference(const InputShapes& shapes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_known.count(shapes)) {
+        m_stats.hits++;
+        return true;
+    }
+    m_stats.misses++;
+    if (m_records.size() >= m_maxRecords) {
+        return false;
+    }
+    auto candidate = m_candidates.find(shapes);
+    if (candidate == m_candidates.end()) {
+        if (m_candidates.size() >= m_maxRecords) {
+            return false;
+        }
+        candidate = m_candidates.emplace(shapes, 0).first;
+    }
+    if (++candidate->second >= min_occurrences) {
+        m_candidates.erase(candidate);
+        m_known.insert(shapes);
+        m_records.push_back(shapes);
+        m_dirty = true;
+    }
+    return false;
+}
+
+void KernelWarmupCache::flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_dirty) {
+        store();
+        m_dirty = false;
+    }
+}
+
+std::vector<KernelWarmupCache::InputShapes> KernelWarmupCache::getRecords(size_t maxCount) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return {m_records.begin(), m_records.begin() + std::min(maxCount, m_records.size())};
+}
+
+void KernelWarmupCache::completeWarmUp(size_t warmedShapes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats = Statistics{};
+    m_stats.warmedShapes = warmedShapes;
+}
+
+KernelWarmupCache::Statistics KernelWarmupCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+#include "openvino/core/model.hpp"
+
+namespace ov::intel_cpu {
+
+struct Config;
+
+/**
+ * @brief Persistent cache of the input shapes a dynamic model was executed with.
+ *
+ * The JIT kernels and oneDNN primitives generated on the CPU cannot be stored as is: the generated code references
+ * absolute addresses of the process and oneDNN doesn't provide cache blobs for the CPU engine. Instead the cache
+ * persists the keys the runtime parameters cache was populated with, i.e. the input shapes of each inference, in a
+ * file inside the cache directory. The file name is derived from the model topology, the effective ISA and the
+ * configuration options which affect the kernels selection, so a profile is never applied to a different
+ * model or machine.
+ *
+ * When the compiled model is created with a non empty profile, the kernels for the first max_warm_up_records recorded
+ * shapes are prepared in each stream without running the inference (see CompiledModel::warm_up_kernels), so they are
+ * generated at load time instead of the first inference.
+ *
+ * Statistics: an inference with the input shapes which are already known (recorded by the previous runs or by the
+ * current one) is a hit, any other inference is a miss. The shapes are appended to the profile once they are seen
+ * min_occurrences times, so the one-off shapes don't take the place of the recurring ones. The profile is written to
+ * the file on flush() or when the cache is destroyed, never on the inference path.
+ */
+class KernelWarmupCache {
+public:
+    using Ptr = std::shared_ptr<KernelWarmupCache>;
+    using InputShapes = std::vector<VectorDims>;
+
+    struct Statistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        size_t warmedShapes = 0;
+    };
+
+    static constexpr size_t default_max_records = 256;
+    // bounds the load time, each replayed shape is an inference in each stream
+    static constexpr size_t max_warm_up_records = 32;
+    static constexpr size_t min_occurrences = 2;
+
+    KernelWarmupCache(std::filesystem::path filePath, size_t maxRecords = default_max_records);
+    ~KernelWarmupCache();
+
+    KernelWarmupCache(const KernelWarmupCache&) = delete;
+    KernelWarmupCache& operator=(const KernelWarmupCache&) = delete;
+
+    /**
+     * @brief Creates the cache for the model in the \p cacheDir directory and loads the profile recorded before
+     * @return nullptr if \p cacheDir is empty or the model has static inputs only
+     */
+    static Ptr create(const std::string& cacheDir, const std::shared_ptr<const ov::Model>& model, const Config& config);
+
+    /**
+     * @brief Registers an inference with the given input shapes, a miss seen min_occurrences times is appended to the
+     * profile in memory
+     * @return true if the shapes are already known
+     */
+    bool registerInference(const InputShapes& shapes);
+
+    /**
+     * @brief Writes the profile to the file if it has new records
+     */
+    void flush();
+
+    /**
+     * @return the first \p maxCount records of the profile in the order they were recorded
+     */
+    [[nodiscard]] std::vector<InputShapes> getRecords(size_t maxCount = default_max_records) const;
+
+    /**
+     * @brief Resets the hit/miss statistics collected by the warm-up inferences
+     */
+    void completeWarmUp(size_t warmedShapes);
+
+    [[nodiscard]] Statistics getStatistics() const;
+
+    [[nodiscard]] const std::filesystem::path& getFilePath() const {
+        return m_filePath;
+    }
+
+private:
+    void load();
+    void store() const;
+
+    const std::filesystem::path m_filePath;
+    const size_t m_maxRecords;
+
+    mutable std::mutex m_mutex;
+    std::vector<InputShapes> m_records;
+    std::set<InputShapes> m_known;
+    // the occurrences of the shapes which are not recorded yet, bounded by the max number of records as well
+    std::map<InputShapes, size_t> m_candidates;
+    Statistics m_stats;
+    bool m_dirty = false;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_arena.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "cpu_memory.h"
+#include "openvino/core/except.hpp"
+
+namespace ov::intel_cpu {
+
+IntermediateMemoryArena::Buffer IntermediateMemoryArena::acquire(size_t size) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto bestFit = m_freeBuffers.end();
+    auto largest = m_freeBuffers.end();
+    for (auto it = m_freeBuffers.begin(); it != m_freeBuffers.end(); ++it) {
+        const auto bufferSize = (*it)->size();
+        if (bufferSize >= size && (bestFit == m_freeBuffers.end() || bufferSize < (*bestFit)->size())) {
+            bestFit = it;
+        }
+        if (largest == m_freeBuffers.end() || bufferSize > (*largest)->size()) {
+            largest = it;
+        }
+    }
+
+    Buffer buffer;
+    const auto selected = bestFit != m_freeBuffers.end() ? bestFit : largest;
+    if (selected != m_freeBuffers.end()) {
+        buffer = std::move(*selected);
+        m_freeBuffers.erase(selected);
+    } else {
+        buffer = std::make_shared<MemoryBlockWithReuse>();
+    }
+
+    const auto oldSize = buffer->size();
+    if (buffer->resize(size)) {
+        m_allocatedBytes = m_allocatedBytes - oldSize + buffer->size();
+    }
+    return buffer;
+}
+
+void IntermediateMemoryArena::release(Buffer buffer) {
+    OPENVINO_ASSERT(buffer, "Unexpected null buffer returned to the intermediate memory arena");
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_freeBuffers.push_back(std::move(buffer));
+}
+
+size_t IntermediateMemoryArena::allocatedBytes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_allocatedBytes;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cpu_memory.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Pool of the buffers for the statically planned intermediate memory, shared by the streams of a compiled model.
+ *
+ * A stream graph takes a buffer at the inference start and returns it on completion, so the intermediate memory is
+ * held only by the running inferences, not by the idle streams. The returned buffers are kept for the reuse, so the
+ * total size is bounded by the max number of the concurrently running inferences.
+ */
+class IntermediateMemoryArena {
+public:
+    using Ptr = std::shared_ptr<IntermediateMemoryArena>;
+    using Buffer = std::shared_ptr<MemoryBlockWithReuse>;
+
+    IntermediateMemoryArena() = default;
+    IntermediateMemoryArena(const IntermediateMemoryArena&) = delete;
+    IntermediateMemoryArena& operator=(const IntermediateMemoryArena&) = delete;
+
+    /**
+     * @brief Returns the smallest free buffer of at least \p size bytes. When there is no such buffer, the largest free
+     * one is reallocated, so the pool doesn't grow beyond the number of the concurrent users.
+     */
+    Buffer acquire(size_t size);
+
+    void release(Buffer buffer);
+
+    /**
+     * @brief Total size in bytes of the buffers allocated by the arena, including the acquired ones
+     */
+    [[nodiscard]] size_t allocatedBytes() const;
+
+private:
+    std::vector<Buffer> m_freeBuffers;
+    size_t m_allocatedBytes = 0;
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace ov::intel_cpu
@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "cpu_memory.h"
+#include "memory_arena.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/memory_solver.hpp"
 #include "utils/debug_capabilities.h"
@@ -158,6 +159,7 @@ public:
     virtual const MemoryControl::MemorySolution& lastSolution() = 0;
     virtual void allocate() = 0;
     virtual void release() = 0;
+    virtual void collectPlanStatistics(MemoryPlanStatistics& stats) const = 0;
 };
 
 using MemoryManagerPtr = std::shared_ptr<IMemoryManager>;
@@ -192,6 +194,9 @@ public:
     void release() override {
         // nothing to do
     }
+    void collectPlanStatistics([[maybe_unused]] MemoryPlanStatistics& stats) const override {
+        // the I/O tensors are not the intermediate ones
+    }
 
 private:
     static const char* getClassName() {
@@ -203,8 +208,68 @@ private:
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerIO& obj);)
 };
 
+}  // namespace
+
+std::pair<int64_t, std::unordered_map<int64_t, int64_t>> solveFirstFit(const std::vector<MemorySolver::Box>& boxes) {
+    std::vector<std::pair<const MemorySolver::Box*, int64_t>> placed;
+    placed.reserve(boxes.size());
+    std::unordered_map<int64_t, int64_t> offsets;
+    std::vector<std::pair<int64_t, int64_t>> busy;
+    int64_t totalSize = 0;
+    for (const auto& box : boxes) {
+        busy.clear();
+        for (const auto& [other, offset] : placed) {
+            if (other->start <= box.finish && box.start <= other->finish) {
+                busy.emplace_back(offset, offset + other->size);
+            }
+        }
+        std::sort(busy.begin(), busy.end());
+        int64_t offset = 0;
+        for (const auto& [begin, end] : busy) {
+            if (begin >= offset + box.size) {
+                break;
+            }
+            offset = std::max(offset, end);
+        }
+        placed.emplace_back(&box, offset);
+        offsets[box.id] = offset;
+        totalSize = std::max(totalSize, offset + box.size);
+    }
+    return {totalSize, std::move(offsets)};
+}
+
+size_t MemoryBudget::available(const void* owner) const {
+    size_t reserved = 0;
+    for (const auto& [other, size] : m_reserved) {
+        if (other != owner) {
+            reserved += size;
+        }
+    }
+    return reserved < m_limit ? m_limit - reserved : 0;
+}
+
+void MemoryBudget::reserve(const void* owner, size_t size) {
+    m_reserved[owner] = size;
+}
+
+void MemoryBudget::cancel(const void* owner) {
+    m_reserved.erase(owner);
+}
+
+namespace {
+
 class MemoryManagerStatic : public IMemoryManager {
 public:
+    explicit MemoryManagerStatic(MemoryBudget::Ptr budget = nullptr, IntermediateMemoryArena::Ptr arena = nullptr)
+        : m_budget(std::move(budget)),
+          m_arena(std::move(arena)) {}
+
+    ~MemoryManagerStatic() override {
+        if (m_budget) {
+            m_budget->cancel(this);
+        }
+    }
+
     void insert(const MemoryRegion& reg, [[maybe_unused]] const std::vector<size_t>& syncInds) override {
         OPENVINO_ASSERT(reg.size >= 0, getClassName(), ": got undefined block size");
         m_boxes.emplace_back(MemorySolver::Box{reg.start, reg.finish, reg.size, reg.id});
@@ -229,25 +294,114 @@ private:
 
         ov::MemorySolver staticMemSolver(boxes_to_process);
         m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
+        m_optimalSize = static_cast<size_t>(staticMemSolver.max_depth()) * alignment;
+
+        std::unordered_map<int64_t, int64_t> offsets;
+        for (const auto& box : boxes_to_process) {
+            offsets[box.id] = staticMemSolver.get_offset(static_cast<int>(box.id));
+        }
+        if (m_budget) {
+            const auto available = m_budget->available(this);
+            if (m_totalSize > available) {
+                solveWithinBudget(boxes_to_process, offsets, alignment, available);
+            }
+            m_budget->reserve(this, m_totalSize);
+        }
 
         m_workspace = std::make_shared<MemoryBlockWithRelease>();
 
         for (const auto& box : boxes_to_process) {
-            int64_t offset = staticMemSolver.get_offset(static_cast<int>(box.id));
-            auto memoryBlock = std::make_shared<StaticPartitionMemoryBlock>(m_workspace, offset * alignment);
+            auto memoryBlock = std::make_shared<StaticPartitionMemoryBlock>(m_workspace, offsets.at(box.id) * alignment);
             m_blocks[box.id] = std::move(memoryBlock);
         }
     }
 
+    /**
+     * The memory solver places the largest boxes first, which is usually close to the lower bound, but not always.
+     * When the plan exceeds the budget, the other placement orders are tried until the plan fits the budget.
+     * The execution order is fixed, so the budget below the lower bound can't be met at all.
+     * @param available the budget left by the other memory control units of the network
+     */
+    void solveWithinBudget(std::vector<MemorySolver::Box> boxes,
+                           std::unordered_map<int64_t, int64_t>& offsets,
+                           size_t alignment,
+                           size_t available) {
+        OPENVINO_ASSERT(m_optimalSize <= available,
+                        "CPU memory budget of ",
+                        m_budget->limit(),
+                        " bytes can't be met: the intermediate tensors alive at the same time require ",
+                        m_optimalSize,
+                        " bytes, while ",
+                        m_budget->limit() - available,
+                        " bytes are planned for the other memory control units");
+
+        using Box = MemorySolver::Box;
+        auto lifetime = [](const Box& box) {
+            return static_cast<int64_t>(box.finish - box.start + 1);
+        };
+        const std::vector<std::function<bool(const Box&, const Box&)>> orders = {
+            // the long living boxes first, so the short ones fill the gaps
+            [&](const Box& l, const Box& r) {
+                return lifetime(l) > lifetime(r) || (lifetime(l) == lifetime(r) && l.size > r.size);
+            },
+            // the largest area on the size/time plane first
+            [&](const Box& l, const Box& r) {
+                return l.size * lifetime(l) > r.size * lifetime(r);
+            },
+            // execution order
+            [](const Box& l, const Box& r) {
+                return l.start < r.start || (l.start == r.start && l.size > r.size);
+            },
+        };
+
+        MemorySolver::normalize_boxes(boxes);
+        for (const auto& order : orders) {
+            std::stable_sort(boxes.begin(), boxes.end(), order);
+            auto [totalSize, candidate] = solveFirstFit(boxes);
+            if (static_cast<size_t>(totalSize) * alignment < m_totalSize) {
+                m_totalSize = static_cast<size_t>(totalSize) * alignment;
+                offsets = std::move(candidate);
+            }
+            if (m_totalSize <= available) {
+                return;
+            }
+        }
+        OPENVINO_THROW("CPU memory budget of ",
+                       m_budget->limit(),
+                       " bytes can't be met: the best found memory plan requires ",
+                       m_totalSize,
+                       " bytes, while the lower bound is ",
+                       m_optimalSize,
+                       " bytes and ",
+                       m_budget->limit() - available,
+                       " bytes are planned for the other memory control units");
+    }
+
     void allocate() override {
-        if (m_workspace) {
-            m_workspace->resize(m_totalSize);
+        if (!m_workspace) {
+            return;
         }
+        if (m_arena && m_totalSize > 0) {
+            if (!m_lease) {
+                m_lease = m_arena->acquire(m_totalSize);
+            }
+            m_workspace->setExtBuff(m_lease->getRawPtr(), m_totalSize);
+            return;
+        }
+        m_workspace->resize(m_totalSize);
     }
     void release() override {
         if (m_workspace) {
             m_workspace->free();
         }
+        if (m_lease) {
+            m_arena->release(std::move(m_lease));
+        }
+    }
+    void collectPlanStatistics(MemoryPlanStatistics& stats) const override {
+        stats.actual_size += m_totalSize;
+        stats.optimal_size += m_optimalSize;
+        stats.current_size += m_workspace ? m_workspace->size() : 0;
     }
 
     static const char* getClassName() {
@@ -257,7 +411,11 @@ private:
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::shared_ptr<MemoryBlockWithRelease> m_workspace;
+    MemoryBudget::Ptr m_budget;
+    IntermediateMemoryArena::Ptr m_arena;
+    IntermediateMemoryArena::Buffer m_lease;
     size_t m_totalSize = 0;
+    size_t m_optimalSize = 0;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj);)
 };
@@ -328,11 +486,13 @@ private:
                 groups.push_back({box});
             }
         }
+        m_uniqueBlocks.clear();
         for (auto& group : groups) {
             auto unique_block = std::make_shared<MemoryBlockWithRelease>();
             for (auto& box : group) {
                 m_internalBlocks.insert({box.id, internalBlock(unique_block)});
             }
+            m_uniqueBlocks.push_back(std::move(unique_block));
         }
     }
 
@@ -344,6 +504,12 @@ private:
             item.second->free();
         }
     }
+    void collectPlanStatistics(MemoryPlanStatistics& stats) const override {
+        // the sizes are defined by the input shapes, so only the currently allocated memory is known
+        for (const auto& block : m_uniqueBlocks) {
+            stats.current_size += block->size();
+        }
+    }
 
     static const char* getClassName() {
         return "MemoryManagerNonOverlappingSets";
@@ -352,6 +518,7 @@ private:
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::unordered_map<MemoryControl::MemorySolution::key_type, std::shared_ptr<InternalBlock>> m_internalBlocks;
+    std::vector<std::shared_ptr<MemoryBlockWithRelease>> m_uniqueBlocks;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets& obj);)
 };
@@ -483,6 +650,10 @@ public:
         m_memManager->release();
     }
 
+    void collectPlanStatistics(MemoryPlanStatistics& stats) const {
+        m_memManager->collectPlanStatistics(stats);
+    }
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] MemoryStatisticsRecord dumpStatistics() const {
         return m_statDumper(m_memManager);
@@ -521,12 +692,16 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+MemoryControl::MemoryControl(std::string id, MemoryBudget::Ptr budget, IntermediateMemoryArena::Ptr arena)
+    : m_id(std::move(id)) {
     // init handlers
-    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
-        return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>(
+        [](const MemoryRegion& reg) {
+            return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        std::move(budget),
+        std::move(arena)));
 
     // handler for static tensors
     m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
@@ -583,6 +758,14 @@ void MemoryControl::releaseMemory() {
     m_allocated = false;
 }
 
+MemoryPlanStatistics MemoryControl::getPlanStatistics() const {
+    MemoryPlanStatistics stats;
+    for (auto&& handler : m_handlers) {
+        handler->collectPlanStatistics(stats);
+    }
+    return stats;
+}
+
 #ifdef CPU_DEBUG_CAPS
 MemoryStatistics MemoryControl::dumpStatistics() const {
     MemoryStatistics profileData;
@@ -594,7 +777,7 @@ MemoryStatistics MemoryControl::dumpStatistics() const {
 #endif  // CPU_DEBUG_CAPS
 
 MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id), m_budget, m_arena)));
     return m_controlUnits.back();
 }
 
@@ -623,4 +806,15 @@ std::vector<std::pair<std::string, MemoryStatistics>> NetworkMemoryControl::dump
 #endif  // CPU_DEBUG_CAPS
 }
 
+MemoryPlanStatistics NetworkMemoryControl::getPlanStatistics() const {
+    MemoryPlanStatistics stats;
+    for (auto&& item : m_controlUnits) {
+        const auto unitStats = item->getPlanStatistics();
+        stats.actual_size += unitStats.actual_size;
+        stats.optimal_size += unitStats.optimal_size;
+        stats.current_size += unitStats.current_size;
+    }
+    return stats;
+}
+
 }  // namespace ov::intel_cpu
@@ -14,6 +14,8 @@
 
 #include "cpu_memory.h"
 #include "edge.h"
+#include "memory_arena.hpp"
+#include "openvino/runtime/memory_solver.hpp"
 
 namespace ov::intel_cpu {
 
@@ -42,6 +44,49 @@ struct MemoryStatisticsRecord {
 
 using MemoryStatistics = std::vector<MemoryStatisticsRecord>;
 
+/**
+ * @brief Sizes of the memory plan of the intermediate tensors, available in all build types
+ */
+struct MemoryPlanStatistics {
+    size_t actual_size = 0;   // bytes of the statically planned workspace
+    size_t optimal_size = 0;  // lower bound of the workspace: the max total size of the tensors alive at once
+    size_t current_size = 0;  // bytes currently allocated, including the tensors of dynamic shapes
+};
+
+/**
+ * @brief Budget of the statically planned memory shared by the memory control units of a network (the main graph and
+ * the inner graphs of its nodes), which are allocated together for an inference. Each unit reserves the size of its
+ * current plan.
+ */
+class MemoryBudget {
+public:
+    using Ptr = std::shared_ptr<MemoryBudget>;
+
+    explicit MemoryBudget(size_t limit) : m_limit(limit) {}
+
+    [[nodiscard]] size_t limit() const {
+        return m_limit;
+    }
+
+    /**
+     * @return bytes available to the plan of the owner: the limit minus the plans of the other owners
+     */
+    [[nodiscard]] size_t available(const void* owner) const;
+    void reserve(const void* owner, size_t size);
+    void cancel(const void* owner);
+
+private:
+    size_t m_limit = 0;
+    std::unordered_map<const void*, size_t> m_reserved;
+};
+
+/**
+ * Places the boxes in the given order at the lowest offset which doesn't intersect with the already placed boxes
+ * alive at the same time. The boxes are expected to be normalized.
+ * @return the total size and the offsets of the boxes by their ids
+ */
+std::pair<int64_t, std::unordered_map<int64_t, int64_t>> solveFirstFit(const std::vector<MemorySolver::Box>& boxes);
+
 class MemoryControl {
 public:
     class RegionHandler;
@@ -66,8 +111,14 @@ public:
         return m_id;
     }
 
+    [[nodiscard]] MemoryPlanStatistics getPlanStatistics() const;
+
 private:
-    explicit MemoryControl(std::string id);
+    /**
+     * @param budget if set, the statically planned workspace is reduced to fit the budget left by the other units
+     * @param arena if set, the statically planned workspace is taken from the arena on allocation and returned on release
+     */
+    MemoryControl(std::string id, MemoryBudget::Ptr budget, IntermediateMemoryArena::Ptr arena);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     [[nodiscard]] MemoryStatistics dumpStatistics() const;
 
@@ -80,7 +131,12 @@ private:
 
 class NetworkMemoryControl {
 public:
-    NetworkMemoryControl() = default;
+    /**
+     * @param memoryBudget max size in bytes of the statically planned workspaces of all the units, zero means unlimited
+     */
+    explicit NetworkMemoryControl(size_t memoryBudget = 0, IntermediateMemoryArena::Ptr arena = nullptr)
+        : m_budget(memoryBudget != 0 ? std::make_shared<MemoryBudget>(memoryBudget) : nullptr),
+          m_arena(std::move(arena)) {}
     MemoryControl::Ptr createMemoryControlUnit(std::string id);
 
     void allocateMemory();
@@ -88,11 +144,15 @@ public:
 
     [[nodiscard]] std::vector<std::pair<std::string, MemoryStatistics>> dumpStatistics() const;
 
+    [[nodiscard]] MemoryPlanStatistics getPlanStatistics() const;
+
     [[nodiscard]] const std::vector<MemoryControl::Ptr>& controlUnits() const {
         return m_controlUnits;
     }
 
 private:
+    MemoryBudget::Ptr m_budget;
+    IntermediateMemoryArena::Ptr m_arena;
     std::vector<MemoryControl::Ptr> m_controlUnits;
 };
 
@@ -7,11 +7,19 @@
 #include <nodes/common/cpu_convert.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <ios>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <random>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -29,6 +37,7 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/runtime/itensor.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "utils/general_utils.h"
 #include "utils/plain_tensor.hpp"
 
@@ -119,6 +128,40 @@ void VariableStateBase::reset() {
     reset_state_flag = true;
 }
 
+void VariableStateBase::fork_from(const std::shared_ptr<ov::IVariableState>& source) {
+    OPENVINO_ASSERT(source, "The source state of ", get_name(), " is not initialized");
+    if (source.get() == this) {
+        return;
+    }
+    OPENVINO_ASSERT(source->get_name() == get_name(),
+                    "Can't fork the state ",
+                    get_name(),
+                    " from the state of another variable ",
+                    source->get_name());
+    auto cpu_source = std::dynamic_pointer_cast<VariableStateBase>(source);
+    if (cpu_source && cpu_source->is_reset_state()) {
+        reset();
+        return;
+    }
+    if (cpu_source) {
+        // the other states are checked by set_state_impl()
+        const auto& source_dims = cpu_source->internal_state_mem()->getStaticDims();
+        OPENVINO_ASSERT(m_external_desc->getShape().isCompatible(source_dims),
+                        "Can't fork the state ",
+                        get_name(),
+                        " of shape ",
+                        m_external_desc->getShape().toString(),
+                        " from the state of incompatible shape ",
+                        vec2str(source_dims));
+    }
+    fork_from_impl(source);
+    reset_state_flag = false;
+}
+
+void VariableStateBase::fork_from_impl(const std::shared_ptr<ov::IVariableState>& source) {
+    set_state_impl(source->get_state());
+}
+
 bool VariableStateBase::is_reset_state() const {
     return reset_state_flag;
 }
@@ -226,16 +269,100 @@ VariableStateKVcache::VariableStateKVcache(const std::string& name,
                                            MemoryDescPtr external_desc,
                                            BlockedMemoryDescPtr dense_internal_desc,
                                            const bool quant_by_channel,
-                                           const size_t group_size)
+                                           const size_t group_size,
+                                           std::string offload_dir)
     : VariableStateBase(name, std::move(external_desc)),
       m_dense_internal_desc(std::move(dense_internal_desc)),
       m_quant_by_channel(quant_by_channel),
-      m_group_size(group_size) {
+      m_group_size(group_size),
+      m_offload_dir(std::move(offload_dir)) {
     auto&& shape = get_external_desc()->getShape();
     OPENVINO_ASSERT(shape.isDynamic(), "VariableStateKVcache is unexpectedly initalized with a static tensor");
 }
 
+VariableStateKVcache::~VariableStateKVcache() = default;
+
+// The offloaded record is [beam table: B x L i32][scale/zp: f32][kv: L x B x H x S]. The kv cache is stored as is in its
+// own precision, so the restored state is bit exact, the u8 one is followed by its quantization params.
+struct VariableStateKVcache::Offloaded {
+    struct Restored {
+        MemoryPtr internal_mem;
+        MemoryPtr hidden_state;
+        PlainTensor scale_zp;
+    };
+
+    ~Offloaded() {
+        // the pending prefetch may still read the file
+        if (prefetched.valid()) {
+            prefetched.wait();
+        }
+        if (!path.empty()) {
+            std::error_code ec;
+            std::filesystem::remove(path, ec);
+        }
+    }
+
+    [[nodiscard]] size_t beam_table_bytes() const {
+        return B * L * sizeof(int32_t);
+    }
+    [[nodiscard]] size_t params_bytes() const {
+        return params_rows * B * H * params_row * sizeof(float);
+    }
+    [[nodiscard]] size_t kv_bytes() const {
+        return L * B * H * S * precision.size();
+    }
+
+    [[nodiscard]] Restored load() const {
+        std::shared_ptr<ov::MappedMemory> mapped;
+        const uint8_t* record = data.data();
+        if (!path.empty()) {
+            mapped = ov::load_mmap_object(path);
+            OPENVINO_ASSERT(mapped && mapped->size() == beam_table_bytes() + params_bytes() + kv_bytes(),
+                            "The offloaded KV-cache state file is corrupted: ",
+                            path);
+            record = reinterpret_cast<const uint8_t*>(mapped->data());
+        }
+        const auto* beam_table = reinterpret_cast<const int32_t*>(record);
+        const auto* params = reinterpret_cast<const float*>(record + beam_table_bytes());
+        const auto* kv = record + beam_table_bytes() + params_bytes();
+
+        Restored restored;
+        restored.hidden_state = std::make_shared<Memory>(get_engine(),
+                                                         std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32,
+                                                                                                Shape{B, L}));
+        std::memcpy(restored.hidden_state->getData(), beam_table, beam_table_bytes());
+
+        restored.internal_mem = std::make_shared<Memory>(get_engine(), internal_desc);
+        PlainTensor internal;
+        internal.reset(restored.internal_mem);
+        internal = internal.permute(order);
+        const auto row_bytes = S * precision.size();
+        parallel_for3d(L, B, H, [&](size_t m, size_t b, size_t h) {
+            std::memcpy(internal.ptr_v(m, b, h), kv + ((m * B + b) * H + h) * row_bytes, row_bytes);
+        });
+        if (params_rows != 0) {
+            restored.scale_zp.resize<float>({params_rows, B, H, params_row});
+            std::memcpy(restored.scale_zp.ptr<float>(), params, params_bytes());
+        }
+        return restored;
+    }
+
+    MemoryDescPtr internal_desc;  // dense desc of the state
+    VectorDims order;             // permutes the state to LBHS
+    size_t L = 0;
+    size_t B = 0;
+    size_t H = 0;
+    size_t S = 0;
+    size_t params_rows = 0;
+    size_t params_row = 0;
+    ov::element::Type precision;  // precision of the kv cache
+    std::vector<uint8_t> data;
+    std::filesystem::path path;
+    std::future<Restored> prefetched;
+};
+
 ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
+    restore_state();
     if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
         auto new_desc = to_static(get_external_desc());
         auto external_mem = std::make_shared<Memory>(get_engine(), new_desc);
@@ -312,6 +439,7 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
 }
 
 void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
+    m_offloaded.reset();
     // 1. reset the memory object
     m_state = state;  // simply to extend the lifetime
     auto state_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(m_state);
@@ -396,8 +524,180 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     m_hidden_state_max_size = mem_desc->getCurrentMemSize() / mem_desc->getPrecision().size();
 }
 
+void VariableStateKVcache::fork_from_impl(const std::shared_ptr<ov::IVariableState>& source) {
+    m_offloaded.reset();
+    auto kv_source = std::dynamic_pointer_cast<VariableStateKVcache>(source);
+    if (kv_source) {
+        kv_source->restore();
+    }
+    if (!kv_source || !kv_source->m_internal_mem || !kv_source->m_hidden_state ||
+        kv_source->m_dense_internal_desc->getPrecision() != m_dense_internal_desc->getPrecision() ||
+        kv_source->m_dense_internal_desc->getOrder() != m_dense_internal_desc->getOrder() ||
+        kv_source->m_quant_by_channel != m_quant_by_channel || kv_source->m_group_size != m_group_size) {
+        VariableStateBase::fork_from_impl(source);
+        return;
+    }
+
+    // own memory objects over the shared blocks, so truncate() of one state doesn't change the shape of another
+    m_internal_mem = std::make_shared<Memory>(get_engine(),
+                                              kv_source->m_internal_mem->getDescPtr(),
+                                              kv_source->m_internal_mem->getMemoryBlock());
+    m_hidden_state = std::make_shared<Memory>(get_engine(),
+                                              kv_source->m_hidden_state->getDescPtr(),
+                                              kv_source->m_hidden_state->getMemoryBlock());
+    m_scale_zp = kv_source->m_scale_zp;
+
+    // SDPA updates the states in place only within their capacity, otherwise it moves them to the new buffers. The
+    // zero capacity makes both states copy the shared data before the first update
+    m_internal_mem_max_size = 0;
+    m_hidden_state_max_size = 0;
+    kv_source->m_internal_mem_max_size = 0;
+    kv_source->m_hidden_state_max_size = 0;
+}
+
+void VariableStateKVcache::truncate(size_t length) {
+    restore();
+    if (is_reset_state() || !m_internal_mem || !m_hidden_state) {
+        OPENVINO_ASSERT(length == 0, "Can't truncate the empty state ", get_name(), " to ", length, " tokens");
+        return;
+    }
+
+    auto internal_desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+    auto&& order = internal_desc->getOrder();
+    auto dims = internal_desc->getShape().getStaticDims();
+    // the order permutes the state shape to LBHS
+    const size_t L0 = dims[order[0]];
+    OPENVINO_ASSERT(length <= L0, "Can't truncate the state ", get_name(), " of ", L0, " tokens to ", length);
+    if (length == L0) {
+        return;
+    }
+
+    // the strides are kept, so the tokens stay in place and the next ones overwrite the dropped tail. The quantization
+    // params of the dropped tokens are not used anymore: by token they are indexed by the position, and by channel the
+    // group is requantized from its valid part when it's appended
+    dims[order[0]] = length;
+    VectorDims blocked_dims(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        blocked_dims[i] = dims[order[i]];
+    }
+    auto new_desc = std::make_shared<CpuBlockedMemoryDesc>(internal_desc->getPrecision(),
+                                                           Shape(dims),
+                                                           blocked_dims,
+                                                           order,
+                                                           0,
+                                                           VectorDims{},
+                                                           internal_desc->getStrides());
+    m_internal_mem->redefineDesc(new_desc);
+
+    auto hidden_desc = m_hidden_state->getDescWithType<BlockedMemoryDesc>();
+    const size_t B = hidden_desc->getShape().getStaticDims()[0];
+    auto new_hidden_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32,
+                                                                  Shape{B, length},
+                                                                  VectorDims{B, length},
+                                                                  VectorDims{0, 1},
+                                                                  0,
+                                                                  VectorDims{},
+                                                                  hidden_desc->getStrides());
+    m_hidden_state->redefineDesc(new_hidden_desc);
+}
+
+void VariableStateKVcache::offload() {
+    if (is_reset_state() || m_offloaded || !m_internal_mem || !m_hidden_state) {
+        return;
+    }
+
+    PlainTensor pastkv;
+    PlainTensor beam_table;
+    pastkv.reset(m_internal_mem);
+    beam_table.reset(m_hidden_state);
+    pastkv = pastkv.permute(m_dense_internal_desc->getOrder());
+    OPENVINO_ASSERT(pastkv.stride(3) == 1);
+    if (pastkv.size(0) == 0) {
+        return;
+    }
+
+    auto offloaded = std::make_unique<Offloaded>();
+    auto& o = *offloaded;
+    o.L = pastkv.size(0);
+    o.B = pastkv.size(1);
+    o.H = pastkv.size(2);
+    o.S = pastkv.size(3);
+    o.internal_desc = m_dense_internal_desc->cloneWithNewDims(m_internal_mem->getStaticDims());
+    o.order = m_dense_internal_desc->getOrder();
+    o.precision = pastkv.get_precision();
+    if (o.precision == element::u8) {
+        o.params_rows = m_quant_by_channel ? div_up(o.L, m_group_size) * 2 : o.L;
+        o.params_row = m_scale_zp.size(3);
+    }
+
+    std::vector<uint8_t> record(o.beam_table_bytes() + o.params_bytes() + o.kv_bytes());
+    auto* dst_beam_table = reinterpret_cast<int32_t*>(record.data());
+    auto* dst_params = reinterpret_cast<float*>(record.data() + o.beam_table_bytes());
+    auto* dst_kv = record.data() + o.beam_table_bytes() + o.params_bytes();
+    for (size_t b = 0; b < o.B; b++) {
+        std::memcpy(dst_beam_table + b * o.L, beam_table.ptr<int32_t>(b), o.L * sizeof(int32_t));
+    }
+    const auto row = [&](size_t m, size_t b, size_t h) {
+        return (m * o.B + b) * o.H + h;
+    };
+    const auto row_bytes = o.S * o.precision.size();
+    parallel_for3d(o.L, o.B, o.H, [&](size_t m, size_t b, size_t h) {
+        std::memcpy(dst_kv + row(m, b, h) * row_bytes, pastkv.ptr_v(m, b, h), row_bytes);
+    });
+    parallel_for3d(o.params_rows, o.B, o.H, [&](size_t m, size_t b, size_t h) {
+        std::memcpy(dst_params + row(m, b, h) * o.params_row,
+                    m_scale_zp.ptr<float>(m, b, h),
+                    o.params_row * sizeof(float));
+    });
+
+    if (m_offload_dir.empty()) {
+        o.data = std::move(record);
+    } else {
+        static std::atomic<uint64_t> counter{0};
+        static const auto instance_id = std::random_device{}();
+        o.path = std::filesystem::path(m_offload_dir) / ("ov_cpu_kv_cache_" + std::to_string(instance_id) + "_" +
+                                                           std::to_string(counter++) + ".bin");
+        std::ofstream file(o.path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(record.data()), static_cast<std::streamsize>(record.size()));
+        OPENVINO_ASSERT(file.good(), "Can't offload the state ", get_name(), " to ", o.path);
+    }
+
+    m_offloaded = std::move(offloaded);
+    m_internal_mem.reset();
+    m_hidden_state.reset();
+    m_scale_zp = PlainTensor();
+    m_internal_mem_max_size = 0;
+    m_hidden_state_max_size = 0;
+}
+
+void VariableStateKVcache::prefetch() {
+    if (m_offloaded && !m_offloaded->prefetched.valid()) {
+        m_offloaded->prefetched = std::async(std::launch::async, [offloaded = m_offloaded.get()] {
+            return offloaded->load();
+        });
+    }
+}
+
+void VariableStateKVcache::restore() {
+    restore_state();
+}
+
+void VariableStateKVcache::restore_state() const {
+    if (!m_offloaded) {
+        return;
+    }
+    auto restored = m_offloaded->prefetched.valid() ? m_offloaded->prefetched.get() : m_offloaded->load();
+    m_offloaded.reset();
+
+    m_internal_mem = restored.internal_mem;
+    m_hidden_state = restored.hidden_state;
+    m_scale_zp = restored.scale_zp;
+    m_internal_mem_max_size = m_internal_mem->getSize() / m_internal_mem->getDesc().getPrecision().size();
+    m_hidden_state_max_size = m_hidden_state->getSize() / sizeof(int32_t);
+}
+
 void VariableStateKVcache::reset_impl() {
-    // nothing to do
+    m_offloaded.reset();
 }
 
 void VariableStateKVcache::commit_impl() {
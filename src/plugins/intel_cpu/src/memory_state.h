@@ -30,6 +30,8 @@ public:
     virtual MemoryPtr output_mem() = 0;
     virtual MemoryDescPtr internal_desc() const = 0;
     virtual bool is_reset_state() const = 0;
+    // brings the offloaded state back to the working memory, it's called before the inference
+    virtual void restore() = 0;
 };
 
 class VariableStateBase : public IVariableState {
@@ -40,14 +42,17 @@ public:
     void set_state(const ov::SoPtr<ov::ITensor>& state) override final;
     ov::SoPtr<ov::ITensor> get_state() const override;
     void reset() override final;
+    void fork_from(const std::shared_ptr<ov::IVariableState>& source) override final;
     bool is_reset_state() const override final;
     void commit() override final;
+    void restore() override {}
 
 protected:
     virtual MemoryPtr internal_state_mem() const = 0;
     virtual void reset_impl() = 0;
     virtual void commit_impl() = 0;
     virtual void set_state_impl(const ov::SoPtr<ov::ITensor>& state);
+    virtual void fork_from_impl(const std::shared_ptr<ov::IVariableState>& source);
 
     static MemoryDescPtr to_static(const MemoryDescPtr& desc);
     static const dnnl::engine& get_engine();
@@ -124,10 +129,18 @@ public:
                          MemoryDescPtr external_desc,
                          BlockedMemoryDescPtr dense_internal_desc,
                          bool quant_by_channel,
-                         size_t group_size = 0);
+                         size_t group_size = 0,
+                         std::string offload_dir = {});
+    ~VariableStateKVcache() override;
 
     // ov::IVariableState
     ov::SoPtr<ov::ITensor> get_state() const override;
+    void truncate(size_t length) override;
+    void offload() override;
+    void prefetch() override;
+
+    // ov::intel_cpu::IVariableState
+    void restore() override;
 
     // ov::intel_cpu::VariableStateBase
     MemoryPtr input_mem() override;
@@ -165,21 +178,32 @@ public:
 private:
     // ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
+    // shares the buffers of the source state, they are copied on write by SDPA as the capacity of both is zeroed
+    void fork_from_impl(const std::shared_ptr<ov::IVariableState>& source) override;
     void reset_impl() override;
     void commit_impl() override;
 
-    MemoryPtr m_internal_mem;  // kv cache
-    MemoryPtr m_hidden_state;  // beam access table
-    size_t m_internal_mem_max_size = 0;
-    size_t m_hidden_state_max_size = 0;
+    // brings the offloaded state back, restoring doesn't change the value of the state, so the state members are
+    // mutable to restore it on the const access as well
+    void restore_state() const;
+
+    mutable MemoryPtr m_internal_mem;  // kv cache
+    mutable MemoryPtr m_hidden_state;  // beam access table
+    mutable size_t m_internal_mem_max_size = 0;
+    mutable size_t m_hidden_state_max_size = 0;
 
     // this desc stores the internal prc and axis permutation
     BlockedMemoryDescPtr m_dense_internal_desc;
 
     // for u8 kv cache: [B, H, L, 2], 0 for scale, 1 for zp
-    PlainTensor m_scale_zp;
+    mutable PlainTensor m_scale_zp;
     bool m_quant_by_channel = false;
     size_t m_group_size = 0;
+
+    // the state moved out of the working memory, in the host memory or in a file of the offload dir
+    struct Offloaded;
+    mutable std::unique_ptr<Offloaded> m_offloaded;
+    std::string m_offload_dir;
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
@@ -15,6 +15,7 @@
 #include <limits>
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -749,7 +750,7 @@ static void fetchRawMemory(const MemoryPtr& mem) {
     }
 }
 
-void Node::updateShapes() {
+void Node::updateShapes(std::optional<IShapeInfer::Result>* inferred) {
     OPENVINO_ASSERT(isDynamicNode(),
                     "Node::updateShapes() is called to a static shape node of type: ",
                     getTypeStr(),
@@ -757,9 +758,13 @@ void Node::updateShapes() {
                     getName());
     try {
         if (needShapeInfer()) {
-            auto result = shapeInfer();
-            if (ShapeInferStatus::success == result.status) {
-                redefineOutputMemory(result.dims);
+            std::optional<IShapeInfer::Result> local;
+            auto& result = inferred ? *inferred : local;
+            if (!result) {
+                result = shapeInfer();
+            }
+            if (ShapeInferStatus::success == result->status) {
+                redefineOutputMemory(result->dims);
             }
         } else {
             // guard check for internal dynamic nodes to avoid possible overestimation of the required memory size
@@ -841,10 +846,16 @@ void Node::executeDynamic(const dnnl::stream& strm, int numaId) {
 }
 
 bool Node::outputShapeDataDependency() const {
+    return outputShapeDataDependency([](const Node& parent) {
+        return parent.isConstant();
+    });
+}
+
+bool Node::outputShapeDataDependency(const std::function<bool(const Node&)>& isKnown) const {
     auto port_mask = shapeInference->get_port_mask();
     if (EMPTY_PORT_MASK != port_mask) {
         for (size_t i = 0; i < getParentEdges().size(); ++i) {
-            if (((port_mask & (1 << i)) != 0U) && !getParentEdgeAt(i)->getParent()->isConstant()) {
+            if (((port_mask & (1 << i)) != 0U) && !isKnown(*getParentEdgeAt(i)->getParent())) {
                 return true;
             }
         }
@@ -1172,8 +1183,7 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
 
     auto weightCache = context->getWeightsCache();
     if (weightCache != nullptr) {
-        const auto string_hash = DnnlExtensionUtils::computeWeightsStringHash(edgeMem, dstWeightDesc);
-        ptr = static_cast<MemoryPtr>(*weightCache->findOrCreate(string_hash, create));
+        ptr = static_cast<MemoryPtr>(*weightCache->findOrCreatePacked(getEngine(), edgeMem, dstWeightDesc, create));
     } else {
         ptr = create();
     }
@@ -15,6 +15,7 @@
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <openvino/itt.hpp>
+#include <optional>
 #include <shape_inference/shape_inference_cpu.hpp>
 #include <string>
 #include <type_traits>
@@ -480,6 +481,13 @@ public:
 
     virtual std::string getPrimitiveDescriptorType() const;
 
+    /**
+     * @brief Name of the executor implementation chosen by the autotuning, empty if the node doesn't use it
+     */
+    virtual std::string getAutotunedImplementation() const {
+        return {};
+    }
+
     PerfCount& PerfCounter() {
         return perfCounter;
     }
@@ -490,12 +498,21 @@ public:
     // but this requires changes in all the nodes. Since moving to a numa node right before an execute
     // is a temprorary solution, do it this way for now.
     void executeStatic(const dnnl::stream& strm, int numaId = -1);
-    void updateShapes();
+    /**
+     * @brief Infers and redefines the output shapes
+     * @param inferred if not null, the shape inference result is taken from it when it's set, otherwise the result is
+     * stored there
+     */
+    void updateShapes(std::optional<IShapeInfer::Result>* inferred = nullptr);
     void updateDynamicParams();
     void executeDynamic(const dnnl::stream& strm, int numaId = -1);
     virtual void redefineOutputMemory(const std::vector<VectorDims>& newOutputShapes);
     void redefineOutputMemory(size_t port, const VectorDims& new_output_shape) const;
     bool outputShapeDataDependency() const;
+    /**
+     * @brief Checks whether the output shapes depend on the data of the parents which are not accepted by \p isKnown
+     */
+    bool outputShapeDataDependency(const std::function<bool(const Node&)>& isKnown) const;
 
     virtual void initSupportedPrimitiveDescriptors();
 
@@ -11,6 +11,7 @@
 
 #include "cache/multi_cache.h"
 #include "common/primitive_hashing_utils.hpp"
+#include "dnnl_extension_utils.h"
 #include "utils/debug_capabilities.h"
 
 namespace ov::intel_cpu {
@@ -39,6 +40,10 @@ bool ReorderKey::operator==(const ReorderKey& rhs) const {
     return retVal;
 }
 
+size_t CacheFootprint<dnnl::reorder>::get(const dnnl::reorder& value) {
+    return sizeof(value) + DnnlExtensionUtils::query_memory_consumption(value.get_primitive_desc());
+}
+
 dnnl::reorder getReorderPrim(const MultiCachePtr& cache,
                              const dnnl::engine& engine,
                              const dnnl::memory::desc& src,
@@ -4,13 +4,24 @@
 
 #pragma once
 
+#include <cstddef>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <type_traits>
 
 #include "cache/multi_cache.h"
 
 namespace ov::intel_cpu {
 
+// oneDNN primitives don't keep any state between the executions, so the reorders are shared between the streams
+template <>
+struct SharedBetweenStreams<dnnl::reorder> : std::true_type {};
+
+template <>
+struct CacheFootprint<dnnl::reorder> {
+    static size_t get(const dnnl::reorder& value);
+};
+
 dnnl::reorder getReorderPrim(const MultiCachePtr& cache,
                              const dnnl::engine& engine,
                              const dnnl::memory::desc& src,
@@ -0,0 +1,318 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov::intel_cpu {
+
+namespace unique_kernel {
+
+// minimal number of the input elements per chunk
+constexpr size_t chunkGrain = size_t{1} << 15;
+
+inline size_t defaultChunks(size_t len) {
+    return std::max<size_t>(std::min<size_t>(len / chunkGrain, parallel_get_max_threads()), 1);
+}
+
+inline size_t chunkBegin(size_t len, size_t chunks, size_t chunk) {
+    if (chunk >= chunks) {
+        return len;
+    }
+    size_t begin = 0;
+    size_t end = 0;
+    splitter(len, chunks, chunk, begin, end);
+    return begin;
+}
+
+template <typename T>
+uint32_t hash(T value) {
+    static_assert(sizeof(T) <= sizeof(uint32_t), "Unexpected Unique data type");
+    uint32_t bits = 0;
+    if constexpr (std::is_floating_point_v<T>) {
+        // -0 and +0 are equal, so they have to be hashed in the same way
+        if (value == T{0}) {
+            value = T{0};
+        }
+        std::memcpy(&bits, &value, sizeof(T));
+    } else {
+        bits = static_cast<uint32_t>(value);
+    }
+    bits ^= bits >> 16;
+    bits *= 0x7feb352dU;
+    bits ^= bits >> 15;
+    bits *= 0x846ca68bU;
+    bits ^= bits >> 16;
+    return bits;
+}
+
+// turns the counts following the leading zero into the offsets
+inline void inclusiveScan(std::vector<size_t>& counts) {
+    std::partial_sum(counts.begin(), counts.end(), counts.begin());
+}
+
+template <typename T>
+size_t sortedUnique(const T* src,
+                    size_t len,
+                    size_t chunks,
+                    T* uniData,
+                    int32_t* first,
+                    int32_t* inToOut,
+                    int32_t* occurrences) {
+    struct Entry {
+        T value;
+        int32_t idx;
+    };
+    // the indices make the order strict, so the first entry of the run of the equal values is the first occurrence
+    const auto less = [](const Entry& a, const Entry& b) {
+        return a.value < b.value || (!(b.value < a.value) && a.idx < b.idx);
+    };
+
+    std::vector<Entry> entries(len);
+    parallel_for(chunks, [&](size_t c) {
+        const auto begin = chunkBegin(len, chunks, c);
+        const auto end = chunkBegin(len, chunks, c + 1);
+        for (auto i = begin; i < end; i++) {
+            entries[i] = {src[i], static_cast<int32_t>(i)};
+        }
+        std::sort(entries.begin() + begin, entries.begin() + end, less);
+    });
+
+    if (chunks > 1) {
+        std::vector<Entry> merged(len);
+        for (size_t width = 1; width < chunks; width *= 2) {
+            const auto pairs = (chunks + 2 * width - 1) / (2 * width);
+            parallel_for(pairs, [&](size_t p) {
+                const auto lo = chunkBegin(len, chunks, p * 2 * width);
+                const auto mid = chunkBegin(len, chunks, p * 2 * width + width);
+                const auto hi = chunkBegin(len, chunks, p * 2 * width + 2 * width);
+                std::merge(entries.begin() + lo,
+                           entries.begin() + mid,
+                           entries.begin() + mid,
+                           entries.begin() + hi,
+                           merged.begin() + lo,
+                           less);
+            });
+            std::swap(entries, merged);
+        }
+    }
+
+    const auto isRunStart = [&](size_t i) {
+        return i == 0 || !(entries[i - 1].value == entries[i].value);
+    };
+    std::vector<size_t> runs(chunks + 1, 0);
+    parallel_for(chunks, [&](size_t c) {
+        const auto end = chunkBegin(len, chunks, c + 1);
+        size_t count = 0;
+        for (auto i = chunkBegin(len, chunks, c); i < end; i++) {
+            count += isRunStart(i) ? 1 : 0;
+        }
+        runs[c + 1] = count;
+    });
+    inclusiveScan(runs);
+    const auto uniqueLen = runs[chunks];
+
+    std::vector<size_t> starts(occurrences ? uniqueLen : 0);
+    parallel_for(chunks, [&](size_t c) {
+        const auto end = chunkBegin(len, chunks, c + 1);
+        // id of the run of the previous entry
+        auto id = static_cast<int64_t>(runs[c]) - 1;
+        for (auto i = chunkBegin(len, chunks, c); i < end; i++) {
+            const auto& entry = entries[i];
+            if (isRunStart(i)) {
+                id++;
+                uniData[id] = entry.value;
+                if (first) {
+                    first[id] = entry.idx;
+                }
+                if (occurrences) {
+                    starts[id] = i;
+                }
+            }
+            if (inToOut) {
+                inToOut[entry.idx] = static_cast<int32_t>(id);
+            }
+        }
+    });
+    if (occurrences) {
+        parallel_for(uniqueLen, [&](size_t u) {
+            const auto end = u + 1 < uniqueLen ? starts[u + 1] : len;
+            occurrences[u] = static_cast<int32_t>(end - starts[u]);
+        });
+    }
+    return uniqueLen;
+}
+
+template <typename T>
+size_t unsortedUnique(const T* src,
+                      size_t len,
+                      size_t chunks,
+                      T* uniData,
+                      int32_t* first,
+                      int32_t* inToOut,
+                      int32_t* occurrences) {
+    // the number of the partitions matches the number of the chunks
+    const auto partitions = chunks;
+    const auto partitionOf = [partitions](T value) {
+        return static_cast<size_t>((static_cast<uint64_t>(hash(value)) * partitions) >> 32);
+    };
+
+    // the input indices are grouped by the partitions, the indices of a partition stay in the ascending order
+    std::vector<size_t> offsets(chunks * partitions + 1, 0);
+    parallel_for(chunks, [&](size_t c) {
+        std::vector<size_t> counts(partitions, 0);
+        const auto end = chunkBegin(len, chunks, c + 1);
+        for (auto i = chunkBegin(len, chunks, c); i < end; i++) {
+            counts[partitionOf(src[i])]++;
+        }
+        for (size_t p = 0; p < partitions; p++) {
+            offsets[p * chunks + c + 1] = counts[p];
+        }
+    });
+    inclusiveScan(offsets);
+    std::vector<int32_t> order(len);
+    parallel_for(chunks, [&](size_t c) {
+        std::vector<size_t> positions(partitions);
+        for (size_t p = 0; p < partitions; p++) {
+            positions[p] = offsets[p * chunks + c];
+        }
+        const auto end = chunkBegin(len, chunks, c + 1);
+        for (auto i = chunkBegin(len, chunks, c); i < end; i++) {
+            order[positions[partitionOf(src[i])]++] = static_cast<int32_t>(i);
+        }
+    });
+
+    struct Partition {
+        // first occurrences of the unique values of the partition
+        std::vector<int32_t> first;
+        std::vector<int32_t> occurrences;
+        std::vector<int32_t> ids;
+    };
+    std::vector<Partition> parts(partitions);
+    // unique value of the partition per position in order
+    std::vector<int32_t> localIds(len);
+    std::vector<uint8_t> isFirst(len, 0);
+    parallel_for(partitions, [&](size_t p) {
+        const auto begin = offsets[p * chunks];
+        const auto end = offsets[(p + 1) * chunks];
+        size_t capacity = 16;
+        while (capacity < 2 * (end - begin)) {
+            capacity *= 2;
+        }
+        const auto mask = capacity - 1;
+        // open addressing table of the unique values with the linear probing
+        std::vector<int32_t> table(capacity, -1);
+        auto& part = parts[p];
+        for (auto k = begin; k < end; k++) {
+            const auto idx = order[k];
+            const auto value = src[idx];
+            auto slot = hash(value) & mask;
+            while (table[slot] != -1 && !(src[part.first[table[slot]]] == value)) {
+                slot = (slot + 1) & mask;
+            }
+            if (table[slot] == -1) {
+                table[slot] = static_cast<int32_t>(part.first.size());
+                part.first.push_back(idx);
+                part.occurrences.push_back(0);
+                isFirst[idx] = 1;
+            }
+            localIds[k] = table[slot];
+            part.occurrences[table[slot]]++;
+        }
+    });
+
+    // the unique values are numbered in the order of the first occurrences
+    std::vector<size_t> firsts(chunks + 1, 0);
+    parallel_for(chunks, [&](size_t c) {
+        const auto end = chunkBegin(len, chunks, c + 1);
+        size_t count = 0;
+        for (auto i = chunkBegin(len, chunks, c); i < end; i++) {
+            count += isFirst[i];
+        }
+        firsts[c + 1] = count;
+    });
+    inclusiveScan(firsts);
+    std::vector<int32_t> globalIds(len);
+    parallel_for(chunks, [&](size_t c) {
+        auto id = static_cast<int32_t>(firsts[c]);
+        const auto end = chunkBegin(len, chunks, c + 1);
+        for (auto i = chunkBegin(len, chunks, c); i < end; i++) {
+            if (isFirst[i]) {
+                globalIds[i] = id++;
+            }
+        }
+    });
+
+    parallel_for(partitions, [&](size_t p) {
+        auto& part = parts[p];
+        part.ids.resize(part.first.size());
+        for (size_t u = 0; u < part.first.size(); u++) {
+            const auto idx = part.first[u];
+            const auto id = globalIds[idx];
+            part.ids[u] = id;
+            uniData[id] = src[idx];
+            if (first) {
+                first[id] = idx;
+            }
+            if (occurrences) {
+                occurrences[id] = part.occurrences[u];
+            }
+        }
+        if (inToOut) {
+            const auto end = offsets[(p + 1) * chunks];
+            for (auto k = offsets[p * chunks]; k < end; k++) {
+                inToOut[order[k]] = part.ids[localIds[k]];
+            }
+        }
+    });
+    return firsts[chunks];
+}
+
+}  // namespace unique_kernel
+
+/**
+ * @brief Unique elements of the flattened input of op::v10::Unique.
+ *
+ * The sorted mode sorts the chunks of the (value, index) pairs in parallel and merges them pairwise. The unsorted mode
+ * groups the input by the hash partitions of the values, which are deduplicated in parallel by the open addressing
+ * tables, the unique values are numbered in the order of their first occurrences. Any of the index outputs may be null.
+ *
+ * @param src input data
+ * @param len number of the input elements
+ * @param sorted whether the unique values are sorted in the ascending order
+ * @param uniData unique values, the buffer holds len elements
+ * @param first indices of the first occurrences of the unique values
+ * @param inToOut indices of the unique values per input element
+ * @param occurrences numbers of the occurrences of the unique values
+ * @param chunks number of the parallel chunks, it's derived from the input length by default
+ * @return number of the unique values
+ */
+template <typename T>
+size_t flattenedUnique(const T* src,
+                       size_t len,
+                       bool sorted,
+                       T* uniData,
+                       int32_t* first,
+                       int32_t* inToOut,
+                       int32_t* occurrences,
+                       size_t chunks = 0) {
+    if (len == 0) {
+        return 0;
+    }
+    chunks = chunks == 0 ? unique_kernel::defaultChunks(len) : std::min(chunks, len);
+    return sorted ? unique_kernel::sortedUnique(src, len, chunks, uniData, first, inToOut, occurrences)
+                  : unique_kernel::unsortedUnique(src, len, chunks, uniData, first, inToOut, occurrences);
+}
+
+}  // namespace ov::intel_cpu
@@ -42,6 +42,9 @@ public:
     int registerToAllocationContext(int offset, AllocationContext& context) override;
     void createPrimitive() override;
     bool created() const override;
+    std::string getAutotunedImplementation() const override {
+        return m_executor ? m_executor->autotunedImplementation() : std::string{};
+    }
     bool canBeInPlace() const override {
         return false;
     }
@@ -15,6 +15,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <initializer_list>
 #include <map>
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
@@ -783,6 +784,20 @@ DnnlShapeAgnosticDataPtr DnnlConvolutionPrimitive::createShapeAgnosticData(const
     return std::make_shared<DnnlShapeAgnosticData>(postOpData.front());
 }
 
+size_t DnnlConvolutionPrimitive::footprint() const {
+    size_t bytes = sizeof(*this);
+    if (m_primDesc) {
+        bytes += DnnlExtensionUtils::query_memory_consumption(m_primDesc.get());
+    }
+    for (const auto* reorders : {&m_intermediateReorders.m_inputReorders, &m_intermediateReorders.m_outputReorders}) {
+        for (const auto& reorder : *reorders) {
+            bytes += sizeof(reorder) +
+                     DnnlExtensionUtils::query_memory_consumption(reorder.second.m_reorder.get_primitive_desc());
+        }
+    }
+    return bytes;
+}
+
 void DnnlConvolutionPrimitive::execute(dnnl_primitive_args& primArgs) {
     if (m_intermediateReorders.empty()) {  // fast path
         m_prim.execute(m_stream, primArgs);
@@ -9,9 +9,11 @@
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
+#include "cache/shared_cache.h"
 #include "memory_desc/dnnl_memory_desc.h"
 #include "nodes/executors/convolution_config.hpp"
 #include "nodes/executors/dnnl/dnnl_aliases.hpp"
@@ -92,6 +94,9 @@ public:
         return m_implType;
     }
 
+    // approximate memory owned by the primitive, see CacheFootprint
+    [[nodiscard]] size_t footprint() const;
+
     static DnnlMemoryDescPtr makeTransposedWeightDescriptor(const DnnlMemoryDescPtr& srcDesc,
                                                             const DnnlMemoryDescPtr& dstDesc,
                                                             const ConvAttrs& attrs);
@@ -138,4 +143,18 @@ private:
 
 using DnnlConvExecutorPtr = std::shared_ptr<DnnlConvolutionPrimitive>;
 
+#if OV_THREAD != OV_THREAD_TBB_ADAPTIVE
+// the primitive takes the scratchpad from the caller, so it may be executed by several streams at once. With the
+// adaptive TBB threading the oneDNN stream of the primitive is bound to the thread pool of the building stream instead
+template <>
+struct SharedBetweenStreams<std::shared_ptr<DnnlConvolutionPrimitive>> : std::true_type {};
+#endif
+
+template <>
+struct CacheFootprint<DnnlConvolutionPrimitive> {
+    static size_t get(const DnnlConvolutionPrimitive& value) {
+        return value.footprint();
+    }
+};
+
 }  // namespace ov::intel_cpu
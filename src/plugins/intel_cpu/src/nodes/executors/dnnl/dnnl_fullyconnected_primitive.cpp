@@ -504,6 +504,10 @@ DnnlFCPrimitive::DnnlFCPrimitive(const Key& key,
       m_scratchPadDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.scratchpad_desc())),
       m_prim(primitive(m_primDesc)) {}
 
+size_t DnnlFCPrimitive::footprint() const {
+    return sizeof(*this) + (m_primDesc ? DnnlExtensionUtils::query_memory_consumption(m_primDesc.get()) : 0);
+}
+
 void DnnlFCPrimitive::execute(const dnnl_primitive_args& primArgs) const {
     m_prim.execute(m_stream, primArgs);
 }
@@ -8,9 +8,11 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <type_traits>
 #include <vector>
 
 #include "config.h"
+#include "cache/shared_cache.h"
 #include "memory_desc/dnnl_memory_desc.h"
 #include "nodes/executors/dnnl/dnnl_aliases.hpp"
 #include "nodes/executors/dnnl/dnnl_shape_agnostic_data.hpp"
@@ -65,6 +67,9 @@ public:
         return m_implType;
     }
 
+    // approximate memory owned by the primitive, see CacheFootprint
+    [[nodiscard]] size_t footprint() const;
+
     static DnnlShapeAgnosticDataPtr createShapeAgnosticData(const FCAttrs& attrs,
                                                             const MemoryArgs& memory,
                                                             const ExecutorContext::CPtr& context,
@@ -96,4 +101,18 @@ private:
 
 using DnnlFCPrimitivePtr = std::shared_ptr<DnnlFCPrimitive>;
 
+#if OV_THREAD != OV_THREAD_TBB_ADAPTIVE
+// the primitive takes the scratchpad from the caller, so it may be executed by several streams at once. With the
+// adaptive TBB threading the oneDNN stream of the primitive is bound to the thread pool of the building stream instead
+template <>
+struct SharedBetweenStreams<std::shared_ptr<DnnlFCPrimitive>> : std::true_type {};
+#endif
+
+template <>
+struct CacheFootprint<DnnlFCPrimitive> {
+    static size_t get(const DnnlFCPrimitive& value) {
+        return value.footprint();
+    }
+};
+
 }  // namespace ov::intel_cpu
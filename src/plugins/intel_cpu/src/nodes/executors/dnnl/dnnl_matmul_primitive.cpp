@@ -629,6 +629,10 @@ DnnlMatMulPrimitive::DnnlMatMulPrimitive(const Key& key,
       m_scratchPadDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.scratchpad_desc())),
       m_prim(primitive(m_primDesc)) {}
 
+size_t DnnlMatMulPrimitive::footprint() const {
+    return sizeof(*this) + (m_primDesc ? DnnlExtensionUtils::query_memory_consumption(m_primDesc.get()) : 0);
+}
+
 void DnnlMatMulPrimitive::execute(const dnnl_primitive_args& primArgs) const {
     m_prim.execute(m_stream, primArgs);
 }
@@ -8,8 +8,10 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <type_traits>
 #include <vector>
 
+#include "cache/shared_cache.h"
 #include "memory_desc/dnnl_memory_desc.h"
 #include "nodes/executors/dnnl/dnnl_aliases.hpp"
 #include "nodes/executors/dnnl/dnnl_shape_agnostic_data.hpp"
@@ -68,6 +70,9 @@ public:
         return m_implType;
     }
 
+    // approximate memory owned by the primitive, see CacheFootprint
+    [[nodiscard]] size_t footprint() const;
+
     static bool useWeightsDecompressionImpl(ov::element::Type inputType, ov::element::Type weightsType);
 
     static DnnlShapeAgnosticDataPtr createShapeAgnosticData(const MatMulAttrs& attrs,
@@ -102,4 +107,18 @@ private:
 
 using DnnlMatMulPrimitivePtr = std::shared_ptr<DnnlMatMulPrimitive>;
 
+#if OV_THREAD != OV_THREAD_TBB_ADAPTIVE
+// the primitive takes the scratchpad from the caller, so it may be executed by several streams at once. With the
+// adaptive TBB threading the oneDNN stream of the primitive is bound to the thread pool of the building stream instead
+template <>
+struct SharedBetweenStreams<std::shared_ptr<DnnlMatMulPrimitive>> : std::true_type {};
+#endif
+
+template <>
+struct CacheFootprint<DnnlMatMulPrimitive> {
+    static size_t get(const DnnlMatMulPrimitive& value) {
+        return value.footprint();
+    }
+};
+
 }  // namespace ov::intel_cpu
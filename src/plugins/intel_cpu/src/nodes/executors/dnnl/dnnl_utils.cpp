@@ -15,7 +15,6 @@
 
 #include "cache/multi_cache.h"
 #include "cpu_memory.h"
-#include "dnnl_extension_utils.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_memory_desc.h"
 #include "nodes/executors/executor.hpp"
@@ -105,9 +104,7 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
 
     MemoryPtr ptr;
     if (globalWeightCache && dnnl::memory::format_kind::blocked == dstWeightDesc->getDnnlDesc().get_format_kind()) {
-        ptr = MemoryPtr(
-            *globalWeightCache->findOrCreate(DnnlExtensionUtils::computeWeightsStringHash(weightsMem, dstWeightDesc),
-                                             create));
+        ptr = MemoryPtr(*globalWeightCache->findOrCreatePacked(eng, weightsMem, dstWeightDesc, create));
     } else {
         ptr = create();
     }
@@ -19,6 +19,7 @@
 #include "dnnl_scratch_pad.h"
 #include "graph_context.h"
 #include "memory_arguments.hpp"
+#include "nodes/executors/executor_autotuner.hpp"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/visibility.hpp"
@@ -61,7 +62,8 @@ public:
           implPriorities(std::move(implPriorities)),
           privateWeighCache(std::move(privateWeighCache)),
           numNumaNodes(graphContext->getNumNumaNodes()),
-          cpuParallel(graphContext->getCpuParallel()) {
+          cpuParallel(graphContext->getCpuParallel()),
+          executorAutotuner(graphContext->getExecutorAutotuner()) {
         auto cpuStreamsExecutor = graphContext->getCPUStreamExecutor();
         curNumaNodeId = std::max(0, cpuStreamsExecutor ? cpuStreamsExecutor->get_numa_node_id() : curNumaNodeId);
     }
@@ -100,6 +102,10 @@ public:
         return cpuParallel->get_thread_pool();
     }
 
+    [[nodiscard]] const ExecutorAutotuner::Ptr& getExecutorAutotuner() const {
+        return executorAutotuner;
+    }
+
 private:
     // weak_ptr is required to avoid cycle dependencies with MultiCache
     // since ExecutorContext is stored in Executor itself
@@ -113,6 +119,7 @@ private:
     int numNumaNodes;
     int curNumaNodeId = -1;
     std::shared_ptr<CpuParallel> cpuParallel;
+    ExecutorAutotuner::Ptr executorAutotuner;
 };
 
 class ExecutorFactoryLegacy {
@@ -151,6 +158,10 @@ public:
         OPENVINO_THROW_NOT_IMPLEMENTED("This version of the 'execute' method is not implemented by executor");
     }
     [[nodiscard]] virtual impl_desc_type implType() const = 0;
+    // name of the implementation chosen by the executor autotuner, empty if it is not used
+    [[nodiscard]] virtual std::string autotunedImplementation() const {
+        return {};
+    }
     virtual void moveMemToNumaNode([[maybe_unused]] int numaID) {
         OPENVINO_THROW_NOT_IMPLEMENTED("This version of the 'moveMemToNumaNode' method is not implemented by executor");
     }
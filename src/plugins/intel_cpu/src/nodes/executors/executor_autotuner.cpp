@@ -0,0 +1,154 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/executors/executor_autotuner.hpp"
+
+#include <any>
+#include <common/primitive_hashing_utils.hpp>
+#include <common/utils.hpp>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "nodes/executors/convolution_config.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/matmul_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "post_ops.hpp"
+
+namespace ov::intel_cpu {
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::primitive_hashing;
+
+namespace {
+
+// the kinds of the post ops and whether their data is per tensor or per channel
+size_t hashPostOps(size_t seed, const PostOps& postOps) {
+    for (const auto& postOp : postOps) {
+        if (const auto* activation = std::any_cast<ActivationPostOp>(&postOp)) {
+            seed = hash_combine(seed, 1);
+            seed = hash_combine(seed, static_cast<size_t>(activation->type()));
+        } else if (const auto* scaleShift = std::any_cast<ScaleShiftPostOp>(&postOp)) {
+            seed = hash_combine(seed, 2);
+            seed = hash_combine(seed, static_cast<size_t>(scaleShift->type()));
+            seed = hash_combine(seed, scaleShift->scales().size());
+            seed = hash_combine(seed, scaleShift->shifts().size());
+        } else if (const auto* fakeQuantize = std::any_cast<FakeQuantizePostOp>(&postOp)) {
+            seed = hash_combine(seed, 3);
+            seed = hash_combine(seed, static_cast<size_t>(fakeQuantize->type()));
+            seed = hash_combine(seed, fakeQuantize->levels());
+            seed = hash_combine(seed, fakeQuantize->cropLow().size());
+            seed = hash_combine(seed, fakeQuantize->inputScale().size());
+            seed = hash_combine(seed, fakeQuantize->outputScale().size());
+            seed = hash_combine(seed, fakeQuantize->outputShift().size());
+        } else if (const auto* depthwise = std::any_cast<DepthwiseConvolutionPostOp>(&postOp)) {
+            seed = hash_combine(seed, 4);
+            seed = get_vector_hash(seed, depthwise->kernel());
+            seed = get_vector_hash(seed, depthwise->strides());
+        } else if (const auto* sum = std::any_cast<SumPostOp>(&postOp)) {
+            seed = hash_combine(seed, 5);
+            seed = hash_combine(seed, static_cast<size_t>(sum->dataType()));
+            seed = hash_combine(seed, sum->zeroPoint() != 0);
+        } else {
+            seed = hash_combine(seed, 0);
+        }
+    }
+    return seed;
+}
+
+}  // namespace
+
+ExecutorAutotuner::ExecutorAutotuner(bool tune, Decisions decisions)
+    : m_tune(tune),
+      m_decisions(std::move(decisions)) {}
+
+std::optional<std::string> ExecutorAutotuner::find(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_decisions.find(key);
+    if (found == m_decisions.end()) {
+        return std::nullopt;
+    }
+    return found->second;
+}
+
+std::string ExecutorAutotuner::record(const std::string& key, const std::string& implementation) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // the streams tune the same key concurrently, the first decision is kept to be consistent across the streams
+    return m_decisions.emplace(key, implementation).first->second;
+}
+
+ExecutorAutotuner::Decisions ExecutorAutotuner::decisions() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_decisions;
+}
+
+size_t ExecutorAutotuner::hashAttrs(const FCAttrs& attrs) {
+    size_t seed = 0;
+    seed = hash_combine(seed, attrs.weightsNonTransposed);
+    seed = hash_combine(seed, attrs.sparseWeights);
+    seed = hash_combine(seed, attrs.dynamicQuantizationGroupSize);
+    seed = hash_combine(seed, attrs.constantWeights);
+    seed = hash_combine(seed, static_cast<size_t>(attrs.modelType));
+    return hashPostOps(seed, attrs.postOps);
+}
+
+size_t ExecutorAutotuner::hashAttrs(const MatMulAttrs& attrs) {
+    size_t seed = 0;
+    seed = hash_combine(seed, attrs.transposeA);
+    seed = hash_combine(seed, attrs.transposeB);
+    seed = hash_combine(seed, attrs.withBias);
+    seed = hash_combine(seed, attrs.weightsNonTransposed);
+    seed = hash_combine(seed, attrs.sparseWeights);
+    seed = hash_combine(seed, attrs.constantWeights);
+    seed = hash_combine(seed, attrs.fcSemantic);
+    seed = hash_combine(seed, attrs.dynamicQuantizationGroupSize);
+    seed = hash_combine(seed, attrs.dqScales.size());
+    return hashPostOps(seed, attrs.postOps);
+}
+
+size_t ExecutorAutotuner::hashAttrs(const ConvAttrs& attrs) {
+    size_t seed = 0;
+    seed = get_vector_hash(seed, attrs.stride);
+    seed = get_vector_hash(seed, attrs.dilation);
+    seed = get_vector_hash(seed, attrs.paddingL);
+    seed = get_vector_hash(seed, attrs.paddingR);
+    seed = hash_combine(seed, static_cast<size_t>(attrs.autoPadding));
+    seed = hash_combine(seed, attrs.withBias);
+    seed = hash_combine(seed, attrs.weightsNonTransposed);
+    seed = hash_combine(seed, attrs.isGrouped);
+    seed = hash_combine(seed, attrs.isGraphQuantized);
+    seed = hash_combine(seed, attrs.fcSemantic);
+    seed = hash_combine(seed, attrs.constantWeights);
+    seed = hash_combine(seed, static_cast<size_t>(attrs.inputZeroPointsType));
+    seed = hash_combine(seed, attrs.dqScales.size());
+    return hashPostOps(seed, attrs.postOps);
+}
+
+std::string ExecutorAutotuner::makeKey(const std::string& prefix, size_t attrsHash, const MemoryArgs& memory) {
+    std::ostringstream key;
+    key << prefix << ";" << std::hex << attrsHash << std::dec;
+    // the memory arguments are unordered
+    const std::map<int, MemoryPtr> ordered(memory.begin(), memory.end());
+    for (const auto& [id, mem] : ordered) {
+        if (!mem || mem->getDesc().empty() || !mem->getDesc().isDefined()) {
+            continue;
+        }
+        key << ";" << id << ":" << mem->getDesc().getPrecision().get_type_name();
+        for (const auto dim : mem->getStaticDims()) {
+            size_t bucket = dim == 0 ? 0 : 1;
+            while (bucket < dim) {
+                bucket <<= 1;
+            }
+            key << "_" << bucket;
+        }
+    }
+    return key.str();
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "nodes/executors/memory_arguments.hpp"
+
+namespace ov::intel_cpu {
+
+struct FCAttrs;
+struct MatMulAttrs;
+struct ConvAttrs;
+
+/**
+ * @brief Implementations of the executors chosen by timing the eligible implementations on the actual shapes.
+ *
+ * The decisions are shared by the streams of a compiled model and are stored in the exported blob, so the import
+ * doesn't repeat the timing. A decision is keyed by the operation, the candidate implementations, the attributes and
+ * the precisions and the shape buckets of the executor memory, so the identical layers share it.
+ */
+class ExecutorAutotuner {
+public:
+    using Ptr = std::shared_ptr<ExecutorAutotuner>;
+    using Decisions = std::map<std::string, std::string>;
+
+    // timed executions of each candidate, the best one is taken
+    static constexpr size_t repetitions = 3;
+
+    /**
+     * @param tune whether the implementations are timed for the keys without a decision, otherwise only the given
+     * decisions are applied
+     * @param decisions decisions of the imported compiled model
+     */
+    explicit ExecutorAutotuner(bool tune, Decisions decisions = {});
+
+    [[nodiscard]] bool tune() const {
+        return m_tune;
+    }
+
+    [[nodiscard]] std::optional<std::string> find(const std::string& key) const;
+
+    /**
+     * @brief Records the decision unless there is one for \p key already, returns the kept decision
+     */
+    std::string record(const std::string& key, const std::string& implementation);
+
+    [[nodiscard]] Decisions decisions() const;
+
+    /**
+     * @brief Makes the decision key from \p prefix (the operation and the candidates), \p attrsHash and the precisions
+     * and the dims of \p memory. The dims are rounded up to a power of two, so the close dynamic shapes share a
+     * decision.
+     */
+    static std::string makeKey(const std::string& prefix, size_t attrsHash, const MemoryArgs& memory);
+
+    /**
+     * @brief Hash of the attributes the performance of the implementations depends on: the flags and the kinds of the
+     * post ops. The values of the scales and the shifts are not hashed, so the layers differing only in them share a
+     * decision.
+     */
+    static size_t hashAttrs(const FCAttrs& attrs);
+    static size_t hashAttrs(const MatMulAttrs& attrs);
+    static size_t hashAttrs(const ConvAttrs& attrs);
+
+    // the other operations are not autotuned
+    template <typename Attrs>
+    static size_t hashAttrs([[maybe_unused]] const Attrs& attrs) {
+        return 0;
+    }
+
+private:
+    const bool m_tune;
+    mutable std::mutex m_mutex;
+    Decisions m_decisions;
+};
+
+}  // namespace ov::intel_cpu
@@ -98,6 +98,10 @@ public:
             return !impl.get().createOptimalConfig(config).has_value();
         };
 
+        // the autotuner chooses among all the implementations, so the lower priority ones are kept as well
+        const bool autotuned =
+            m_context->getExecutorAutotuner() && VariableExecutor<Attrs>::autotunable(m_suitableImplementations);
+
         // Filter out implementations that still require changes in configuration
         for (const auto& impl : m_suitableImplementations) {
             auto config = createConfig(memory, m_attrs);
@@ -108,7 +112,7 @@ public:
 
             implementations.push_back(impl);
 
-            if (impl.get().shapeAgnostic() &&
+            if (impl.get().shapeAgnostic() && !autotuned &&
                 impl.get().type() != ExecutorType::Acl) {  // @todo fix acl_eltwise precision mapping)
                 break;  // there is no way an implementation with a lower priority will be chosen
             }
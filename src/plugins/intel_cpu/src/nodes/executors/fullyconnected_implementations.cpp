@@ -43,6 +43,10 @@
 #    include "onednn/iml_type_mapper.h"
 #endif
 
+#if defined(OPENVINO_ARCH_X86_64)
+#    include "nodes/executors/x64/sparse_fc.hpp"
+#endif
+
 #if defined(OV_CPU_WITH_KLEIDIAI)
 #    include "nodes/executors/kleidiai/kleidiai_mm.hpp"
 #endif
@@ -191,6 +195,25 @@ struct CreateOptimalConfigDefault {
 template <>
 const std::vector<ExecutorImplementation<FCAttrs>>& getImplementations() {
     static const std::vector<ExecutorImplementation<FCAttrs>> fullyconnectedImplementations {
+        OV_CPU_INSTANCE_X64(
+            "fullyconnected_sparse_x64",
+            ExecutorType::Jit,
+            OperationType::FullyConnected,
+            // supports
+            [](const FCConfig& config) -> bool {
+                // the f32 sparse weights only, the int8 ones are decompressed by oneDNN
+                VERIFY(!noSparseDecompression(config), "dense weights are not supported");
+                VERIFY(noPostOps(config), UNSUPPORTED_POST_OPS);
+                VERIFY(all_of(f32, srcType(config), weiType(config), dstType(config)), UNSUPPORTED_SRC_PRECISIONS);
+                VERIFY(!hasBias(config) || biaType(config) == f32, UNSUPPORTED_BIAS_PRECISIONS);
+                VERIFY(weiRank(config) == 2U, UNSUPPORTED_WEI_RANK);
+                VERIFY(SparseFCExecutor::supports(config), UNSUPPORTED_BY_EXECUTOR);
+                return true;
+            },
+            HasNoOptimalConfig<FCAttrs>{},
+            AcceptsAnyShape<FCAttrs>,
+            CreateDefault<SparseFCExecutor, FCAttrs>{}
+            )
         OV_CPU_INSTANCE_MLAS_X64(
             "fullyconnected_mlas",
             ExecutorType::Mlas,
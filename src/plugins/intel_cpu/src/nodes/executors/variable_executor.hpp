@@ -4,18 +4,26 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
 #include <functional>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "executor.hpp"
 #include "executor_implementation.hpp"
+#include "nodes/executors/executor_autotuner.hpp"
 #include "nodes/executors/graph_emitter.hpp"
 #include "nodes/executors/memory_arguments.hpp"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
+#include "utils/general_utils.h"
 
 namespace ov::intel_cpu {
 
@@ -23,6 +31,8 @@ namespace ov::intel_cpu {
  * A stateful (variable) executor
  * Contains two or more executors.
  * Switches between the executors based on provided Memory (more precisely based on in / out shapes)
+ * With the executor autotuner the fastest of the implementations accepting the shapes is chosen instead of the first
+ * one
  */
 template <typename Attrs>
 class VariableExecutor : public Executor {
@@ -38,6 +48,9 @@ public:
           m_context(std::move(context)),
           m_suitableImplementations(std::move(suitableImplementations)),
           m_executors(m_suitableImplementations.size()) {
+        if (autotunable(m_suitableImplementations)) {
+            m_autotuner = m_context->getExecutorAutotuner();
+        }
         if (init) {
             const size_t implId = select(memory, 0);
             m_executors[implId] = create(implId, memory);
@@ -46,6 +59,10 @@ public:
     }
 
     bool update(const MemoryArgs& memory) override {
+        if (m_autotuner && updateAutotuned(memory)) {
+            return true;
+        }
+
         for (auto implId = select(memory, 0); implId < m_suitableImplementations.size();
              implId = select(memory, ++implId)) {
             if (!m_executors[implId]) {
@@ -65,6 +82,9 @@ public:
     }
 
     void execute(const MemoryArgs& memory) override {
+        if (!m_pendingKey.empty()) {
+            tune(memory);
+        }
         m_executors[m_implId]->execute(memory);
     }
 
@@ -76,7 +96,145 @@ public:
         m_executors[m_implId]->moveMemToNumaNode(numaID);
     }
 
+    [[nodiscard]] std::string autotunedImplementation() const override {
+        return m_autotuner ? m_suitableImplementations[m_implId].get().name() : std::string{};
+    }
+
+    static bool autotunable(const std::vector<ExecutorImplementationRef>& implementations) {
+        return !implementations.empty() &&
+               any_of(implementations.front().get().operationType(),
+                      OperationType::FullyConnected,
+                      OperationType::MatMul,
+                      OperationType::Convolution);
+    }
+
 private:
+    /**
+     * Chooses the implementation by the autotuner decision for the shapes. Without a decision the first implementation
+     * accepting the shapes is used and all of them are timed on the first execution, when the memory holds the actual
+     * data. Returns false if there is nothing to choose from, so the regular selection is applied.
+     */
+    bool updateAutotuned(const MemoryArgs& memory) {
+        m_pendingKey.clear();
+        m_candidates.clear();
+        std::string prefix;
+        for (size_t implId = 0; implId < m_suitableImplementations.size(); implId++) {
+            const auto& implementation = m_suitableImplementations[implId].get();
+            if (implementation.acceptsShapes(m_attrs, memory)) {
+                m_candidates.push_back(implId);
+                prefix += std::string(prefix.empty() ? "" : ",") + implementation.name();
+            }
+        }
+        if (m_candidates.size() < 2) {
+            return false;
+        }
+
+        const auto key = ExecutorAutotuner::makeKey(prefix, ExecutorAutotuner::hashAttrs(m_attrs), memory);
+        if (const auto decision = m_autotuner->find(key)) {
+            for (const auto implId : m_candidates) {
+                if (*decision == m_suitableImplementations[implId].get().name() && prepare(implId, memory)) {
+                    m_implId = implId;
+                    return true;
+                }
+            }
+            return false;
+        }
+        if (!m_autotuner->tune()) {
+            return false;
+        }
+
+        for (const auto implId : m_candidates) {
+            if (prepare(implId, memory)) {
+                m_implId = implId;
+                m_pendingKey = key;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Times the candidate implementations on the memory of the execution and records the fastest one
+     */
+    void tune(const MemoryArgs& memory) {
+        const auto key = std::move(m_pendingKey);
+        m_pendingKey.clear();
+
+        // the timed executions overwrite the destination, which may keep the input of the fused sum or of the in-place
+        // execution, so it is restored afterwards
+        const auto& dst = memory.at(ARG_DST);
+        std::vector<uint8_t> dstBackup(dst->getSize());
+        if (!dstBackup.empty()) {
+            std::memcpy(dstBackup.data(), dst->getData(), dstBackup.size());
+        }
+
+        auto bestTime = std::chrono::nanoseconds::max();
+        size_t bestId = m_implId;
+        for (const auto implId : m_candidates) {
+            try {
+                if (!prepare(implId, memory)) {
+                    m_executors[implId] = nullptr;
+                    continue;
+                }
+                const auto time = measure(*m_executors[implId], memory);
+                if (time < bestTime) {
+                    bestTime = time;
+                    bestId = implId;
+                }
+            } catch (const std::exception&) {
+                // the implementation which is not chosen by the priority may fail on these shapes, not only with
+                // ov::Exception (i.e. dnnl::error or std::bad_alloc of a third party library)
+                m_executors[implId] = nullptr;
+            }
+        }
+
+        if (!dstBackup.empty()) {
+            std::memcpy(dst->getData(), dstBackup.data(), dstBackup.size());
+        }
+        if (bestTime == std::chrono::nanoseconds::max()) {
+            // nothing could be timed, the implementation chosen by the priority is kept without the decision
+            OPENVINO_ASSERT(prepare(m_implId, memory),
+                            "Failed to prepare the implementation: ",
+                            m_suitableImplementations[m_implId].get().name());
+            return;
+        }
+
+        // another stream could record its decision first, it is followed to keep the streams consistent
+        const auto decision = m_autotuner->record(key, m_suitableImplementations[bestId].get().name());
+        for (const auto implId : m_candidates) {
+            if (decision == m_suitableImplementations[implId].get().name() && m_executors[implId]) {
+                bestId = implId;
+            }
+        }
+        // the other executors are recreated if they are chosen for other shapes
+        for (const auto implId : m_candidates) {
+            if (implId != bestId) {
+                m_executors[implId] = nullptr;
+            }
+        }
+        m_implId = bestId;
+    }
+
+    bool prepare(const size_t implId, const MemoryArgs& memory) {
+        if (!m_executors[implId]) {
+            m_executors[implId] = create(implId, memory);
+        }
+        return m_executors[implId] && m_executors[implId]->update(memory);
+    }
+
+    static std::chrono::nanoseconds measure(Executor& executor, const MemoryArgs& memory) {
+        // the first execution isn't timed, since it may include the lazy initialization
+        executor.execute(memory);
+        auto best = std::chrono::nanoseconds::max();
+        for (size_t i = 0; i < ExecutorAutotuner::repetitions; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            executor.execute(memory);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed));
+        }
+        return best;
+    }
+
     [[nodiscard]] size_t select(const MemoryArgs& memory, const size_t startIdx) const {
         OPENVINO_ASSERT(startIdx < m_suitableImplementations.size(),
                         "Failed to find an implementation since start indx: ",
@@ -111,6 +269,10 @@ private:
     // executors cache
     std::vector<ExecutorPtr> m_executors;
     size_t m_implId = 0;
+    ExecutorAutotuner::Ptr m_autotuner = nullptr;
+    // implementations accepting the current shapes and the key of the decision to be tuned on the next execution
+    std::vector<size_t> m_candidates;
+    std::string m_pendingKey;
 };
 
 }  // namespace ov::intel_cpu
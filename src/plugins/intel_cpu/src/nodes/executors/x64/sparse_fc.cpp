@@ -0,0 +1,185 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_fc.hpp"
+
+#include <algorithm>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+
+#include "cpu_memory.h"
+#include "cpu_parallel.hpp"
+#include "cpu_types.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/kernels/x64/sparse_fc.hpp"
+#include "nodes/kernels/x64/sparse_fc_weights.hpp"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+using namespace dnnl::impl::cpu::x64;
+using namespace ov::element;
+
+// output channels processed by a single task
+static constexpr size_t channelsBlock = 32;
+
+static Dim batchDim(const VectorDims& dims) {
+    return std::accumulate(dims.begin(), dims.end() - 1, 1, std::multiplies<>());
+}
+
+static MemoryPtr prepareWeightMemory(const MemoryPtr& weightsMemory, const ExecutorContext::CPtr& context) {
+    DEBUG_LOG("SparseFCExecutor: pack weights");
+    const auto& wgtDims = weightsMemory->getStaticDims();
+    const Dim K = wgtDims.back();
+    const Dim N = batchDim(wgtDims);
+
+    auto create = [&]() {
+        const auto* weightPtr = weightsMemory->getDataAs<const float>();
+        const auto packedSize = SparseFCWeights::packedSize(weightPtr, N, K);
+        MemoryPtr _ptr =
+            std::make_shared<Memory>(context->getEngine(), CpuBlockedMemoryDesc(i8, intel_cpu::Shape{packedSize}));
+        DEBUG_LOG("SparseFCExecutor: cache miss, perform packing");
+        SparseFCWeights::pack(weightPtr, N, K, _ptr->getData());
+        return _ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        std::string format = "sparse_fc_" + std::to_string(N) + "_" + std::to_string(K);
+        const std::string string_hash = format + "_" + std::to_string(weightsMemory->getSize()) + "_" +
+                                        std::to_string(reinterpret_cast<uint64_t>(weightsMemory->getData()));
+        DEBUG_LOG("SparseFCExecutor: findOrCreate, string_hash: ", string_hash);
+        return MemoryPtr(*weightCache->findOrCreate(string_hash, create));
+    }
+
+    DEBUG_LOG("SparseFCExecutor: Weights cache is not available");
+    return create();
+}
+
+bool SparseFCExecutor::supports(const FCConfig& config) {
+    const auto& biaDesc = config.descs.at(ARG_BIAS);
+    return supports(config.attrs,
+                    biaDesc->empty() ? VectorDims{} : biaDesc->getShape().getStaticDims(),
+                    config.descs.at(ARG_DST)->getShape().getDims());
+}
+
+bool SparseFCExecutor::supports(const FCAttrs& attrs, const VectorDims& biasDims, const VectorDims& dstDims) {
+    if (!mayiuse(avx2)) {
+        DEBUG_LOG("SparseFCExecutor: AVX2 is not available");
+        return false;
+    }
+
+    if (attrs.weightsNonTransposed) {
+        DEBUG_LOG("SparseFCExecutor: only [N, K] weights are supported");
+        return false;
+    }
+
+    if (!biasDims.empty()) {
+        const bool isByChannel = biasDims.back() == dstDims.back() &&
+                                 std::all_of(biasDims.begin(), biasDims.end() - 1, [](const Dim dim) {
+                                     return dim == 1;
+                                 });
+        if (!isByChannel) {
+            DEBUG_LOG("SparseFCExecutor: only 'by channel' bias is supported");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+SparseFCExecutor::SparseFCExecutor(const FCAttrs& attrs,
+                                   const MemoryArgs& memory,
+                                   const ExecutorContext::CPtr& context)
+    : m_memoryArgs(memory),
+      m_context(context),
+      m_packedWeights(prepareWeightMemory(memory.at(ARG_WEI), context)),
+      m_scratchPad(context->getScratchPad()),
+      N(batchDim(memory.at(ARG_WEI)->getStaticDims())),
+      K(memory.at(ARG_WEI)->getStaticDims().back()) {
+    OPENVINO_ASSERT(attrs.sparseWeights, "SparseFCExecutor: the weights are not marked as sparse");
+}
+
+impl_desc_type SparseFCExecutor::implType() const {
+    return mayiuse(avx512_core) ? impl_desc_type::jit_sparse_avx512 : impl_desc_type::jit_sparse_avx2;
+}
+
+bool SparseFCExecutor::update(const MemoryArgs& memory) {
+    const auto& outDims = memory.at(ARG_DST)->getDescPtr()->getShape().getStaticDims();
+    M = outDims.size() > 2 ? batchDim(outDims) : outDims[0];
+
+    m_srcTransposed.reset();
+    // the transposed tiles pay off starting from the half of a tile
+    if (M >= SparseFCWeights::tileRows / 2) {
+        auto srcTransposedDesc = std::make_shared<CpuBlockedMemoryDesc>(f32, intel_cpu::Shape{M * K});
+        m_srcTransposed = m_scratchPad->createScratchPadMem(srcTransposedDesc);
+    }
+
+    return true;
+}
+
+void SparseFCExecutor::execute(const MemoryArgs& memory) {
+    const auto* const src = memory.at(ARG_SRC)->getDataAs<const float>();
+    auto* const dst = memory.at(ARG_DST)->getDataAs<float>();
+    const auto& biasMemory = memory.at(ARG_BIAS);
+    const auto* const bias = biasMemory->getDesc().empty() ? nullptr : biasMemory->getDataAs<const float>();
+    const auto weights = SparseFCWeights::view(m_packedWeights->getData());
+
+    constexpr auto tileRows = SparseFCWeights::tileRows;
+    const auto rowTiles = div_up(M, tileRows);
+    const auto channelBlocks = div_up(N, channelsBlock);
+    const auto& cpuParallel = m_context->getCpuParallel();
+
+    float* srcT = nullptr;
+    if (m_srcTransposed) {
+        srcT = m_srcTransposed->getDataAs<float>();
+        cpuParallel->parallel_for(rowTiles, [&](size_t tile) {
+            const auto r = tile * tileRows;
+            const auto rows = std::min(tileRows, M - r);
+            ov::Extensions::Cpu::XARCH::sparse_fc_transpose(src + r * K, K, rows, K, srcT + r * K);
+        });
+    }
+
+    cpuParallel->parallel_for2d(rowTiles, channelBlocks, [&](size_t tile, size_t block) {
+        const auto r = tile * tileRows;
+        const auto rows = std::min(tileRows, M - r);
+        const auto n_begin = block * channelsBlock;
+        const auto n_end = std::min(n_begin + channelsBlock, N);
+        ov::Extensions::Cpu::XARCH::sparse_fc(weights,
+                                               src + r * K,
+                                               K,
+                                               srcT ? srcT + r * K : nullptr,
+                                               dst + r * N,
+                                               N,
+                                               bias,
+                                               rows,
+                                               n_begin,
+                                               n_end);
+    });
+}
+
+void SparseFCExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (curNumaNode == numaNodeID) {
+        return;
+    }
+    curNumaNode = numaNodeID;
+    mbind_move(m_packedWeights, numaNodeID);
+    if (!m_memoryArgs.at(ARG_BIAS)->getDesc().empty()) {
+        mbind_move(m_memoryArgs.at(ARG_BIAS), numaNodeID);
+    }
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "dnnl_scratch_pad.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief FullyConnected with f32 sparse weights. The zero weights are dropped at the compilation stage and the
+ * kernels only process the non zero ones, see SparseFCWeights for the packed formats.
+ */
+class SparseFCExecutor : public Executor {
+public:
+    SparseFCExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    [[nodiscard]] impl_desc_type implType() const override;
+
+    bool update(const MemoryArgs& memory) override;
+
+    static bool supports(const FCConfig& config);
+    /**
+     * The node uses it to decide whether to keep the f32 weights sparse before the executor config is known
+     * @param biasDims empty if there is no bias
+     */
+    static bool supports(const FCAttrs& attrs, const VectorDims& biasDims, const VectorDims& dstDims);
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+private:
+    const MemoryArgs& m_memoryArgs;
+    const ExecutorContext::CPtr m_context;
+    const MemoryCPtr m_packedWeights;
+    DnnlScratchPadPtr m_scratchPad;
+    // src transposed into the tiles of the input rows, used by the kernels for the larger batches
+    MemoryPtr m_srcTransposed;
+    size_t M = 0, N, K;
+    int curNumaNode = -1;
+};
+
+using SparseFCExecutorPtr = std::shared_ptr<SparseFCExecutor>;
+
+}  // namespace ov::intel_cpu
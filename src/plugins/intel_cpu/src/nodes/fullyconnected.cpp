@@ -51,6 +51,9 @@
 #include "transformations/utils/utils.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
+#if defined(OPENVINO_ARCH_X86_64)
+#    include "nodes/executors/x64/sparse_fc.hpp"
+#endif
 #if defined(OV_CPU_WITH_KLEIDIAI)
 #    include "openvino/core/shape.hpp"
 #    include "utils/precision_support.h"
@@ -469,6 +472,8 @@ const std::vector<impl_desc_type>& FullyConnected::getDefaultImplPriority() {
         impl_desc_type::unknown,
         impl_desc_type::acl,
         impl_desc_type::brgemm_sparse_avx512_amx,
+        impl_desc_type::jit_sparse_avx512,
+        impl_desc_type::jit_sparse_avx2,
         impl_desc_type::brgemm_avx512_amx,
         impl_desc_type::brgconv_avx512_1x1,
         impl_desc_type::brgemm_avx512,
@@ -505,6 +510,7 @@ const std::vector<impl_desc_type>& FullyConnected::getDefaultImplPriority() {
 // @todo Should be moved to the transformations / optimization stages?
 static bool useSparseWeightsDecompression(const NodePtr& weightsInput,
                                           const ov::element::Type inputType,
+                                          const bool floatSparseWeightsAllowed,
                                           const float sparseWeiDecompressionRate) {
     const auto minSparseRate = sparseWeiDecompressionRate;
 
@@ -512,10 +518,6 @@ static bool useSparseWeightsDecompression(const NodePtr& weightsInput,
         return false;
     }
 
-    if (!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx)) {
-        return false;
-    }
-
     const auto constNode = std::dynamic_pointer_cast<Input>(weightsInput);
     if (!constNode) {
         return false;
@@ -525,23 +527,29 @@ static bool useSparseWeightsDecompression(const NodePtr& weightsInput,
     OPENVINO_ASSERT(weiMemory, "Cannot get const blob");
 
     const auto weiDims = weiMemory->getShape().getStaticDims();
-    if (weiDims.size() != 2 || weiDims[0] % 64 != 0 || weiDims[1] % 64 != 0) {
+    if (weiDims.size() != 2) {
         return false;
     }
 
     const auto weightsType = weiMemory->getPrecision();
-    if (none_of(inputType, u8, i8) || weightsType != i8) {
+    // int8 weights are decompressed by the oneDNN AMX kernels
+    const bool int8SparseWeights = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx) &&
+                                   weiDims[0] % 64 == 0 && weiDims[1] % 64 == 0 && any_of(inputType, u8, i8) &&
+                                   weightsType == i8;
+    // f32 weights are handled by the sparse FullyConnected executor
+    const bool floatSparseWeights = floatSparseWeightsAllowed &&
+                                    dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2) && inputType == f32 &&
+                                    weightsType == f32;
+    if (!int8SparseWeights && !floatSparseWeights) {
         return false;
     }
 
-    const auto* const weightsData = weiMemory->getDataAs<const int8_t>();
     auto elementsCount = weiMemory->getDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
-    size_t zerosCount = 0;
-    for (size_t i = 0; i < elementsCount; i++) {
-        if (weightsData[i] == 0) {
-            zerosCount++;
-        }
-    }
+    const auto countZeros = [&](const auto* weightsData) {
+        return static_cast<size_t>(std::count(weightsData, weightsData + elementsCount, 0));
+    };
+    const size_t zerosCount = int8SparseWeights ? countZeros(weiMemory->getDataAs<const int8_t>())
+                                                : countZeros(weiMemory->getDataAs<const float>());
 
     DEBUG_LOG("elementsCount = ",
               elementsCount,
@@ -563,8 +571,23 @@ static bool useSparseWeightsDecompression(const NodePtr& weightsInput,
 }
 
 void FullyConnected::initSupportedPrimitiveDescriptors() {
+    // the f32 sparse weights are only kept for the sparse executor, which supports neither the post ops nor the other
+    // precisions, so the other implementations never get them
+#if defined(OPENVINO_ARCH_X86_64)
+    const auto biasPrecision = getOriginalInputPrecisionAtPort(BIAS);
+    const bool floatSparseWeightsAllowed =
+        fusedWith.empty() && !tp_cfg.enable_tensor_parallel && getOriginalOutputPrecisionAtPort(0) == f32 &&
+        any_of(biasPrecision, f32, ov::element::dynamic) &&
+        SparseFCExecutor::supports(attrs,
+                                   biasPrecision == ov::element::dynamic ? VectorDims{}
+                                                                         : getInputShapeAtPort(BIAS).getDims(),
+                                   getOutputShapeAtPort(0).getDims());
+#else
+    const bool floatSparseWeightsAllowed = false;
+#endif
     attrs.sparseWeights = useSparseWeightsDecompression(getParentEdgeAt(WEIGHTS)->getParent(),
                                                         getOriginalInputPrecisionAtPort(DATA),
+                                                        floatSparseWeightsAllowed,
                                                         context->getConfig().fcSparseWeiDecompressionRate);
     attrs.dynamicQuantizationGroupSize = context->getConfig().fcDynamicQuantizationGroupSize;
     attrs.modelType = context->getConfig().modelType;
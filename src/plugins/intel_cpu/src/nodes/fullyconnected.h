@@ -49,6 +49,9 @@ public:
     void getSupportedDescriptors() override {};
     void execute(const dnnl::stream& strm) override;
     bool created() const override;
+    std::string getAutotunedImplementation() const override {
+        return executor ? executor->autotunedImplementation() : std::string{};
+    }
 
     bool canBeInPlace() const override {
         return false;
@@ -7,6 +7,7 @@
 #include <oneapi/dnnl/dnnl_common_types.h>
 #include <oneapi/dnnl/dnnl_types.h>
 
+#include <algorithm>
 #include <bitset>
 #include <common/primitive_hashing_utils.hpp>
 #include <common/utils.hpp>
@@ -38,12 +39,14 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
 #include "ov_ops/gather_matmul.hpp"
 #include "ov_ops/gather_matmul_compressed.hpp"
 #include "shape_inference/custom/gathermatmul.hpp"
+#include "thread_pool_imp.hpp"
 #include "transformations/utils/utils.hpp"
 #include "utils/general_utils.h"
 
@@ -152,6 +155,8 @@ public:
         args = make_args(inp_memory, out_memory, wei_memory, bias_memory, scale_memory, zp_memory);
     }
 
+    using exec_args_t = std::unordered_map<int, dnnl::memory>;
+
     void exec(const dnnl::stream& astream,
               void* src,
               void* dst,
@@ -159,19 +164,39 @@ public:
               void* bias = nullptr,
               void* scale = nullptr,
               void* zp = nullptr) {
-        args[DNNL_ARG_SRC].set_data_handle(src);
-        args[DNNL_ARG_DST].set_data_handle(dst);
-        args[DNNL_ARG_WEIGHTS].set_data_handle(weight);
+        exec(astream, args, src, dst, weight, bias, scale, zp);
+    }
+
+    // the primitive may be executed by several threads at once, each of them with its own arguments
+    void exec(const dnnl::stream& astream,
+              exec_args_t& exec_args,
+              void* src,
+              void* dst,
+              void* weight,
+              void* bias = nullptr,
+              void* scale = nullptr,
+              void* zp = nullptr) const {
+        exec_args[DNNL_ARG_SRC].set_data_handle(src);
+        exec_args[DNNL_ARG_DST].set_data_handle(dst);
+        exec_args[DNNL_ARG_WEIGHTS].set_data_handle(weight);
         if (bias) {
-            args[DNNL_ARG_BIAS].set_data_handle(bias);
+            exec_args[DNNL_ARG_BIAS].set_data_handle(bias);
         }
         if (scale) {
-            args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS].set_data_handle(scale);
+            exec_args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS].set_data_handle(scale);
         }
         if (zp) {
-            args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS].set_data_handle(zp);
+            exec_args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS].set_data_handle(zp);
+        }
+        m_prim.execute(astream, exec_args);
+    }
+
+    [[nodiscard]] exec_args_t make_exec_args() const {
+        exec_args_t exec_args;
+        for (const auto& [id, mem] : args) {
+            exec_args.emplace(id, dnnl::memory(mem.get_desc(), mem.get_engine(), DNNL_MEMORY_NONE));
         }
-        m_prim.execute(astream, args);
+        return exec_args;
     }
 
     [[nodiscard]] dnnl::memory::desc get_weights_md() const {
@@ -569,6 +594,11 @@ static Dim normalizeM(Dim M) {
     return M;
 }
 
+// rows of the tokens of an expert per GEMM of the grouped execution, a single AMX tile of rows keeps the padding small
+constexpr Dim groupedGemmRows = 16;
+// the experts with more tokens on average are executed one by one by the GEMMs parallelized inside
+constexpr size_t groupedMaxRowsPerExpert = 256;
+
 void GatherMatmul::prepareParams() {
     auto srcMem = getSrcMemoryAtPort(DATA);
     const auto& srcShape = srcMem->getStaticDims();
@@ -584,7 +614,16 @@ void GatherMatmul::prepareParams() {
     m_tmpOutputDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(srcPrc, Shape({M, dstShape[2]}));
 
     const size_t srcSize = rnd_up(m_tmpInputDesc->getCurrentMemSize(), 64);  // 64 bytes is the cache line size
-    const size_t totalSize = srcSize + m_tmpOutputDesc->getCurrentMemSize();
+    size_t totalSize = srcSize + m_tmpOutputDesc->getCurrentMemSize();
+    m_groupedThreads = 0;
+    m_groupedBufferSize = 0;
+    if (bf16_amx_mode) {
+        // the grouped execution packs the tokens into the buffers of the threads
+        m_groupedThreads = static_cast<size_t>(parallel_get_max_threads());
+        const size_t groupedSrcSize = rnd_up(groupedGemmRows * srcShape[2] * srcPrc.size(), 64);
+        m_groupedBufferSize = rnd_up(groupedSrcSize + groupedGemmRows * dstShape[2] * srcPrc.size(), 64);
+        totalSize = std::max(totalSize, m_groupedThreads * m_groupedBufferSize);
+    }
     auto scratchPadDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(ov::element::u8, Shape({totalSize}));
     m_tmpInpBuffer = getScratchPadMem(scratchPadDesc);
 
@@ -625,6 +664,16 @@ void GatherMatmul::prepareParams() {
     std::tie(gemm_impl, std::ignore) = cache->getOrCreate(key, [&eng](const onednn_matmul_key& k) {
         return std::make_shared<onednn_matmul>(eng, k);
     });
+
+    if (bf16_amx_mode) {
+        key.src_md = dnnl::memory::desc({static_cast<dnnl::memory::dim>(groupedGemmRows),
+                                         static_cast<dnnl::memory::dim>(srcShape[2])},
+                                        DnnlExtensionUtils::ElementTypeToDataType(srcPrc),
+                                        dnnl::memory::format_tag::ab);
+        std::tie(grouped_gemm_impl, std::ignore) = cache->getOrCreate(key, [&eng](const onednn_matmul_key& k) {
+            return std::make_shared<onednn_matmul>(eng, k);
+        });
+    }
 }
 
 bool GatherMatmul::isExecutable() const {
@@ -701,6 +750,13 @@ private:
     size_t m_num_bits;
     std::bitset<2> m_broadcast_mask;
 };
+
+// consecutive tokens of an expert processed by a single GEMM (GEMV) of the grouped execution
+struct ExpertBlock {
+    size_t expert;
+    size_t row;
+    size_t rows;
+};
 }  // namespace
 
 void GatherMatmul::execute(const dnnl::stream& strm) {
@@ -751,7 +807,96 @@ void GatherMatmul::execute(const dnnl::stream& strm) {
             }
         }
 
-        if (bf16_amx_mode) {
+        // the tokens of all the experts are split into the blocks in the order of the experts
+        const size_t block_rows = bf16_amx_mode ? groupedGemmRows : 1;
+        std::vector<ExpertBlock> blocks;
+        size_t active_experts = 0;
+        for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
+            const size_t num_rows = elements_per_gather_indx[gather_axis_index];
+            active_experts += num_rows > 0 ? 1 : 0;
+            for (size_t row = 0; row < num_rows; row += block_rows) {
+                blocks.push_back({gather_axis_index, row, std::min(block_rows, num_rows - row)});
+            }
+        }
+
+        // The primitives of the grouped execution are single threaded, so there have to be enough blocks to occupy the
+        // threads, while the experts with many tokens are better served by the large GEMMs parallelized inside.
+        // The packing buffers are sized for the threads available on the preparation, so the grouped GEMMs never
+        // run on more threads than that.
+        const auto nthr = static_cast<size_t>(parallel_get_max_threads());
+        const auto grouped_nthr = bf16_amx_mode ? std::min(nthr, m_groupedThreads) : nthr;
+        const bool grouped = grouped_nthr > 0 && blocks.size() * 2 >= grouped_nthr &&
+                             M * indices_size <= active_experts * groupedMaxRowsPerExpert &&
+                             (!bf16_amx_mode || (grouped_gemm_impl && m_tmpInpBuffer));
+
+        if (grouped) {
+            // All the blocks are scheduled in a single parallel region. The threads take equal contiguous ranges of
+            // the blocks, so the load is balanced by the number of the tokens and the consecutive blocks of a thread
+            // reuse the weights of an expert. The weights decompression stays fused into the primitives.
+            const auto& impl = bf16_amx_mode ? grouped_gemm_impl : gemv_impl;
+            CPU_NODE_ASSERT(impl, "Grouped GEMM implementation is not created");
+            const auto element_size = srcMem->getDesc().getPrecision().size();
+            const auto K_size = srcMem->getStaticDims()[2];
+            const auto N_size = dstMem->getStaticDims()[2];
+            while (m_groupedStreams.size() < grouped_nthr) {
+                m_groupedStreams.push_back(make_stream(getEngine(), cpu_parallel->get_thread_pool()));
+            }
+
+            parallel_nt(static_cast<int>(grouped_nthr), [&](const int ithr, const int nthr) {
+                size_t start = 0;
+                size_t end = 0;
+                splitter(blocks.size(), nthr, ithr, start, end);
+                if (start >= end) {
+                    return;
+                }
+                const auto& thread_strm = m_groupedStreams[ithr];
+                auto exec_args = impl->make_exec_args();
+                uint8_t* input_ptr = nullptr;
+                uint8_t* output_ptr = nullptr;
+                if (bf16_amx_mode) {
+                    input_ptr = m_tmpInpBuffer->getDataAs<uint8_t>() + ithr * m_groupedBufferSize;
+                    output_ptr = input_ptr + rnd_up(groupedGemmRows * K_size * element_size, 64);
+                }
+
+                for (size_t b = start; b < end; b++) {
+                    const auto& block = blocks[b];
+                    const auto* rows_map = &gather_idx_map[block.expert * M + block.row];
+                    auto* wei = wei_offset(block.expert);
+                    auto* bias = bias_offset(block.expert);
+                    auto* scale = scale_offset(block.expert);
+                    auto* zp = zp_offset(block.expert);
+                    if (!bf16_amx_mode) {
+                        const auto [row_id, batch_index] = rows_map[0];
+                        impl->exec(thread_strm,
+                                   exec_args,
+                                   src_offset(batch_index, row_id),
+                                   dst_offset(batch_index, row_id),
+                                   wei,
+                                   bias,
+                                   scale,
+                                   zp);
+                        continue;
+                    }
+
+                    for (size_t m = 0; m < groupedGemmRows; m++) {
+                        auto* dst_row = input_ptr + m * K_size * element_size;
+                        if (m < block.rows) {
+                            const auto [row_id, batch_index] = rows_map[m];
+                            std::memcpy(dst_row, src_offset(batch_index, row_id), K_size * element_size);
+                        } else {
+                            std::memset(dst_row, 0, K_size * element_size);
+                        }
+                    }
+                    impl->exec(thread_strm, exec_args, input_ptr, output_ptr, wei, bias, scale, zp);
+                    for (size_t m = 0; m < block.rows; m++) {
+                        const auto [row_id, batch_index] = rows_map[m];
+                        std::memcpy(dst_offset(batch_index, row_id),
+                                    output_ptr + m * N_size * element_size,
+                                    N_size * element_size);
+                    }
+                }
+            });
+        } else if (bf16_amx_mode) {
             // When AMX is available, we use GEMM for better performance
             // first we pack all the tokens corresponding to a specific expert into a temporary buffer
             // then we call GEMM for that expert on that temporary buffer
@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <string>
+#include <vector>
 
 #include "cpu_memory.h"
 #include "graph_context.h"
@@ -62,6 +64,8 @@ private:
     MemoryArgs memory;
     GemvImplPtr gemv_impl = nullptr;
     GemvImplPtr gemm_impl = nullptr;
+    // GEMM of a block of the tokens of an expert executed by a single thread of the grouped execution
+    GemvImplPtr grouped_gemm_impl = nullptr;
 
     MemoryPtr m_weightsMemory = nullptr;
     MemoryPtr m_scalesMemory = nullptr;
@@ -70,6 +74,10 @@ private:
     MemoryPtr m_tmpInpBuffer = nullptr;
     MemoryDescPtr m_tmpInputDesc = nullptr;
     MemoryDescPtr m_tmpOutputDesc = nullptr;
+    size_t m_groupedThreads = 0;
+    size_t m_groupedBufferSize = 0;
+    // the streams of the threads of the grouped execution, since a stream may not be shared by the threads
+    std::vector<dnnl::stream> m_groupedStreams;
 
     bool bf16_amx_mode = false;
 };
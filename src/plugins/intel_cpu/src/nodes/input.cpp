@@ -583,6 +583,7 @@ void Input::cloneBlobIfRequired() {
         // original weights are stored.
         (!weightCache || context->getNumNumaNodes() == 1 || context->getCPUStreamExecutor()->get_streams_num() == 1);
 
+    m_constantDataShared = clone_is_not_needed;
     memoryPtr = clone_is_not_needed
                     ? std::make_shared<Memory>(getEngine(), memDesc, m_constOp->get_data_ptr())
                     : std::const_pointer_cast<const IMemory>(
@@ -73,6 +73,14 @@ public:
     void withMeanImage();
     MemoryCPtr getMemoryPtr() const;
 
+    /**
+     * @brief Whether the memory of the constant is a view of the ov::Constant data (i.e. of the mmapped weights or
+     * of the imported blob) rather than a copy owned by the plugin
+     */
+    bool isConstantDataShared() const {
+        return m_constantDataShared;
+    }
+
     void execute(const dnnl::stream& strm) override {}
     void executeDynamicImpl(const dnnl::stream& strm) override {}
 
@@ -97,6 +105,7 @@ private:
 
     std::shared_ptr<ov::op::v0::Constant> m_constOp;
     MemoryCPtr memoryPtr;
+    bool m_constantDataShared = false;
     bool isMeanImage = false;
     MemoryDescPtr extMemDesc = nullptr;
     bool m_useParentMemoryDescForOutput = false;
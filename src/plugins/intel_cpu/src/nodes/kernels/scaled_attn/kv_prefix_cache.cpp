@@ -0,0 +1,322 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "kv_prefix_cache.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/util/common_util.hpp"
+
+namespace ov::Extensions::Cpu {
+
+PagedKVPrefixCache::PagedKVPrefixCache(size_t num_blocks, size_t block_size)
+    : m_block_size(block_size),
+      m_blocks(num_blocks) {
+    OPENVINO_ASSERT(block_size > 0, "PagedKVPrefixCache: block size must be positive");
+    OPENVINO_ASSERT(num_blocks <= static_cast<size_t>(INT32_MAX), "PagedKVPrefixCache: too many blocks ", num_blocks);
+    m_free_blocks.reserve(num_blocks);
+    // the blocks with the lower numbers are allocated first
+    for (size_t i = num_blocks; i > 0; i--) {
+        m_free_blocks.push_back(static_cast<int32_t>(i - 1));
+    }
+}
+
+size_t PagedKVPrefixCache::compute_hash(size_t parent_hash, const Token* tokens, size_t num_tokens) {
+    size_t seed = parent_hash;
+    for (size_t i = 0; i < num_tokens; i++) {
+        seed = ov::util::hash_combine(static_cast<size_t>(tokens[i]), seed);
+    }
+    return seed;
+}
+
+int32_t PagedKVPrefixCache::find_block(size_t parent_hash, const Token* tokens) const {
+    const auto range = m_index.equal_range(compute_hash(parent_hash, tokens, m_block_size));
+    for (auto it = range.first; it != range.second; ++it) {
+        const auto& block = m_blocks[it->second];
+        if (block.parent_hash == parent_hash && std::equal(block.tokens.begin(), block.tokens.end(), tokens)) {
+            return it->second;
+        }
+    }
+    return -1;
+}
+
+size_t PagedKVPrefixCache::available_blocks() const {
+    return m_free_blocks.size() + m_evictable_blocks.size();
+}
+
+int32_t PagedKVPrefixCache::allocate_block() {
+    if (!m_free_blocks.empty()) {
+        const auto block = m_free_blocks.back();
+        m_free_blocks.pop_back();
+        return block;
+    }
+    OPENVINO_ASSERT(!m_evictable_blocks.empty(), "PagedKVPrefixCache: out of KV cache blocks");
+    const auto block = m_evictable_blocks.front();
+    m_evictable_blocks.pop_front();
+    auto& victim = m_blocks[block];
+    const auto range = m_index.equal_range(victim.hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == block) {
+            m_index.erase(it);
+            break;
+        }
+    }
+    victim.registered = false;
+    victim.parent_hash = 0;
+    victim.tokens.clear();
+    m_stats.evicted_blocks++;
+    return block;
+}
+
+void PagedKVPrefixCache::acquire_block(int32_t block) {
+    auto& b = m_blocks[block];
+    if (b.ref_count == 0 && b.registered) {
+        m_evictable_blocks.erase(b.lru_pos);
+    }
+    b.ref_count++;
+}
+
+void PagedKVPrefixCache::release_block(int32_t block) {
+    auto& b = m_blocks[block];
+    OPENVINO_ASSERT(b.ref_count > 0, "PagedKVPrefixCache: block ", block, " is released more times than acquired");
+    if (--b.ref_count > 0) {
+        return;
+    }
+    if (b.registered) {
+        b.lru_pos = m_evictable_blocks.insert(m_evictable_blocks.end(), block);
+    } else {
+        m_free_blocks.push_back(block);
+    }
+}
+
+size_t PagedKVPrefixCache::register_block(int32_t block, size_t parent_hash, std::vector<Token> tokens) {
+    const auto hash = compute_hash(parent_hash, tokens.data(), tokens.size());
+    // the same content could be computed by several sequences concurrently, the first one is kept for the reuse
+    if (find_block(parent_hash, tokens.data()) >= 0) {
+        return hash;
+    }
+    auto& b = m_blocks[block];
+    b.registered = true;
+    b.parent_hash = parent_hash;
+    b.hash = hash;
+    b.tokens = std::move(tokens);
+    m_index.emplace(b.hash, block);
+    return hash;
+}
+
+void PagedKVPrefixCache::append_token(Sequence& sequence, Token token) {
+    if (sequence.num_tokens % m_block_size == 0) {
+        const auto block = allocate_block();
+        acquire_block(block);
+        sequence.blocks.push_back(block);
+        sequence.tail.clear();
+        m_stats.computed_blocks++;
+    } else if (m_blocks[sequence.blocks.back()].ref_count > 1) {
+        // copy-on-write of the partially filled block shared with another sequence
+        const auto src = sequence.blocks.back();
+        const auto dst = allocate_block();
+        acquire_block(dst);
+        release_block(src);
+        sequence.blocks.back() = dst;
+        m_pending_copies.push_back({src, dst});
+        m_stats.copied_blocks++;
+    }
+    sequence.tail.push_back(token);
+    sequence.num_tokens++;
+    if (sequence.tail.size() == m_block_size) {
+        // the previous block may be a private copy, so the parent is identified by the hash of the shared content
+        sequence.prefix_hash = register_block(sequence.blocks.back(), sequence.prefix_hash, std::move(sequence.tail));
+        sequence.tail.clear();
+    }
+}
+
+PagedKVPrefixCache::SequenceId PagedKVPrefixCache::add_sequence(const Token* tokens, size_t num_tokens) {
+    OPENVINO_ASSERT(num_tokens > 0, "PagedKVPrefixCache: empty prompt");
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<int32_t> reused;
+    size_t reused_evictable = 0;
+    size_t parent_hash = 0;
+    for (size_t i = 0; i < num_tokens / m_block_size; i++) {
+        const auto block = find_block(parent_hash, tokens + i * m_block_size);
+        if (block < 0) {
+            break;
+        }
+        reused.push_back(block);
+        reused_evictable += m_blocks[block].ref_count == 0 ? 1 : 0;
+        parent_hash = m_blocks[block].hash;
+    }
+    const size_t reused_tokens = reused.size() * m_block_size;
+    // the last token is always computed to produce the logits, so it is written into the last shared block
+    const bool copy_last = reused_tokens == num_tokens;
+    const size_t required =
+        (num_tokens + m_block_size - 1) / m_block_size - reused.size() + (copy_last ? 1 : 0);
+    OPENVINO_ASSERT(required <= available_blocks() - reused_evictable,
+                    "PagedKVPrefixCache: out of KV cache blocks, ",
+                    required,
+                    " blocks are required while ",
+                    available_blocks() - reused_evictable,
+                    " are available");
+
+    Sequence sequence;
+    for (const auto block : reused) {
+        acquire_block(block);
+        sequence.blocks.push_back(block);
+    }
+    m_stats.reused_blocks += reused.size();
+    sequence.num_tokens = reused_tokens;
+    sequence.prefix_hash = parent_hash;
+    sequence.cached_tokens = copy_last ? num_tokens - 1 : reused_tokens;
+    if (copy_last) {
+        const auto src = sequence.blocks.back();
+        const auto dst = allocate_block();
+        acquire_block(dst);
+        release_block(src);
+        sequence.blocks.back() = dst;
+        m_pending_copies.push_back({src, dst});
+        m_stats.copied_blocks++;
+    }
+    for (size_t i = reused_tokens; i < num_tokens; i++) {
+        append_token(sequence, tokens[i]);
+    }
+
+    const auto id = m_next_id++;
+    m_sequences.emplace(id, std::move(sequence));
+    return id;
+}
+
+void PagedKVPrefixCache::append_tokens(SequenceId id, const Token* tokens, size_t num_tokens) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& sequence = get_sequence(id);
+    const auto used_blocks = (sequence.num_tokens + m_block_size - 1) / m_block_size;
+    const auto new_blocks = (sequence.num_tokens + num_tokens + m_block_size - 1) / m_block_size - used_blocks;
+    const bool shared_tail = num_tokens > 0 && sequence.num_tokens % m_block_size != 0 &&
+                             m_blocks[sequence.blocks.back()].ref_count > 1;
+    const size_t required = new_blocks + (shared_tail ? 1 : 0);
+    OPENVINO_ASSERT(required <= available_blocks(),
+                    "PagedKVPrefixCache: out of KV cache blocks, ",
+                    required,
+                    " blocks are required while ",
+                    available_blocks(),
+                    " are available");
+    for (size_t i = 0; i < num_tokens; i++) {
+        append_token(sequence, tokens[i]);
+    }
+}
+
+PagedKVPrefixCache::SequenceId PagedKVPrefixCache::fork(SequenceId id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto sequence = get_sequence(id);
+    for (const auto block : sequence.blocks) {
+        acquire_block(block);
+    }
+    const auto fork_id = m_next_id++;
+    m_sequences.emplace(fork_id, std::move(sequence));
+    return fork_id;
+}
+
+void PagedKVPrefixCache::release(SequenceId id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& sequence = get_sequence(id);
+    // the blocks of the sequence tail are released first, so the prefix blocks stay in the cache longer
+    for (auto it = sequence.blocks.rbegin(); it != sequence.blocks.rend(); ++it) {
+        release_block(*it);
+    }
+    m_sequences.erase(id);
+}
+
+PagedKVPrefixCache::Sequence& PagedKVPrefixCache::get_sequence(SequenceId id) {
+    auto it = m_sequences.find(id);
+    OPENVINO_ASSERT(it != m_sequences.end(), "PagedKVPrefixCache: unknown sequence ", id);
+    return it->second;
+}
+
+const PagedKVPrefixCache::Sequence& PagedKVPrefixCache::get_sequence(SequenceId id) const {
+    auto it = m_sequences.find(id);
+    OPENVINO_ASSERT(it != m_sequences.end(), "PagedKVPrefixCache: unknown sequence ", id);
+    return it->second;
+}
+
+std::vector<int32_t> PagedKVPrefixCache::block_table(SequenceId id) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return get_sequence(id).blocks;
+}
+
+size_t PagedKVPrefixCache::cached_tokens(SequenceId id) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return get_sequence(id).cached_tokens;
+}
+
+size_t PagedKVPrefixCache::num_tokens(SequenceId id) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return get_sequence(id).num_tokens;
+}
+
+std::vector<PagedKVPrefixCache::BlockCopy> PagedKVPrefixCache::take_pending_copies() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::exchange(m_pending_copies, {});
+}
+
+PagedKVPrefixCache::Statistics PagedKVPrefixCache::get_statistics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto stats = m_stats;
+    stats.free_blocks = available_blocks();
+    return stats;
+}
+
+void PagedKVPrefixCache::copy_blocks(void* cache,
+                                     size_t cache_byte_size,
+                                     size_t num_blocks,
+                                     const std::vector<BlockCopy>& copies) {
+    if (copies.empty()) {
+        return;
+    }
+    OPENVINO_ASSERT(num_blocks > 0 && cache_byte_size % num_blocks == 0,
+                    "PagedKVPrefixCache: unexpected cache size ",
+                    cache_byte_size,
+                    " for ",
+                    num_blocks,
+                    " blocks");
+    const auto block_bytes = cache_byte_size / num_blocks;
+    auto* data = static_cast<uint8_t*>(cache);
+    auto copy = [&](const BlockCopy& c) {
+        OPENVINO_ASSERT(c.src >= 0 && c.dst >= 0 && static_cast<size_t>(std::max(c.src, c.dst)) < num_blocks,
+                        "PagedKVPrefixCache: block copy ",
+                        c.src,
+                        " -> ",
+                        c.dst,
+                        " is out of range");
+        std::memcpy(data + c.dst * block_bytes, data + c.src * block_bytes, block_bytes);
+    };
+    // the copies are independent unless a block is written by one copy and read or written by another one, such
+    // chains (i.e. {1 -> 2}, {3 -> 1}) are copied in order
+    std::unordered_set<int32_t> sources;
+    std::unordered_set<int32_t> destinations;
+    bool independent = true;
+    for (const auto& c : copies) {
+        independent = independent && destinations.count(c.src) == 0 && destinations.count(c.dst) == 0 &&
+                      sources.count(c.dst) == 0;
+        sources.insert(c.src);
+        destinations.insert(c.dst);
+    }
+    if (independent) {
+        ov::parallel_for(copies.size(), [&](size_t i) {
+            copy(copies[i]);
+        });
+    } else {
+        for (const auto& c : copies) {
+            copy(c);
+        }
+    }
+}
+
+}  // namespace ov::Extensions::Cpu
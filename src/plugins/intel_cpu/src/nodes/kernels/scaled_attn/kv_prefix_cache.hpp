@@ -0,0 +1,142 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace ov::Extensions::Cpu {
+
+/**
+ * @brief Block manager of the paged KV cache consumed by the PagedAttention executor, which shares the blocks of the
+ * identical prompt prefixes between the sequences.
+ *
+ * A full block is identified by its tokens and by the hash of the block which precedes it in the sequence, so a block
+ * is reused only when the whole prefix matches. The hash of the content doesn't change when a block is copied, so the
+ * blocks following a private copy are still chained to the shared prefix. The blocks are reference counted: the blocks
+ * released by all the sequences keep their content and stay reusable until they are evicted (LRU) to serve a new
+ * allocation.
+ *
+ * The block shared by several sequences is never written: appending a token to it allocates a private copy
+ * (copy-on-write). The copies are not performed by the manager, as it doesn't own the cache memory, they are
+ * collected by take_pending_copies() and must be applied with copy_blocks() to the key and value caches before the
+ * next inference.
+ *
+ * The block table of a sequence is passed to PagedAttention as is (block_indices), while cached_tokens() is the
+ * number of the leading tokens which KV values are already in the cache, i.e. past_lens of the first inference.
+ * A new full block is registered for the reuse right away, so the sequences which reuse it must not be scheduled
+ * before (or must be scheduled within) the inference which fills it.
+ */
+class PagedKVPrefixCache {
+public:
+    using SequenceId = uint64_t;
+    using Token = int64_t;
+
+    struct BlockCopy {
+        int32_t src;
+        int32_t dst;
+    };
+
+    struct Statistics {
+        uint64_t reused_blocks = 0;
+        uint64_t computed_blocks = 0;
+        uint64_t copied_blocks = 0;
+        uint64_t evicted_blocks = 0;
+        size_t free_blocks = 0;
+    };
+
+    PagedKVPrefixCache(size_t num_blocks, size_t block_size);
+
+    /**
+     * @brief Creates a sequence for the prompt reusing the blocks of the longest cached prefix
+     * @throws ov::Exception if there is not enough free blocks, nothing is allocated in this case
+     */
+    SequenceId add_sequence(const Token* tokens, size_t num_tokens);
+
+    /**
+     * @brief Appends the generated tokens to the sequence, the shared last block is copied before it is written
+     */
+    void append_tokens(SequenceId id, const Token* tokens, size_t num_tokens);
+
+    /**
+     * @brief Creates a sequence sharing all the blocks with \p id (i.e. for the beam search)
+     */
+    SequenceId fork(SequenceId id);
+
+    void release(SequenceId id);
+
+    [[nodiscard]] std::vector<int32_t> block_table(SequenceId id) const;
+
+    [[nodiscard]] size_t cached_tokens(SequenceId id) const;
+
+    [[nodiscard]] size_t num_tokens(SequenceId id) const;
+
+    std::vector<BlockCopy> take_pending_copies();
+
+    [[nodiscard]] Statistics get_statistics() const;
+
+    [[nodiscard]] size_t block_size() const {
+        return m_block_size;
+    }
+
+    /**
+     * @brief Applies the block copies to the cache memory of \p num_blocks blocks laid out as
+     * [num_blocks, ...], i.e. the key or value cache of PagedAttention
+     */
+    static void copy_blocks(void* cache,
+                            size_t cache_byte_size,
+                            size_t num_blocks,
+                            const std::vector<BlockCopy>& copies);
+
+private:
+    struct Block {
+        size_t ref_count = 0;
+        bool registered = false;
+        size_t hash = 0;
+        size_t parent_hash = 0;
+        std::vector<Token> tokens;
+        std::list<int32_t>::iterator lru_pos;
+    };
+
+    struct Sequence {
+        std::vector<int32_t> blocks;
+        size_t num_tokens = 0;
+        size_t cached_tokens = 0;
+        // tokens of the last block while it isn't full
+        std::vector<Token> tail;
+        // hash of the last full block, i.e. the parent of the next one
+        size_t prefix_hash = 0;
+    };
+
+    static size_t compute_hash(size_t parent_hash, const Token* tokens, size_t num_tokens);
+
+    int32_t find_block(size_t parent_hash, const Token* tokens) const;
+    int32_t allocate_block();
+    void acquire_block(int32_t block);
+    void release_block(int32_t block);
+    size_t register_block(int32_t block, size_t parent_hash, std::vector<Token> tokens);
+    void append_token(Sequence& sequence, Token token);
+    size_t available_blocks() const;
+
+    Sequence& get_sequence(SequenceId id);
+    const Sequence& get_sequence(SequenceId id) const;
+
+    const size_t m_block_size;
+    std::vector<Block> m_blocks;
+    std::vector<int32_t> m_free_blocks;
+    // released blocks which content may be reused, the least recently used are at the front
+    std::list<int32_t> m_evictable_blocks;
+    std::unordered_multimap<size_t, int32_t> m_index;
+    std::unordered_map<SequenceId, Sequence> m_sequences;
+    SequenceId m_next_id = 0;
+    std::vector<BlockCopy> m_pending_copies;
+    Statistics m_stats;
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace ov::Extensions::Cpu
@@ -0,0 +1,554 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+#include "nodes/kernels/scaled_attn/common.hpp"
+#include "nodes/kernels/scaled_attn/transpose_kernel.hpp"
+#include "nodes/kernels/x64/sparse_fc_weights.hpp"
+#include "sparse_fc.hpp"
+
+namespace ov::Extensions::Cpu::XARCH {
+
+using ov::intel_cpu::SparseFCWeights;
+
+namespace {
+
+// number of the rows of src sharing the loaded weights, when the rows are not transposed
+constexpr size_t rowBlock = 4;
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+
+// positions of the set bits of a byte
+struct BitPositions {
+    std::array<uint8_t, 256> count{};
+    std::array<std::array<uint8_t, 8>, 256> positions{};
+    // indices of the packed values spreading them to the lanes of the set bits
+    std::array<std::array<int32_t, 8>, 256> expand{};
+
+    constexpr BitPositions() {
+        for (size_t mask = 0; mask < 256; mask++) {
+            for (size_t lane = 0; lane < 8; lane++) {
+                if (mask & (1U << lane)) {
+                    expand[mask][lane] = count[mask];
+                    positions[mask][count[mask]++] = static_cast<uint8_t>(lane);
+                }
+            }
+        }
+    }
+};
+
+constexpr BitPositions bitPositions{};
+
+#endif
+
+#if defined(HAVE_AVX512F)
+
+using vec = __m512;
+constexpr size_t vec_len = vec_len_f32_avx512;
+inline vec vec_zero() {
+    return _mm512_setzero_ps();
+}
+inline vec vec_set1(float value) {
+    return _mm512_set1_ps(value);
+}
+inline vec vec_load(const float* ptr) {
+    return _mm512_loadu_ps(ptr);
+}
+inline vec vec_fmadd(vec a, vec b, vec c) {
+    return _mm512_fmadd_ps(a, b, c);
+}
+inline vec vec_add(vec a, vec b) {
+    return _mm512_add_ps(a, b);
+}
+inline void vec_store(float* ptr, vec v) {
+    _mm512_storeu_ps(ptr, v);
+}
+
+template <size_t R>
+void unstructured(const SparseFCWeights& w,
+                  const float* src,
+                  size_t src_stride,
+                  float* dst,
+                  size_t dst_stride,
+                  const float* bias,
+                  size_t n_begin,
+                  size_t n_end) {
+    const auto blocks = w.blocks();
+    for (size_t i = n_begin; i < n_end; i++) {
+        const auto* values = w.values + w.rowOffsets[i];
+        const auto* masks = w.masks + i * blocks;
+        __m512 acc[R];
+        for (size_t r = 0; r < R; r++) {
+            acc[r] = _mm512_setzero_ps();
+        }
+        for (size_t b = 0; b < blocks; b++) {
+            const auto mask = static_cast<__mmask16>(masks[b]);
+            const auto k = b * SparseFCWeights::blockSize;
+            // the non zero weights are spread to the lanes of their input channels
+            const auto weights = _mm512_maskz_expandloadu_ps(mask, values);
+            for (size_t r = 0; r < R; r++) {
+                const auto x = _mm512_maskz_loadu_ps(mask, src + r * src_stride + k);
+                acc[r] = _mm512_fmadd_ps(weights, x, acc[r]);
+            }
+            values += bitPositions.count[mask & 0xFFU] + bitPositions.count[mask >> 8U];
+        }
+        for (size_t r = 0; r < R; r++) {
+            dst[r * dst_stride + i] = _mm512_reduce_add_ps(acc[r]) + (bias ? bias[i] : 0.0F);
+        }
+    }
+}
+
+template <size_t R>
+void structured(const SparseFCWeights& w,
+                const float* src,
+                size_t src_stride,
+                float* dst,
+                size_t dst_stride,
+                const float* bias,
+                size_t n_begin,
+                size_t n_end) {
+    constexpr size_t half = SparseFCWeights::chunkSize / 2;
+    const auto chunks = w.chunks();
+    const auto slots = w.slots();
+    for (size_t i = n_begin; i < n_end; i++) {
+        const auto* values = w.values + i * chunks * slots;
+        const auto* positions = w.positions + i * chunks * slots;
+        __m512 acc[R];
+        for (size_t r = 0; r < R; r++) {
+            acc[r] = _mm512_setzero_ps();
+        }
+        for (size_t c = 0; c < chunks; c++) {
+            const auto k = c * SparseFCWeights::chunkSize;
+            const auto tail = std::min(w.K - k, SparseFCWeights::chunkSize);
+            const auto lo = static_cast<__mmask16>((1U << std::min(tail, half)) - 1);
+            const auto hi = static_cast<__mmask16>((1U << (tail - std::min(tail, half))) - 1);
+            // the input channels of the chunk are kept in the registers and permuted by the positions of the weights
+            __m512 x0[R];
+            __m512 x1[R];
+            for (size_t r = 0; r < R; r++) {
+                x0[r] = _mm512_maskz_loadu_ps(lo, src + r * src_stride + k);
+                x1[r] = _mm512_maskz_loadu_ps(hi, src + r * src_stride + k + half);
+            }
+            for (size_t s = 0; s < slots; s += vec_len_f32_avx512) {
+                const auto lanes = static_cast<__mmask16>((1U << std::min(slots - s, vec_len_f32_avx512)) - 1);
+                const auto idx =
+                    _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(positions + s)));
+                const auto weights = _mm512_maskz_loadu_ps(lanes, values + s);
+                for (size_t r = 0; r < R; r++) {
+                    const auto x = _mm512_permutex2var_ps(x0[r], idx, x1[r]);
+                    acc[r] = _mm512_mask3_fmadd_ps(weights, x, acc[r], lanes);
+                }
+            }
+            values += slots;
+            positions += slots;
+        }
+        for (size_t r = 0; r < R; r++) {
+            dst[r * dst_stride + i] = _mm512_reduce_add_ps(acc[r]) + (bias ? bias[i] : 0.0F);
+        }
+    }
+}
+
+#elif defined(HAVE_AVX2)
+
+using vec = __m256;
+constexpr size_t vec_len = vec_len_f32_avx2;
+inline vec vec_zero() {
+    return _mm256_setzero_ps();
+}
+inline vec vec_set1(float value) {
+    return _mm256_set1_ps(value);
+}
+inline vec vec_load(const float* ptr) {
+    return _mm256_loadu_ps(ptr);
+}
+inline vec vec_fmadd(vec a, vec b, vec c) {
+    return _mm256_fmadd_ps(a, b, c);
+}
+inline vec vec_add(vec a, vec b) {
+    return _mm256_add_ps(a, b);
+}
+inline void vec_store(float* ptr, vec v) {
+    _mm256_storeu_ps(ptr, v);
+}
+
+template <size_t R>
+inline void unstructured_block(uint32_t mask,
+                               const float*& values,
+                               const float* src,
+                               size_t src_stride,
+                               __m256 (&acc)[R]) {
+    if (mask == 0) {
+        return;
+    }
+    const auto bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    const auto lanes = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int>(mask)), bits), bits);
+    const auto idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bitPositions.expand[mask].data()));
+    const auto weights =
+        _mm256_and_ps(_mm256_permutevar8x32_ps(_mm256_loadu_ps(values), idx), _mm256_castsi256_ps(lanes));
+    for (size_t r = 0; r < R; r++) {
+        const auto x = _mm256_maskload_ps(src + r * src_stride, lanes);
+        acc[r] = _mm256_fmadd_ps(weights, x, acc[r]);
+    }
+    values += bitPositions.count[mask];
+}
+
+template <size_t R>
+void unstructured(const SparseFCWeights& w,
+                  const float* src,
+                  size_t src_stride,
+                  float* dst,
+                  size_t dst_stride,
+                  const float* bias,
+                  size_t n_begin,
+                  size_t n_end) {
+    const auto blocks = w.blocks();
+    for (size_t i = n_begin; i < n_end; i++) {
+        const auto* values = w.values + w.rowOffsets[i];
+        const auto* masks = w.masks + i * blocks;
+        __m256 acc[R];
+        for (size_t r = 0; r < R; r++) {
+            acc[r] = _mm256_setzero_ps();
+        }
+        for (size_t b = 0; b < blocks; b++) {
+            const auto k = b * SparseFCWeights::blockSize;
+            unstructured_block<R>(masks[b] & 0xFFU, values, src + k, src_stride, acc);
+            unstructured_block<R>(masks[b] >> 8U, values, src + k + vec_len_f32_avx2, src_stride, acc);
+        }
+        for (size_t r = 0; r < R; r++) {
+            hsum(acc[r]);
+            dst[r * dst_stride + i] = _mm256_cvtss_f32(acc[r]) + (bias ? bias[i] : 0.0F);
+        }
+    }
+}
+
+template <size_t R>
+void structured(const SparseFCWeights& w,
+                const float* src,
+                size_t src_stride,
+                float* dst,
+                size_t dst_stride,
+                const float* bias,
+                size_t n_begin,
+                size_t n_end) {
+    const auto chunks = w.chunks();
+    const auto slots = w.slots();
+    for (size_t i = n_begin; i < n_end; i++) {
+        const auto* values = w.values + i * chunks * slots;
+        const auto* positions = w.positions + i * chunks * slots;
+        __m256 acc[R];
+        for (size_t r = 0; r < R; r++) {
+            acc[r] = _mm256_setzero_ps();
+        }
+        for (size_t c = 0; c < chunks; c++) {
+            const auto k = c * SparseFCWeights::chunkSize;
+            for (size_t s = 0; s < slots; s += vec_len_f32_avx2) {
+                const auto lanes = get_mask(static_cast<int>(std::min(slots - s, vec_len_f32_avx2)));
+                const auto idx =
+                    _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(positions + s)));
+                const auto weights = _mm256_maskload_ps(values + s, lanes);
+                for (size_t r = 0; r < R; r++) {
+                    const auto x = _mm256_mask_i32gather_ps(_mm256_setzero_ps(),
+                                                            src + r * src_stride + k,
+                                                            idx,
+                                                            _mm256_castsi256_ps(lanes),
+                                                            sizeof(float));
+                    acc[r] = _mm256_fmadd_ps(weights, x, acc[r]);
+                }
+            }
+            values += slots;
+            positions += slots;
+        }
+        for (size_t r = 0; r < R; r++) {
+            hsum(acc[r]);
+            dst[r * dst_stride + i] = _mm256_cvtss_f32(acc[r]) + (bias ? bias[i] : 0.0F);
+        }
+    }
+}
+
+#else
+
+template <size_t R>
+void unstructured(const SparseFCWeights& w,
+                  const float* src,
+                  size_t src_stride,
+                  float* dst,
+                  size_t dst_stride,
+                  const float* bias,
+                  size_t n_begin,
+                  size_t n_end) {
+    const auto blocks = w.blocks();
+    for (size_t i = n_begin; i < n_end; i++) {
+        const auto* values = w.values + w.rowOffsets[i];
+        const auto* masks = w.masks + i * blocks;
+        std::array<float, R> acc{};
+        for (size_t b = 0; b < blocks; b++) {
+            const auto k = b * SparseFCWeights::blockSize;
+            for (uint32_t mask = masks[b], lane = 0; mask != 0; mask >>= 1U, lane++) {
+                if (mask & 1U) {
+                    for (size_t r = 0; r < R; r++) {
+                        acc[r] += *values * src[r * src_stride + k + lane];
+                    }
+                    values++;
+                }
+            }
+        }
+        for (size_t r = 0; r < R; r++) {
+            dst[r * dst_stride + i] = acc[r] + (bias ? bias[i] : 0.0F);
+        }
+    }
+}
+
+template <size_t R>
+void structured(const SparseFCWeights& w,
+                const float* src,
+                size_t src_stride,
+                float* dst,
+                size_t dst_stride,
+                const float* bias,
+                size_t n_begin,
+                size_t n_end) {
+    const auto chunks = w.chunks();
+    const auto slots = w.slots();
+    for (size_t i = n_begin; i < n_end; i++) {
+        const auto* values = w.values + i * chunks * slots;
+        const auto* positions = w.positions + i * chunks * slots;
+        std::array<float, R> acc{};
+        for (size_t c = 0; c < chunks; c++) {
+            const auto k = c * SparseFCWeights::chunkSize;
+            for (size_t s = 0; s < slots; s++) {
+                for (size_t r = 0; r < R; r++) {
+                    acc[r] += values[s] * src[r * src_stride + k + positions[s]];
+                }
+            }
+            values += slots;
+            positions += slots;
+        }
+        for (size_t r = 0; r < R; r++) {
+            dst[r * dst_stride + i] = acc[r] + (bias ? bias[i] : 0.0F);
+        }
+    }
+}
+
+#endif
+
+template <size_t R>
+void sparse_fc_rows(const SparseFCWeights& w,
+                    const float* src,
+                    size_t src_stride,
+                    float* dst,
+                    size_t dst_stride,
+                    const float* bias,
+                    size_t n_begin,
+                    size_t n_end) {
+    if (w.format == SparseFCWeights::Format::Structured) {
+        structured<R>(w, src, src_stride, dst, dst_stride, bias, n_begin, n_end);
+    } else {
+        unstructured<R>(w, src, src_stride, dst, dst_stride, bias, n_begin, n_end);
+    }
+}
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+
+// The tile of the rows of src is transposed to [K, rows], so each non zero weight is broadcasted and multiplied by
+// the vectors of the rows: the work is proportional to the number of the non zero weights, which pays off for the
+// large number of the rows. The input channels of the weights are decoded to the indices first, so the accumulation
+// loop has no data dependent branches, and the independent accumulators hide the latency of FMA.
+template <size_t rows>
+class TransposedTile {
+public:
+    static constexpr size_t V = rows / vec_len;
+
+    explicit TransposedTile(const float* srcT) : m_srcT(srcT) {}
+
+    void run(const SparseFCWeights& w, float* dst, size_t dst_stride, const float* bias, size_t n_begin, size_t n_end) {
+        float out[rows];
+        for (size_t i = n_begin; i < n_end; i++) {
+            for (auto& acc : m_acc) {
+                for (size_t v = 0; v < V; v++) {
+                    acc[v] = vec_zero();
+                }
+            }
+            if (w.format == SparseFCWeights::Format::Structured) {
+                structured(w, i);
+            } else {
+                unstructured(w, i);
+            }
+            for (size_t v = 0; v < V; v++) {
+                const auto sum = vec_add(vec_add(m_acc[0][v], m_acc[1][v]), vec_add(m_acc[2][v], m_acc[3][v]));
+                vec_store(out + v * vec_len, sum);
+            }
+            const auto b = bias ? bias[i] : 0.0F;
+            for (size_t r = 0; r < rows; r++) {
+                dst[r * dst_stride + i] = out[r] + b;
+            }
+        }
+    }
+
+private:
+    // blocks of the unstructured format or chunks of the structured one decoded at once
+    static constexpr size_t group = 32;
+    static constexpr size_t chains = 4;
+
+    void unstructured(const SparseFCWeights& w, size_t i) {
+        const auto blocks = w.blocks();
+        const auto* values = w.values + w.rowOffsets[i];
+        const auto* masks = w.masks + i * blocks;
+        for (size_t b0 = 0; b0 < blocks; b0 += group) {
+            size_t count = 0;
+            for (size_t b = b0; b < std::min(b0 + group, blocks); b++) {
+                for (size_t half = 0; half < 2; half++) {
+                    const auto byte = (masks[b] >> (8 * half)) & 0xFFU;
+                    const auto k = static_cast<uint32_t>(b * SparseFCWeights::blockSize + 8 * half);
+                    // all the 8 positions are written, the ones past the count are overwritten by the next byte
+                    for (size_t j = 0; j < 8; j++) {
+                        m_ks[count + j] = k + bitPositions.positions[byte][j];
+                    }
+                    count += bitPositions.count[byte];
+                }
+            }
+            accumulate(values, count);
+            values += count;
+        }
+    }
+
+    void structured(const SparseFCWeights& w, size_t i) {
+        const auto chunks = w.chunks();
+        const auto slots = w.slots();
+        const auto* values = w.values + i * chunks * slots;
+        const auto* positions = w.positions + i * chunks * slots;
+        for (size_t c0 = 0; c0 < chunks; c0 += group) {
+            size_t count = 0;
+            for (size_t c = c0; c < std::min(c0 + group, chunks); c++) {
+                const auto k = static_cast<uint32_t>(c * SparseFCWeights::chunkSize);
+                for (size_t s = 0; s < slots; s++) {
+                    m_ks[count++] = k + *positions++;
+                }
+            }
+            accumulate(values, count);
+            values += count;
+        }
+    }
+
+    void accumulate(const float* values, size_t count) {
+        size_t j = 0;
+        for (; j + chains <= count; j += chains) {
+            for (size_t c = 0; c < chains; c++) {
+                fmadd(m_acc[c], values[j + c], m_ks[j + c]);
+            }
+        }
+        for (; j < count; j++) {
+            fmadd(m_acc[0], values[j], m_ks[j]);
+        }
+    }
+
+    void fmadd(vec (&acc)[V], float value, size_t k) {
+        const auto weight = vec_set1(value);
+        const auto* x = m_srcT + k * rows;
+        for (size_t v = 0; v < V; v++) {
+            acc[v] = vec_fmadd(weight, vec_load(x + v * vec_len), acc[v]);
+        }
+    }
+
+    const float* m_srcT;
+    vec m_acc[chains][V];
+    // input channels of the decoded weights, the unstructured decoding writes up to 8 positions past the count
+    uint32_t m_ks[group * SparseFCWeights::chunkSize + 8];
+};
+
+template <size_t rows>
+void transpose_tile(const float* src, size_t src_stride, size_t K, float* srcT) {
+    constexpr size_t block = 16;
+    for (size_t r = 0; r < rows; r += block) {
+        const auto* x = src + r * src_stride;
+        size_t k = 0;
+        for (; k + block <= K; k += block) {
+            transpose_16x16_kernel(srcT + k * rows + r, x + k, rows, src_stride);
+        }
+        if (k < K) {
+            transpose_16xK_kernel(srcT + k * rows + r, x + k, K - k, rows, src_stride);
+        }
+    }
+}
+
+#endif
+
+}  // namespace
+
+void sparse_fc_transpose([[maybe_unused]] const float* src,
+                         [[maybe_unused]] size_t src_stride,
+                         [[maybe_unused]] size_t rows,
+                         [[maybe_unused]] size_t K,
+                         [[maybe_unused]] float* srcT) {
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    constexpr auto tile = SparseFCWeights::tileRows;
+    size_t r = 0;
+    for (; r + tile <= rows; r += tile) {
+        transpose_tile<tile>(src + r * src_stride, src_stride, K, srcT + r * K);
+    }
+    if (r + tile / 2 <= rows) {
+        transpose_tile<tile / 2>(src + r * src_stride, src_stride, K, srcT + r * K);
+    }
+#endif
+}
+
+void sparse_fc(const SparseFCWeights& weights,
+               const float* src,
+               size_t src_stride,
+               [[maybe_unused]] const float* srcT,
+               float* dst,
+               size_t dst_stride,
+               const float* bias,
+               size_t rows,
+               size_t n_begin,
+               size_t n_end) {
+    size_t r = 0;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    if (srcT) {
+        constexpr auto tile = SparseFCWeights::tileRows;
+        for (; r + tile <= rows; r += tile) {
+            TransposedTile<tile>(srcT + r * weights.K)
+                .run(weights, dst + r * dst_stride, dst_stride, bias, n_begin, n_end);
+        }
+        if (r + tile / 2 <= rows) {
+            TransposedTile<tile / 2>(srcT + r * weights.K)
+                .run(weights, dst + r * dst_stride, dst_stride, bias, n_begin, n_end);
+            r += tile / 2;
+        }
+    }
+#endif
+    for (; r + rowBlock <= rows; r += rowBlock) {
+        sparse_fc_rows<rowBlock>(weights,
+                                 src + r * src_stride,
+                                 src_stride,
+                                 dst + r * dst_stride,
+                                 dst_stride,
+                                 bias,
+                                 n_begin,
+                                 n_end);
+    }
+    const auto* tail_src = src + r * src_stride;
+    auto* tail_dst = dst + r * dst_stride;
+    switch (rows - r) {
+    case 3:
+        sparse_fc_rows<3>(weights, tail_src, src_stride, tail_dst, dst_stride, bias, n_begin, n_end);
+        break;
+    case 2:
+        sparse_fc_rows<2>(weights, tail_src, src_stride, tail_dst, dst_stride, bias, n_begin, n_end);
+        break;
+    case 1:
+        sparse_fc_rows<1>(weights, tail_src, src_stride, tail_dst, dst_stride, bias, n_begin, n_end);
+        break;
+    default:
+        break;
+    }
+}
+
+}  // namespace ov::Extensions::Cpu::XARCH
@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+
+#include "nodes/kernels/x64/sparse_fc_weights.hpp"
+
+namespace ov::Extensions::Cpu::XARCH {
+
+/**
+ * @brief Transposes the tiles of the rows of src [rows, K] for sparse_fc(), srcT is rows * K floats.
+ *
+ * The rows which don't make up a whole tile aren't transposed, sparse_fc() processes them as is.
+ */
+void sparse_fc_transpose(const float* src, size_t src_stride, size_t rows, size_t K, float* srcT);
+
+/**
+ * @brief FullyConnected with the packed sparse weights: dst[rows, n_begin:n_end] = src[rows, K] * weights^T + bias
+ *
+ * The zero weights are skipped, so the amount of the work is proportional to the number of the non zero weights.
+ * srcT is src transposed by sparse_fc_transpose(), which pays off for the large number of the rows, or nullptr.
+ * The bias may be nullptr.
+ */
+void sparse_fc(const ov::intel_cpu::SparseFCWeights& weights,
+               const float* src,
+               size_t src_stride,
+               const float* srcT,
+               float* dst,
+               size_t dst_stride,
+               const float* bias,
+               size_t rows,
+               size_t n_begin,
+               size_t n_end);
+
+}  // namespace ov::Extensions::Cpu::XARCH
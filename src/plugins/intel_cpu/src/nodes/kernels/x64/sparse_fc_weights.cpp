@@ -0,0 +1,209 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_fc_weights.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+struct Header {
+    SparseFCWeights::Format format;
+    uint32_t n;
+    uint32_t m;
+    uint32_t reserved;
+    uint64_t N;
+    uint64_t K;
+    // number of the stored values without the padding
+    uint64_t values;
+};
+
+struct Sections {
+    size_t rowOffsets = 0;
+    size_t masks = 0;
+    size_t positions = 0;
+    size_t values = 0;
+    size_t size = 0;
+};
+
+constexpr size_t alignment = 64;
+// the kernels load the full vectors of the values and the positions past the last ones
+constexpr size_t tailPadding = SparseFCWeights::blockSize;
+// the group sizes checked for the N:M structure, each of them divides the chunk size
+constexpr size_t groupSizes[] = {4, 8, 16};
+
+size_t alignUp(size_t size) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+Sections sections(const Header& header) {
+    Sections result;
+    size_t offset = alignUp(sizeof(Header));
+    const auto add = [&offset](size_t bytes) {
+        const auto begin = offset;
+        offset = alignUp(offset + bytes);
+        return begin;
+    };
+    if (header.format == SparseFCWeights::Format::Unstructured) {
+        const auto blocks = (header.K + SparseFCWeights::blockSize - 1) / SparseFCWeights::blockSize;
+        result.rowOffsets = add((header.N + 1) * sizeof(uint64_t));
+        result.masks = add(header.N * blocks * sizeof(uint16_t));
+    } else {
+        result.positions = add(header.values + tailPadding);
+    }
+    result.values = add((header.values + tailPadding) * sizeof(float));
+    result.size = offset;
+    return result;
+}
+
+// max number of the non zero weights per group of m input channels
+size_t maxGroupNonZeros(const float* weights, size_t N, size_t K, size_t m) {
+    size_t result = 0;
+    for (size_t i = 0; i < N; i++) {
+        const auto* row = weights + i * K;
+        for (size_t k = 0; k < K; k += m) {
+            const auto end = std::min(k + m, K);
+            const auto nonZeros = static_cast<size_t>(std::count_if(row + k, row + end, [](float value) {
+                return value != 0.0F;
+            }));
+            result = std::max(result, nonZeros);
+        }
+    }
+    return result;
+}
+
+Header plan(const float* weights, size_t N, size_t K) {
+    const auto nonZeros = static_cast<uint64_t>(std::count_if(weights, weights + N * K, [](float value) {
+        return value != 0.0F;
+    }));
+    Header header{SparseFCWeights::Format::Unstructured, 0, 0, 0, N, K, nonZeros};
+
+    // the lowest density of the N:M structures, the dense groups are not worth the positions overhead
+    size_t n = 0;
+    size_t m = 0;
+    for (const auto groupSize : groupSizes) {
+        const auto groupNonZeros = std::max<size_t>(maxGroupNonZeros(weights, N, K, groupSize), 1);
+        if (2 * groupNonZeros <= groupSize && (m == 0 || groupNonZeros * m < n * groupSize)) {
+            n = groupNonZeros;
+            m = groupSize;
+        }
+    }
+    if (m == 0) {
+        return header;
+    }
+
+    // the structured format is used when the padding of the groups doesn't add much work over the unstructured one
+    const auto chunks = (K + SparseFCWeights::chunkSize - 1) / SparseFCWeights::chunkSize;
+    const auto values = N * chunks * (SparseFCWeights::chunkSize / m * n);
+    if (4 * values <= 5 * nonZeros) {
+        header.format = SparseFCWeights::Format::Structured;
+        header.n = static_cast<uint32_t>(n);
+        header.m = static_cast<uint32_t>(m);
+        header.values = values;
+    }
+    return header;
+}
+
+void packUnstructured(const float* weights, const Header& header, uint8_t* packed, const Sections& layout) {
+    auto* rowOffsets = reinterpret_cast<uint64_t*>(packed + layout.rowOffsets);
+    auto* masks = reinterpret_cast<uint16_t*>(packed + layout.masks);
+    auto* values = reinterpret_cast<float*>(packed + layout.values);
+
+    uint64_t offset = 0;
+    for (size_t i = 0; i < header.N; i++) {
+        rowOffsets[i] = offset;
+        const auto* row = weights + i * header.K;
+        for (size_t k = 0; k < header.K; k += SparseFCWeights::blockSize) {
+            uint16_t mask = 0;
+            const auto end = std::min<size_t>(k + SparseFCWeights::blockSize, header.K);
+            for (auto j = k; j < end; j++) {
+                if (row[j] != 0.0F) {
+                    mask |= static_cast<uint16_t>(1U << (j - k));
+                    values[offset++] = row[j];
+                }
+            }
+            *masks++ = mask;
+        }
+    }
+    rowOffsets[header.N] = offset;
+}
+
+void packStructured(const float* weights, const Header& header, uint8_t* packed, const Sections& layout) {
+    auto* positions = packed + layout.positions;
+    auto* values = reinterpret_cast<float*>(packed + layout.values);
+
+    const size_t m = header.m;
+    const size_t n = header.n;
+    for (size_t i = 0; i < header.N; i++) {
+        const auto* row = weights + i * header.K;
+        for (size_t chunk = 0; chunk < header.K; chunk += SparseFCWeights::chunkSize) {
+            for (size_t group = chunk; group < chunk + SparseFCWeights::chunkSize; group += m) {
+                size_t stored = 0;
+                for (auto k = group; k < std::min(group + m, static_cast<size_t>(header.K)); k++) {
+                    if (row[k] != 0.0F) {
+                        *positions++ = static_cast<uint8_t>(k - chunk);
+                        *values++ = row[k];
+                        stored++;
+                    }
+                }
+                // the padding refers to the first input channel of the chunk, which always exists
+                for (; stored < n; stored++) {
+                    *positions++ = 0;
+                    *values++ = 0.0F;
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+size_t SparseFCWeights::packedSize(const float* weights, size_t N, size_t K) {
+    return sections(plan(weights, N, K)).size;
+}
+
+void SparseFCWeights::pack(const float* weights, size_t N, size_t K, void* packed) {
+    const auto header = plan(weights, N, K);
+    const auto layout = sections(header);
+    auto* data = static_cast<uint8_t*>(packed);
+    std::memset(data, 0, layout.size);
+    std::memcpy(data, &header, sizeof(Header));
+    if (header.format == Format::Unstructured) {
+        packUnstructured(weights, header, data, layout);
+    } else {
+        packStructured(weights, header, data, layout);
+    }
+}
+
+SparseFCWeights SparseFCWeights::view(const void* packed) {
+    OPENVINO_ASSERT(packed, "Sparse FullyConnected weights are not packed");
+    const auto* data = static_cast<const uint8_t*>(packed);
+    Header header{};
+    std::memcpy(&header, data, sizeof(Header));
+    const auto layout = sections(header);
+
+    SparseFCWeights result;
+    result.format = header.format;
+    result.N = header.N;
+    result.K = header.K;
+    result.n = header.n;
+    result.m = header.m;
+    result.values = reinterpret_cast<const float*>(data + layout.values);
+    if (header.format == Format::Unstructured) {
+        result.rowOffsets = reinterpret_cast<const uint64_t*>(data + layout.rowOffsets);
+        result.masks = reinterpret_cast<const uint16_t*>(data + layout.masks);
+    } else {
+        result.positions = data + layout.positions;
+    }
+    return result;
+}
+
+}  // namespace ov::intel_cpu
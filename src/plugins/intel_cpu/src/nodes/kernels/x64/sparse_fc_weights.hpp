@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief FullyConnected weights [N, K] packed for the sparse kernels, the zero weights are skipped.
+ *
+ * Unstructured format: the rows are split into the blocks of 16 input channels. Each block has a bitmask of the non zero
+ * weights and the non zero values of a row are stored contiguously.
+ *
+ * Structured format: each group of m consecutive input channels has at most n non zero weights (N:M sparsity). The rows
+ * are split into the chunks of 32 input channels, so every chunk stores the same number of the values along with their
+ * positions in the chunk, the groups with less than n non zero weights are padded by zeros.
+ *
+ * The structure is a view of the packed weights memory, which is produced by pack().
+ */
+struct SparseFCWeights {
+    enum class Format : uint32_t { Unstructured, Structured };
+
+    static constexpr size_t blockSize = 16;
+    static constexpr size_t chunkSize = 32;
+    // rows of src transposed by the kernels at once
+    static constexpr size_t tileRows = 32;
+
+    Format format = Format::Unstructured;
+    size_t N = 0;
+    size_t K = 0;
+    // N:M sparsity of the structured format
+    size_t n = 0;
+    size_t m = 0;
+
+    // unstructured: offsets of the rows in the values (N + 1) and the bitmasks of the blocks of the rows
+    const uint64_t* rowOffsets = nullptr;
+    const uint16_t* masks = nullptr;
+    // structured: positions of the values in their chunks
+    const uint8_t* positions = nullptr;
+    const float* values = nullptr;
+
+    [[nodiscard]] size_t blocks() const {
+        return (K + blockSize - 1) / blockSize;
+    }
+
+    [[nodiscard]] size_t chunks() const {
+        return (K + chunkSize - 1) / chunkSize;
+    }
+
+    // number of the values per chunk of the structured format
+    [[nodiscard]] size_t slots() const {
+        return m == 0 ? 0 : chunkSize / m * n;
+    }
+
+    /**
+     * @brief Size of the packed weights in bytes. The structured format is selected when the weights have the N:M
+     * structure with at most half of the weights of a group being non zero and the groups are mostly filled, the
+     * unstructured one otherwise.
+     */
+    static size_t packedSize(const float* weights, size_t N, size_t K);
+
+    /**
+     * @brief Packs the dense weights [N, K] into the memory of packedSize() bytes
+     */
+    static void pack(const float* weights, size_t N, size_t K, void* packed);
+
+    static SparseFCWeights view(const void* packed);
+};
+
+}  // namespace ov::intel_cpu
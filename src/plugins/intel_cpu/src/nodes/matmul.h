@@ -31,6 +31,9 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     [[nodiscard]] bool canFuse(const NodePtr& node) const override;
     [[nodiscard]] bool created() const override;
+    [[nodiscard]] std::string getAutotunedImplementation() const override {
+        return m_executor ? m_executor->autotunedImplementation() : std::string{};
+    }
 
     [[nodiscard]] ov::element::Type getRuntimePrecision() const override;
     [[nodiscard]] const std::vector<impl_desc_type>& getDefaultImplPriority() override;
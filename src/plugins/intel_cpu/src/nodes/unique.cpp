@@ -14,10 +14,10 @@
 #include <openvino/op/constant.hpp>
 #include <openvino/op/unique.hpp>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "common/cpu_memcpy.h"
+#include "common/unique_kernel.h"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -201,80 +201,7 @@ void Unique::flattenTensorExec() {
     if (definedOutputs[OCCURRENCES_NUM]) {
         occurTmpPtr = occurTmp.data();
     }
-    uniqueLen = inputLen;
-
-    if (sorted) {
-        cpu_parallel_memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        auto* last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        uniqueLen = last - uniDataTmpPtr;
-
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
-                }
-            }
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (size_t i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
-                }
-                for (size_t j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
-                    }
-                }
-            }
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (size_t j = 0; j < uniqueLen; j++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
-                }
-            }
-        }
-    } else {
-        std::unordered_map<T, int32_t> uniq;
-        uniq.reserve(inputLen);
-
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + inputLen, 1);
-        }
-
-        for (size_t i = 0, j = 0; i < inputLen; ++i) {
-            auto it = uniq.emplace(srcDataPtr[i], j);
-            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-                inToOutTmpPtr[i] = it.first->second;
-                if (it.second) {
-                    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                        firstTmpPtr[j] = i;
-                    }
-                    ++j;
-                } else {
-                    if (definedOutputs[OCCURRENCES_NUM]) {
-                        occurTmpPtr[inToOutTmpPtr[i]]++;
-                    }
-                }
-            }
-        }
-
-        uniqueLen = static_cast<int64_t>(uniq.size());
-        for (const auto& it : uniq) {
-            uniDataTmpPtr[it.second] = it.first;
-        }
-    }
+    uniqueLen = flattenedUnique(srcDataPtr, inputLen, sorted, uniDataTmpPtr, firstTmpPtr, inToOutTmpPtr, occurTmpPtr);
 
     redefineOutputMemory({{uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
 
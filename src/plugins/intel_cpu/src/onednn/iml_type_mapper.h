@@ -112,6 +112,9 @@ enum impl_desc_type : int64_t {
     brgemm_avx512_amx = brgemm | avx512 | amx,
     brgemm_sparse_avx512_amx = brgemm | sparse | avx512 | amx,
 
+    jit_sparse_avx512 = jit | sparse | avx512,
+    jit_sparse_avx2 = jit | sparse | avx2,
+
     dw_acl = _dw | acl,
     gemm_acl = gemm | acl,
     winograd_acl = winograd | acl,
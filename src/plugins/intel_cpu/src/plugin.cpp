@@ -4,6 +4,7 @@
 
 #include "plugin.h"
 
+#include <chrono>
 #include <cstddef>
 #include <cstring>
 #include <filesystem>
@@ -26,6 +27,7 @@
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "cpu_streams_calculation.hpp"
 #include "graph_context.h"
+#include "host_scheduler.hpp"
 #include "internal_properties.hpp"
 #include "itt.h"
 #include "node.h"
@@ -58,6 +60,7 @@
 #include "utils/codec_xor.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/denormals.hpp"
+#include "utils/general_utils.h"
 #include "utils/graph_serializer/deserializer.hpp"
 #include "utils/graph_serializer/serializer.hpp"
 #include "utils/precision_support.h"
@@ -412,7 +415,9 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
             denormals_as_zero(false);
         }
     }
-    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    auto compiled_model = std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    compiled_model->warm_up_kernels();
+    return compiled_model;
 }
 
 void Plugin::set_property(const ov::AnyMap& config) {
@@ -467,6 +472,9 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
         const auto& distribution_policy = engConfig.modelDistributionPolicy;
         return distribution_policy;
     }
+    if (name == ov::hint::model_priority) {
+        return engConfig.modelPriority;
+    }
     if (name == ov::hint::enable_hyper_threading) {
         const bool ht_value = engConfig.enableHyperThreading;
         return static_cast<decltype(ov::hint::enable_hyper_threading)::value_type>(ht_value);
@@ -564,6 +572,9 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
             RO_property(ov::device::capabilities.name()),
             RO_property(ov::device::type.name()),
             RO_property(ov::device::architecture.name()),
+            RO_property(ov::intel_cpu::cpu_queueing_delay_high.name()),
+            RO_property(ov::intel_cpu::cpu_queueing_delay_medium.name()),
+            RO_property(ov::intel_cpu::cpu_queueing_delay_low.name()),
         };
         // the whole config is RW before model is loaded.
 
@@ -579,6 +590,7 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
                                                    RW_property(ov::hint::scheduling_core_type.name()),
                                                    RW_property(ov::hint::model_distribution_policy.name()),
                                                    RW_property(ov::hint::enable_hyper_threading.name()),
+                                                   RW_property(ov::hint::model_priority.name()),
                                                    RW_property(ov::device::id.name()),
                                                    RW_property(ov::intel_cpu::denormals_optimization.name()),
                                                    RW_property(ov::log::level.name()),
@@ -648,6 +660,19 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
         const std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         return decltype(ov::range_for_streams)::value_type(range);
     }
+    if (any_of(name,
+               ov::intel_cpu::cpu_queueing_delay_high.name(),
+               ov::intel_cpu::cpu_queueing_delay_medium.name(),
+               ov::intel_cpu::cpu_queueing_delay_low.name())) {
+        // the scheduler is shared by all the compiled models of the process
+        const auto priority = name == ov::intel_cpu::cpu_queueing_delay_high     ? ov::hint::Priority::HIGH
+                              : name == ov::intel_cpu::cpu_queueing_delay_medium ? ov::hint::Priority::MEDIUM
+                                                                                  : ov::hint::Priority::LOW;
+        const auto stats = HostScheduler::instance()->getStatistics(priority);
+        const auto delay = stats.inferences > 0 ? stats.queueingDelay / stats.inferences : std::chrono::nanoseconds{0};
+        return static_cast<decltype(ov::intel_cpu::cpu_queueing_delay_high)::value_type>(
+            std::chrono::duration_cast<std::chrono::microseconds>(delay).count());
+    }
     if (name == ov::internal::caching_properties) {
         std::vector<ov::PropertyName> cachingProperties = {ov::device::full_name};
         return decltype(ov::internal::caching_properties)::value_type(std::move(cachingProperties));
@@ -803,7 +828,14 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
 
     // import config props from caching model
     calculate_streams(conf, model, true);
-    auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    auto compiled_model = std::make_shared<CompiledModel>(model,
+                                                          shared_from_this(),
+                                                          conf,
+                                                          loaded_from_cache,
+                                                          nullptr,
+                                                          deserializer.get_packed_weights(),
+                                                          deserializer.get_executor_decisions());
+    compiled_model->warm_up_kernels();
     return compiled_model;
 }
 }  // namespace ov::intel_cpu
@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_buckets.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::intel_cpu {
+
+ShapeBuckets::ShapeBuckets(size_t capacity, size_t nodes) : m_capacity(capacity), m_nodes(nodes) {
+    OPENVINO_ASSERT(m_capacity > 0, "Shape buckets capacity must be positive");
+}
+
+bool ShapeBuckets::select(const InputShapes& shapes) {
+    auto it = m_index.find(shapes);
+    if (it != m_index.end()) {
+        m_buckets.splice(m_buckets.begin(), m_buckets, it->second);
+        m_selected = &m_buckets.front();
+        m_hits++;
+        return true;
+    }
+
+    m_misses++;
+    if (m_buckets.size() == m_capacity) {
+        m_index.erase(m_buckets.back().shapes);
+        m_buckets.pop_back();
+        m_evictions++;
+    }
+    m_buckets.push_front({shapes, std::vector<Entry>(m_nodes)});
+    m_index.emplace(shapes, m_buckets.begin());
+    m_selected = &m_buckets.front();
+    return false;
+}
+
+ShapeBuckets::Statistics ShapeBuckets::getStatistics() const {
+    return {m_hits.load(), m_misses.load(), m_evictions.load()};
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "cpu_types.h"
+#include "shape_inference/shape_inference_cpu.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Shape inference results of the nodes of a dynamic graph per set of the graph input shapes (bucket).
+ *
+ * The output shapes of the nodes are fully defined by the input shapes of the graph unless some shape inference depends
+ * on the data, so the graph which was already executed with the same input shapes replays the recorded results instead
+ * of the shape inference of all the nodes. The least recently used bucket is evicted when the capacity is exceeded.
+ * Only the shape inference is replayed: as without the buckets, prepareParams() runs only for the nodes which input
+ * shapes differ from the previous inference, and it hits the runtime parameters cache for the shapes seen before.
+ *
+ * The buckets are selected and filled by the inference of the graph only, the statistics may be read concurrently.
+ */
+class ShapeBuckets {
+public:
+    using InputShapes = std::vector<VectorDims>;
+    using Entry = std::optional<IShapeInfer::Result>;
+
+    struct Statistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+    };
+
+    /**
+     * @param capacity max number of the buckets
+     * @param nodes number of the nodes with the recorded shape inference results per bucket
+     */
+    ShapeBuckets(size_t capacity, size_t nodes);
+
+    /**
+     * @brief Selects the bucket of the input shapes, the new bucket has no results recorded
+     * @return true if the bucket already exists
+     */
+    bool select(const InputShapes& shapes);
+
+    /**
+     * @brief Shape inference result of the node in the selected bucket, the node records it if it's not set
+     */
+    Entry& entry(size_t node) {
+        return m_selected->entries[node];
+    }
+
+    [[nodiscard]] Statistics getStatistics() const;
+
+private:
+    struct Bucket {
+        InputShapes shapes;
+        std::vector<Entry> entries;
+    };
+
+    const size_t m_capacity;
+    const size_t m_nodes;
+    // the most recently used bucket is the first one
+    std::list<Bucket> m_buckets;
+    std::map<InputShapes, std::list<Bucket>::iterator> m_index;
+    Bucket* m_selected = nullptr;
+
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+    std::atomic<uint64_t> m_evictions{0};
+};
+
+}  // namespace ov::intel_cpu
@@ -10,6 +10,7 @@
 #include <filesystem>
 #include <functional>
 #include <istream>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -40,6 +41,7 @@
 #include "openvino/util/xml_parse_utils.hpp"
 #include "openvino/xml_util/xml_deserialize_util.hpp"
 #include "utils/codec_xor.hpp"
+#include "utils/graph_serializer/packed_weights.hpp"
 
 namespace ov::intel_cpu {
 
@@ -87,6 +89,36 @@ ModelDeserializer::ModelDeserializer(std::istream& model_stream,
 
 void ModelDeserializer::set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model) {}
 
+size_t ModelDeserializer::get_packed_weights_offset(const pugi::xml_node& packed, size_t xml_size) {
+    const auto alignment = static_cast<size_t>(ov::util::pugixml::get_uint64_attr(packed, "alignment"));
+    const auto shift = static_cast<size_t>(ov::util::pugixml::get_uint64_attr(packed, "shift"));
+    OPENVINO_ASSERT(alignment > 0 && shift < alignment, "[CPU] Unexpected packed weights alignment.");
+    return (shift + xml_size + 1 + alignment - 1) / alignment * alignment - shift;
+}
+
+void ModelDeserializer::set_packed_weights(const pugi::xml_node& packed,
+                                           const std::shared_ptr<ov::AlignedBuffer>& payload) {
+    m_packed_weights = std::make_shared<PackedWeights>();
+    m_packed_weights->isa = ov::util::pugixml::get_str_attr(packed, "isa");
+    for (const auto& weights : packed.children("weights")) {
+        const auto offset = static_cast<size_t>(ov::util::pugixml::get_uint64_attr(weights, "offset"));
+        const auto size = static_cast<size_t>(ov::util::pugixml::get_uint64_attr(weights, "size"));
+        OPENVINO_ASSERT(offset <= payload->size() && size <= payload->size() - offset,
+                        "[CPU] Packed weights are out of the custom data.");
+        m_packed_weights->buffers[ov::util::pugixml::get_str_attr(weights, "key")] =
+            std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(payload->get_ptr<char>() + offset,
+                                                                                   size,
+                                                                                   payload);
+    }
+}
+
+void ModelDeserializer::set_executor_decisions(const pugi::xml_node& root) {
+    for (const auto& decision : root.child("executor_decisions").children("decision")) {
+        m_executor_decisions[ov::util::pugixml::get_str_attr(decision, "key")] =
+            ov::util::pugixml::get_str_attr(decision, "implementation");
+    }
+}
+
 void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
     std::visit(
         [&](auto&& arg) {
@@ -164,11 +196,23 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     // Read model input/output precisions.
     pugi::xml_document xml_in_out_doc;
     if (hdr.custom_data_size > 0LU) {
+        // the xml may be followed by the zero terminated binary data
+        const auto xml_size = strnlen(buffer_base + hdr.custom_data_offset, hdr.custom_data_size);
         auto res = xml_in_out_doc.load_buffer(buffer_base + hdr.custom_data_offset,
-                                              hdr.custom_data_size,
+                                              xml_size,
                                               pugi::parse_default,
                                               pugi::encoding_utf8);
         OPENVINO_ASSERT(res.status == pugi::status_ok, "[CPU] Could to deserialize custom data.");
+
+        if (auto packed = xml_in_out_doc.child("cnndata").child("packed_weights")) {
+            const auto offset = get_packed_weights_offset(packed, xml_size);
+            OPENVINO_ASSERT(offset <= hdr.custom_data_size, "[CPU] Packed weights are out of the custom data.");
+            set_packed_weights(packed,
+                               std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
+                                   buffer_base + hdr.custom_data_offset + offset,
+                                   hdr.custom_data_size - offset,
+                                   model_buffer));
+        }
     }
 
     // Map blob content
@@ -201,6 +245,7 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     // Set Info
     pugi::xml_node root = xml_in_out_doc.child("cnndata");
     set_info(root, model);
+    set_executor_decisions(root);
 }
 
 void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
@@ -234,6 +279,14 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
         auto res = xmlInOutDoc.load_string(xmlInOutString.c_str());
         OPENVINO_ASSERT(res.status == pugi::status_ok,
                         "NetworkNotRead: The inputs and outputs information is invalid.");
+
+        if (auto packed = xmlInOutDoc.child("cnndata").child("packed_weights")) {
+            const auto offset = get_packed_weights_offset(packed, strlen(xmlInOutString.c_str()));
+            OPENVINO_ASSERT(offset <= hdr.custom_data_size, "[CPU] Packed weights are out of the custom data.");
+            auto payload = std::make_shared<ov::AlignedBuffer>(hdr.custom_data_size - offset, PackedWeights::alignment);
+            std::memcpy(payload->get_ptr(), xmlInOutString.data() + offset, payload->size());
+            set_packed_weights(packed, payload);
+        }
     }
 
     // read blob content
@@ -272,6 +325,7 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     // Set Info
     pugi::xml_node root = xmlInOutDoc.child("cnndata");
     set_info(root, model);
+    set_executor_decisions(root);
 };
 
 ov::Any XmlDeserializer::parse_weightless_cache_attribute(const pugi::xml_node& node) const {
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <istream>
+#include <map>
 #include <pugixml.hpp>
 #include <string>
 #include <variant>
@@ -14,6 +15,7 @@
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "utils/codec_xor.hpp"
+#include "utils/graph_serializer/packed_weights.hpp"
 
 namespace ov {
 class ICore;
@@ -89,9 +91,31 @@ public:
 
     void operator>>(std::shared_ptr<ov::Model>& model);
 
+    /**
+     * @brief Repacked weights stored with the model, null if there are none. The buffers refer to the model buffer
+     * (or to the copy of the data read from the stream).
+     */
+    [[nodiscard]] const PackedWeights::Ptr& get_packed_weights() const {
+        return m_packed_weights;
+    }
+
+    /**
+     * @brief Autotuned executor implementations stored with the model, keyed as ExecutorAutotuner does
+     */
+    [[nodiscard]] const std::map<std::string, std::string>& get_executor_decisions() const {
+        return m_executor_decisions;
+    }
+
 protected:
     static void set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model);
 
+    // Offset of the packed weights payload relatively to the custom data start
+    static size_t get_packed_weights_offset(const pugi::xml_node& packed, size_t xml_size);
+
+    void set_packed_weights(const pugi::xml_node& packed, const std::shared_ptr<ov::AlignedBuffer>& payload);
+
+    void set_executor_decisions(const pugi::xml_node& root);
+
     void process_model(std::shared_ptr<ov::Model>& model, const std::shared_ptr<ov::AlignedBuffer>& model_buffer);
 
     void process_model(std::shared_ptr<ov::Model>& model, std::reference_wrapper<std::istream> model_stream);
@@ -105,6 +129,8 @@ protected:
     CacheDecrypt m_cache_decrypt;
     bool m_decript_from_string;
     std::shared_ptr<ov::AlignedBuffer> m_origin_weights_buf;
+    PackedWeights::Ptr m_packed_weights;
+    std::map<std::string, std::string> m_executor_decisions;
 };
 
 }  //  namespace ov::intel_cpu
@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "openvino/runtime/aligned_buffer.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Weights repacked into the executor specific layouts, which are stored in the exported compiled model next to
+ * the original weights, so the import doesn't repeat the repacking.
+ *
+ * The buffers are keyed by the name of the source constant and the hash of the target memory descriptor. The layout
+ * chosen by the executors depends on the ISA, so the set is used only on the machine with the same ISA.
+ *
+ * Only the weights packed by the moment of the export are stored. With dynamic shapes the executors are created on the
+ * first inference, so a model exported before it stores no packed weights and the imported model packs them as usual.
+ */
+struct PackedWeights {
+    using Ptr = std::shared_ptr<PackedWeights>;
+    using CPtr = std::shared_ptr<const PackedWeights>;
+
+    // alignment of the buffers in the exported blob
+    static constexpr size_t alignment = 64;
+
+    std::string isa;
+    std::map<std::string, std::shared_ptr<ov::AlignedBuffer>> buffers;
+};
+
+}  // namespace ov::intel_cpu
@@ -8,9 +8,12 @@
 #include <cstdint>
 #include <cstring>
 #include <functional>
+#include <map>
 #include <memory>
 #include <ostream>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include "openvino/core/model.hpp"
 #include "openvino/core/node.hpp"
@@ -21,6 +24,7 @@
 #include "openvino/pass/serialize.hpp"
 #include "openvino/xml_util/constant_writer.hpp"
 #include "openvino/xml_util/xml_serialize_util.hpp"
+#include "utils/graph_serializer/packed_weights.hpp"
 
 namespace ov::intel_cpu {
 
@@ -140,14 +144,72 @@ private:
 
 ////////// ModelSerializer //////////
 
-ModelSerializer::ModelSerializer(std::ostream& ostream, const CacheEncrypt& encrypt_fn, bool weightless_mode)
+// The packed weights follow the zero terminated xml of the custom data. The payload and each buffer are aligned
+// relatively to the stream position, so they are aligned in the mapped cache file as well.
+static void write_packed_weights(std::ostream& stream,
+                                 pugi::xml_document& xml_doc,
+                                 const PackedWeights& packed_weights) {
+    const auto stream_pos = static_cast<std::streamoff>(stream.tellp());
+    const size_t shift = stream_pos > 0 ? static_cast<size_t>(stream_pos) % PackedWeights::alignment : 0;
+    auto align = [](size_t offset) {
+        return (offset + PackedWeights::alignment - 1) / PackedWeights::alignment * PackedWeights::alignment;
+    };
+
+    auto packed = xml_doc.document_element().append_child("packed_weights");
+    packed.append_attribute("isa").set_value(packed_weights.isa.c_str());
+    packed.append_attribute("alignment").set_value(static_cast<uint64_t>(PackedWeights::alignment));
+    packed.append_attribute("shift").set_value(static_cast<uint64_t>(shift));
+    size_t payload_size = 0;
+    for (const auto& [key, buffer] : packed_weights.buffers) {
+        payload_size = align(payload_size);
+        auto weights = packed.append_child("weights");
+        weights.append_attribute("key").set_value(key.c_str());
+        weights.append_attribute("offset").set_value(static_cast<uint64_t>(payload_size));
+        weights.append_attribute("size").set_value(static_cast<uint64_t>(buffer->size()));
+        payload_size += buffer->size();
+    }
+
+    std::ostringstream xml_stream;
+    xml_doc.save(xml_stream);
+    const auto xml = xml_stream.str();
+    stream.write(xml.c_str(), static_cast<std::streamsize>(xml.size() + 1));
+
+    const std::vector<char> zeros(PackedWeights::alignment, 0);
+    size_t written = align(shift + xml.size() + 1) - shift - (xml.size() + 1);
+    stream.write(zeros.data(), static_cast<std::streamsize>(written));
+    written = 0;
+    for (const auto& [key, buffer] : packed_weights.buffers) {
+        const auto padding = align(written) - written;
+        stream.write(zeros.data(), static_cast<std::streamsize>(padding));
+        stream.write(buffer->get_ptr<char>(), static_cast<std::streamsize>(buffer->size()));
+        written += padding + buffer->size();
+    }
+}
+
+ModelSerializer::ModelSerializer(std::ostream& ostream,
+                                 const CacheEncrypt& encrypt_fn,
+                                 bool weightless_mode,
+                                 const PackedWeights::CPtr& packed_weights,
+                                 const std::map<std::string, std::string>& executor_decisions)
     : ov::pass::StreamSerialize(
           ostream,
-          [](std::ostream& stream) {
+          [packed_weights, executor_decisions](std::ostream& stream) {
               pugi::xml_document xml_doc;
               pugi::xml_node root = xml_doc.append_child("cnndata");
               root.append_child("outputs");
-              xml_doc.save(stream);
+              if (!executor_decisions.empty()) {
+                  auto decisions = root.append_child("executor_decisions");
+                  for (const auto& [key, implementation] : executor_decisions) {
+                      auto decision = decisions.append_child("decision");
+                      decision.append_attribute("key").set_value(key.c_str());
+                      decision.append_attribute("implementation").set_value(implementation.c_str());
+                  }
+              }
+              if (packed_weights && !packed_weights->buffers.empty()) {
+                  write_packed_weights(stream, xml_doc, *packed_weights);
+              } else {
+                  xml_doc.save(stream);
+              }
           },
           encrypt_fn),
       m_weightless_mode(weightless_mode) {};
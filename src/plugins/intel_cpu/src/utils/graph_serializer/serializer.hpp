@@ -4,12 +4,14 @@
 
 #pragma once
 
+#include <map>
 #include <ostream>
 #include <pugixml.hpp>
 #include <string>
 
 #include "openvino/core/model.hpp"
 #include "openvino/pass/serialize.hpp"
+#include "utils/graph_serializer/packed_weights.hpp"
 
 namespace ov::intel_cpu {
 
@@ -17,7 +19,16 @@ class ModelSerializer : private ov::pass::StreamSerialize {
 public:
     using CacheEncrypt = std::function<std::string(const std::string&)>;
 
-    explicit ModelSerializer(std::ostream& ostream, const CacheEncrypt& encrypt_fn = {}, bool weightless_mode = false);
+    /**
+     * @param packed_weights repacked weights which are stored in the custom data section after the zero terminated
+     * xml, nothing is stored if it is null or empty
+     * @param executor_decisions autotuned executor implementations which are stored in the custom data xml
+     */
+    explicit ModelSerializer(std::ostream& ostream,
+                             const CacheEncrypt& encrypt_fn = {},
+                             bool weightless_mode = false,
+                             const PackedWeights::CPtr& packed_weights = nullptr,
+                             const std::map<std::string, std::string>& executor_decisions = {});
 
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
@@ -5,6 +5,8 @@
 #include "weights_cache.hpp"
 
 #include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -13,8 +15,12 @@
 #include <vector>
 
 #include "cpu_memory.h"
+#include "dnnl_extension_utils.h"
+#include "memory_desc/dnnl_memory_desc.h"
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/system_conf.hpp"
+#include "utils/graph_serializer/packed_weights.hpp"
 
 namespace ov::intel_cpu {
 
@@ -91,6 +97,94 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                           newPtr);
 }
 
+void WeightsSharing::registerConstant(const void* data, const std::string& name) {
+    std::lock_guard<std::mutex> lock(packedGuard);
+    auto [it, inserted] = constantsByName.emplace(name, data);
+    if (inserted) {
+        constantNames.emplace(data, name);
+    } else if (it->second != data) {
+        // the name is not unique, such constants are never exported
+        constantNames.erase(it->second);
+        it->second = nullptr;
+    }
+}
+
+WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreatePacked(const dnnl::engine& eng,
+                                                                     const MemoryCPtr& src,
+                                                                     const DnnlMemoryDescPtr& dstDesc,
+                                                                     const std::function<MemoryPtr(void)>& create) {
+    std::string packedKey;
+    {
+        std::lock_guard<std::mutex> lock(packedGuard);
+        auto found = constantNames.find(src->getData());
+        if (found != constantNames.end()) {
+            packedKey = found->second + "_" + std::to_string(DnnlExtensionUtils::computeWeightsDescHash(dstDesc));
+        }
+    }
+
+    const auto key = DnnlExtensionUtils::computeWeightsStringHash(src, dstDesc);
+    if (packedKey.empty()) {
+        return findOrCreate(key, create);
+    }
+
+    return findOrCreate(key, [&]() {
+        auto ptr = importPacked(eng, packedKey, dstDesc);
+        if (!ptr) {
+            ptr = create();
+        }
+        std::lock_guard<std::mutex> lock(packedGuard);
+        packedMemories[packedKey] = ptr;
+        return ptr;
+    });
+}
+
+MemoryPtr WeightsSharing::importPacked(const dnnl::engine& eng,
+                                       const std::string& packedKey,
+                                       const DnnlMemoryDescPtr& dstDesc) const {
+    std::shared_ptr<ov::AlignedBuffer> buffer;
+    {
+        std::lock_guard<std::mutex> lock(packedGuard);
+        if (!importedPackedWeights) {
+            return nullptr;
+        }
+        auto found = importedPackedWeights->buffers.find(packedKey);
+        if (found == importedPackedWeights->buffers.end()) {
+            return nullptr;
+        }
+        buffer = found->second;
+    }
+
+    if (buffer->size() != dstDesc->getCurrentMemSize()) {
+        return nullptr;
+    }
+    // the buffer of the mapped blob is used in place, unless it is misaligned
+    if (reinterpret_cast<uintptr_t>(buffer->get_ptr()) % PackedWeights::alignment == 0) {
+        return std::make_shared<Memory>(eng, dstDesc, buffer->get_ptr(), false);
+    }
+    auto ptr = std::make_shared<Memory>(eng, dstDesc);
+    std::memcpy(ptr->getData(), buffer->get_ptr(), buffer->size());
+    return ptr;
+}
+
+void WeightsSharing::setImportedPackedWeights(PackedWeights::CPtr packedWeights) {
+    std::lock_guard<std::mutex> lock(packedGuard);
+    importedPackedWeights = std::move(packedWeights);
+}
+
+void WeightsSharing::collectPackedWeights(PackedWeights& packedWeights) const {
+    std::lock_guard<std::mutex> lock(packedGuard);
+    for (const auto& [packedKey, weakPtr] : packedMemories) {
+        const auto memory = weakPtr.lock();
+        if (!memory || packedWeights.buffers.count(packedKey)) {
+            continue;
+        }
+        packedWeights.buffers[packedKey] = std::make_shared<ov::SharedBuffer<MemoryCPtr>>(
+            static_cast<char*>(memory->getData()),
+            memory->getDesc().getCurrentMemSize(),
+            memory);
+    }
+}
+
 SocketsWeights::SocketsWeights() {
     int num_sockets = get_num_sockets();
     for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
@@ -110,9 +204,8 @@ const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
     return found->second;
 }
 
-#ifdef CPU_DEBUG_CAPS
 WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
-    Statistics retVal = {0, 0};
+    Statistics retVal = {0, 0, 0};
 
     std::lock_guard<std::mutex> lock(guard);
 
@@ -121,6 +214,9 @@ WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
         if (memory) {
             retVal.total_size += memory->getDesc().getCurrentMemSize();
             retVal.total_memory_objects++;
+            if (memory->getMemoryBlock()->hasExtBuffer()) {
+                retVal.external_size += memory->getDesc().getCurrentMemSize();
+            }
         }
     }
 
@@ -137,5 +233,22 @@ std::vector<std::pair<int, WeightsSharing::Statistics>> SocketsWeights::dumpStat
 
     return retVal;
 }
-#endif  // CPU_DEBUG_CAPS
+
+void SocketsWeights::setImportedPackedWeights(const PackedWeights::CPtr& packedWeights) {
+    for (const auto& item : _cache_map) {
+        if (item.second) {
+            item.second->setImportedPackedWeights(packedWeights);
+        }
+    }
+}
+
+PackedWeights::Ptr SocketsWeights::collectPackedWeights() const {
+    auto packedWeights = std::make_shared<PackedWeights>();
+    for (const auto& item : _cache_map) {
+        if (item.second) {
+            item.second->collectPackedWeights(*packedWeights);
+        }
+    }
+    return packedWeights;
+}
 }  // namespace ov::intel_cpu
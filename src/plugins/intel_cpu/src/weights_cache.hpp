@@ -16,6 +16,8 @@
 #include <vector>
 
 #include "cpu_memory.h"
+#include "memory_desc/dnnl_memory_desc.h"
+#include "utils/graph_serializer/packed_weights.hpp"
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -42,12 +44,11 @@ class WeightsSharing {
     };
 
 public:
-#ifdef CPU_DEBUG_CAPS
     struct Statistics {
         size_t total_size;  // bytes
         size_t total_memory_objects;
+        size_t external_size;  // bytes of the memory objects viewing external buffers, e.g. the imported blob
     };
-#endif  // CPU_DEBUG_CAPS
 
     using Ptr = std::shared_ptr<WeightsSharing>;
 
@@ -73,13 +74,46 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
-#ifdef CPU_DEBUG_CAPS
+    /**
+     * Registers the memory of the constant weights under the name which is stable between the compilations of the
+     * model, so the weights repacked from this constant can be exported with the compiled model. The name used by
+     * different constants is ignored.
+     */
+    void registerConstant(const void* data, const std::string& name);
+
+    /**
+     * findOrCreate() for the weights repacked from the constant memory \p src into the \p dstDesc layout.
+     * The imported packed weights are used instead of the repacking when they are available for the registered
+     * constant, the weights repacked from the registered constants are collected for the export.
+     */
+    SharedMemory::Ptr findOrCreatePacked(const dnnl::engine& eng,
+                                         const MemoryCPtr& src,
+                                         const DnnlMemoryDescPtr& dstDesc,
+                                         const std::function<MemoryPtr(void)>& create);
+
+    void setImportedPackedWeights(PackedWeights::CPtr packedWeights);
+
+    /**
+     * Adds the weights repacked from the registered constants, which are still in use, to \p packedWeights
+     */
+    void collectPackedWeights(PackedWeights& packedWeights) const;
+
     Statistics dumpStatistics() const;
-#endif  // CPU_DEBUG_CAPS
 
 protected:
+    MemoryPtr importPacked(const dnnl::engine& eng,
+                           const std::string& packedKey,
+                           const DnnlMemoryDescPtr& dstDesc) const;
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+
+    // guards the packed weights bookkeeping, which is accessed while the guard is locked by findOrCreate()
+    mutable std::mutex packedGuard;
+    std::unordered_map<const void*, std::string> constantNames;
+    std::unordered_map<std::string, const void*> constantsByName;
+    std::map<std::string, std::weak_ptr<IMemory>> packedMemories;
+    PackedWeights::CPtr importedPackedWeights;
 };
 
 /**
@@ -94,9 +128,14 @@ public:
     WeightsSharing::Ptr& operator[](int socket_id);
     const WeightsSharing::Ptr& operator[](int socket_id) const;
 
-#ifdef CPU_DEBUG_CAPS
     [[nodiscard]] std::vector<std::pair<int, WeightsSharing::Statistics>> dumpStatistics() const;
-#endif  // CPU_DEBUG_CAPS
+
+    void setImportedPackedWeights(const PackedWeights::CPtr& packedWeights);
+
+    /**
+     * Collects the repacked weights of all the sockets, the weights repacked on several sockets are taken once
+     */
+    [[nodiscard]] PackedWeights::Ptr collectPackedWeights() const;
 
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace {
+
+// the static branch has the statically planned intermediate memory, while the shape inference of the dynamic branch
+// fails for the incompatible input shapes in the middle of the inference
+std::shared_ptr<ov::Model> makeModel() {
+    auto staticParam = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 256});
+    auto matmul0 = std::make_shared<ov::op::v0::MatMul>(staticParam,
+                                                        ov::test::utils::make_constant(ov::element::f32, {256, 256}));
+    auto relu = std::make_shared<ov::op::v0::Relu>(matmul0);
+    auto matmul1 =
+        std::make_shared<ov::op::v0::MatMul>(relu, ov::test::utils::make_constant(ov::element::f32, {256, 256}));
+
+    auto dynamicParam = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 4});
+    auto add = std::make_shared<ov::op::v1::Add>(dynamicParam, ov::test::utils::make_constant(ov::element::f32, {3, 4}));
+
+    return std::make_shared<ov::Model>(ov::OutputVector{matmul1, add},
+                                       ov::ParameterVector{staticParam, dynamicParam},
+                                       "IntermediateMemoryArena");
+}
+
+TEST(IntermediateMemoryArenaTest, smoke_MemoryIsReturnedWhenInferenceThrows) {
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeModel(),
+                                            "CPU",
+                                            {ov::num_streams(1), ov::intel_cpu::cpu_intermediate_memory_arena(true)});
+    auto request = compiledModel.create_infer_request();
+    request.set_input_tensor(0, ov::test::utils::create_and_fill_tensor(ov::element::f32, {1, 256}));
+
+    request.set_input_tensor(1, ov::test::utils::create_and_fill_tensor(ov::element::f32, {3, 4}));
+    request.infer();
+    ASSERT_GT(compiledModel.get_property(ov::intel_cpu::cpu_memory_plan_actual_size), 0U);
+    const auto idleSize = compiledModel.get_property(ov::intel_cpu::cpu_memory_plan_current_size);
+
+    request.set_input_tensor(1, ov::test::utils::create_and_fill_tensor(ov::element::f32, {2, 4}));
+    ASSERT_THROW(request.infer(), ov::Exception);
+    // the idle stream doesn't keep the memory of the failed inference
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::cpu_memory_plan_current_size), idleSize);
+
+    // and the next inference takes it from the arena again
+    request.set_input_tensor(1, ov::test::utils::create_and_fill_tensor(ov::element::f32, {3, 4}));
+    ASSERT_NO_THROW(request.infer());
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::cpu_memory_plan_current_size), idleSize);
+}
+
+}  // namespace
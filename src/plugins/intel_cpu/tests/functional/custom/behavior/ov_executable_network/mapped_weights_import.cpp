@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/node_builders/constant.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace {
+
+std::shared_ptr<ov::Model> makeModel() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{4, 256});
+    auto matmul =
+        std::make_shared<ov::op::v0::MatMul>(param, ov::test::utils::make_constant(ov::element::f32, {256, 256}));
+    return std::make_shared<ov::Model>(ov::OutputVector{matmul}, ov::ParameterVector{param}, "MappedWeightsImport");
+}
+
+TEST(MappedWeightsImportTest, smoke_RepackedWeightsAreMappedFromCache) {
+    const std::string cacheDir = "./test_cache_" + ov::test::utils::generateTestFilePrefix();
+    ov::Core core;
+    core.set_property(ov::cache_dir(cacheDir));
+    core.set_property(ov::enable_mmap(true));
+    // the weights are neither cloned for the other NUMA nodes nor converted to bf16
+    const ov::AnyMap config = {ov::num_streams(1), ov::hint::inference_precision(ov::element::f32)};
+
+    const auto compiled = core.compile_model(makeModel(), "CPU", config);
+    ASSERT_FALSE(compiled.get_property(ov::loaded_from_cache));
+    const auto sharedBytes = compiled.get_property(ov::intel_cpu::cpu_weights_shared_bytes);
+    const auto copiedBytes = compiled.get_property(ov::intel_cpu::cpu_weights_copied_bytes);
+
+    // the weights repacked by the compilation are stored in the blob and used in place of the mapped cache file
+    const auto imported = core.compile_model(makeModel(), "CPU", config);
+    ASSERT_TRUE(imported.get_property(ov::loaded_from_cache));
+    EXPECT_EQ(imported.get_property(ov::intel_cpu::cpu_weights_copied_bytes), 0U);
+    EXPECT_EQ(imported.get_property(ov::intel_cpu::cpu_weights_shared_bytes), sharedBytes + copiedBytes);
+
+    ov::test::utils::removeFilesWithExt<ov::test::opt::FORCE>(cacheDir, "blob");
+    ov::test::utils::removeDir(cacheDir);
+}
+
+}  // namespace
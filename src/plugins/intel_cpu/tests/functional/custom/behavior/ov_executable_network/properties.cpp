@@ -43,6 +43,7 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::hint::scheduling_core_type.name()),
         RO_property(ov::hint::model_distribution_policy.name()),
         RO_property(ov::hint::enable_hyper_threading.name()),
+        RO_property(ov::hint::model_priority.name()),
         RO_property(ov::execution_devices.name()),
         RO_property(ov::intel_cpu::denormals_optimization.name()),
         RO_property(ov::log::level.name()),
@@ -54,7 +55,12 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::key_cache_precision.name()),
         RO_property(ov::value_cache_precision.name()),
         RO_property(ov::key_cache_group_size.name()),
-        RO_property(ov::value_cache_group_size.name())
+        RO_property(ov::value_cache_group_size.name()),
+        RO_property(ov::intel_cpu::cpu_memory_plan_actual_size.name()),
+        RO_property(ov::intel_cpu::cpu_memory_plan_optimal_size.name()),
+        RO_property(ov::intel_cpu::cpu_memory_plan_current_size.name()),
+        RO_property(ov::intel_cpu::cpu_weights_shared_bytes.name()),
+        RO_property(ov::intel_cpu::cpu_weights_copied_bytes.name())
     };
 
     ov::Core ie;
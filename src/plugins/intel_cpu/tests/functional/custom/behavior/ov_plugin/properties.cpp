@@ -5,6 +5,7 @@
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
+#include "internal_properties.hpp"
 #include "utils/precision_support.h"
 #include "utils/properties_test.hpp"
 #include "common_test_utils/test_assertions.hpp"
@@ -41,6 +42,9 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RO_property(ov::device::capabilities.name()),
         RO_property(ov::device::type.name()),
         RO_property(ov::device::architecture.name()),
+        RO_property(ov::intel_cpu::cpu_queueing_delay_high.name()),
+        RO_property(ov::intel_cpu::cpu_queueing_delay_medium.name()),
+        RO_property(ov::intel_cpu::cpu_queueing_delay_low.name()),
         // Write only
         WO_property(ov::weights_path.name()),
         // read write
@@ -56,6 +60,7 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RW_property(ov::hint::scheduling_core_type.name()),
         RW_property(ov::hint::model_distribution_policy.name()),
         RW_property(ov::hint::enable_hyper_threading.name()),
+        RW_property(ov::hint::model_priority.name()),
         RW_property(ov::device::id.name()),
         RW_property(ov::intel_cpu::denormals_optimization.name()),
         RW_property(ov::log::level.name()),
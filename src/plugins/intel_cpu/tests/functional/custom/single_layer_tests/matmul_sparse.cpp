@@ -162,7 +162,7 @@ protected:
         configuration.insert(additionalConfig.begin(), additionalConfig.end());
 
         cpuNodeType = "FullyConnected";
-        selectedType = makeSelectedTypeStr(selectedType, element::i8);
+        selectedType = makeSelectedTypeStr(selectedType, inType == ElementType::f32 ? element::f32 : element::i8);
 
         ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(inType, inShapeA)};
 
@@ -180,11 +180,25 @@ protected:
         convert_precisions.insert({ov::element::i8, ov::element::f32});
         convert_precisions.insert({ov::element::u8, ov::element::f32});
     }
+
+    // the sparse weights are used only by the sparse implementations
+    void checkSparseWeights() const {
+        const bool sparseExpected = selectedType.find("sparse") != std::string::npos;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() != cpuNodeType) {
+                continue;
+            }
+            const auto primType = rtInfo.at(ov::exec_model_info::IMPL_TYPE).as<std::string>();
+            ASSERT_EQ(primType.find("sparse") != std::string::npos, sparseExpected) << "primType: " << primType;
+        }
+    }
 };
 
 TEST_P(MatMulSparseCPUTest, CompareWithRefs) {
     run();
     CheckPluginRelatedResults(compiledModel, cpuNodeType);
+    checkSparseWeights();
 }
 
 namespace {
@@ -204,6 +218,20 @@ std::vector<CPUSpecificParams> filterSpecificParams(bool sparseExpected) {
     return specificParams;
 }
 
+// the f32 sparse weights are only kept for the jit sparse executor, the other implementations get the dense ones
+std::vector<CPUSpecificParams> filterFloatSpecificParams(bool sparseExpected) {
+    std::vector<CPUSpecificParams> specificParams;
+    if (!sparseExpected) {
+        specificParams.push_back(CPUSpecificParams{{}, {}, {}, CPUTestsBase::any_type});
+    } else if (with_cpu_x86_avx512_core()) {
+        specificParams.push_back(CPUSpecificParams{{}, {}, {}, "jit_avx512_sparse"});
+    } else if (with_cpu_x86_avx2()) {
+        specificParams.push_back(CPUSpecificParams{{}, {}, {}, "jit_avx2_sparse"});
+    }
+
+    return specificParams;
+}
+
 /* ============= FullyConnected ============= */
 namespace fullyConnected {
 
@@ -260,6 +288,31 @@ const auto testParams2D_i8_sparse_smoke = ::testing::Combine(::testing::ValuesIn
 INSTANTIATE_TEST_SUITE_P(smoke_FC_2D_I8_sparse, MatMulSparseCPUTest, testParams2D_i8_sparse_smoke,
     MatMulSparseCPUTest::getTestCaseName);
 
+const auto testParams2D_f32_sparse_smoke = ::testing::Combine(::testing::ValuesIn(IS2D_sparse_smoke),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(emptyFusingSpec),
+                                                   ::testing::ValuesIn(filterFloatSpecificParams(true)),
+                                                   ::testing::Values(SparseRate50),
+                                                   ::testing::Values(0.7));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FC_2D_FP32_sparse, MatMulSparseCPUTest, testParams2D_f32_sparse_smoke,
+    MatMulSparseCPUTest::getTestCaseName);
+
+// the sparse executor doesn't support the post ops, so the weights stay dense
+const auto testParams2D_f32_dense_smoke = ::testing::Combine(::testing::ValuesIn(IS2D_sparse_smoke),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(fusingRelu),
+                                                   ::testing::ValuesIn(filterFloatSpecificParams(false)),
+                                                   ::testing::Values(SparseRate50),
+                                                   ::testing::Values(0.7));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FC_2D_FP32_dense, MatMulSparseCPUTest, testParams2D_f32_dense_smoke,
+    MatMulSparseCPUTest::getTestCaseName);
+
 const std::vector<ShapeRelatedParams> IS3D_sparse_smoke = {
     {static_shapes_to_test_representation({{1, 64, 64}, {64, 64}}), {false, true}},
     {static_shapes_to_test_representation({{3, 71, 64}, {64, 64}}), {false, true}},
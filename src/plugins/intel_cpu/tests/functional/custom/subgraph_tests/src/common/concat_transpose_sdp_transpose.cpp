@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+
+#include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/include/common_test_utils/ov_tensor_utils.hpp"
 #include "internal_properties.hpp"
 #include "openvino/core/type/float16.hpp"
@@ -519,6 +522,217 @@ INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeTestSetState,
                                             ::testing::Values(0)),
                          ConcatSDPTransposeTest::getTestCaseName);
 
+class ConcatSDPTransposeTestForkState : public ConcatSDPTransposeTestSetState {
+public:
+    // forks the states to the other request dropping the last token, the source states must stay intact
+    void fork_state(ov::InferRequest& source, ov::InferRequest& target, bool use_truncate) {
+        auto source_states = source.query_state();
+        auto target_states = target.query_state();
+        // the state of another variable (i.e. V for K) is rejected
+        for (auto&& state : source_states) {
+            if (!target_states.empty() && state.get_name() != target_states[0].get_name()) {
+                ASSERT_THROW(target_states[0].fork_from(state), ov::Exception);
+                break;
+            }
+        }
+        for (auto&& state : target_states) {
+            auto itr = std::find_if(source_states.begin(), source_states.end(), [&](const ov::VariableState& s) {
+                return s.get_name() == state.get_name();
+            });
+            OPENVINO_ASSERT(itr != source_states.end(), "Failed to find ", state.get_name(), " state");
+            state.fork_from(*itr);
+            auto length = state.get_state().get_shape()[transposeOrder[2]];
+            ASSERT_GE(length, 1);
+            if (use_truncate) {
+                state.truncate(length - 1);
+            } else {
+                auto state_tensor = state.get_state();
+                ov::Tensor copy{state_tensor.get_element_type(), state_tensor.get_shape()};
+                state_tensor.copy_to(copy);
+                auto new_shape = state_tensor.get_shape();
+                new_shape[transposeOrder[2]] -= 1;
+                state.set_state(ov::Tensor{state_tensor.get_element_type(), new_shape, copy.data()});
+            }
+        }
+    }
+    std::vector<ov::Tensor> run_test(std::shared_ptr<ov::Model> model, bool use_truncate) {
+        function = model;
+        auto input_type = model->get_parameters()[0]->get_element_type();
+        if (input_type == ov::element::f32) {
+            configuration[ov::hint::kv_cache_precision.name()] = "f32";
+        } else if (input_type == ov::element::bf16) {
+            configuration[ov::hint::kv_cache_precision.name()] = "bf16";
+        } else {
+            configuration[ov::hint::kv_cache_precision.name()] = "u8";
+        }
+        prepare();
+        auto forkedRequest = compiledModel.create_infer_request();
+        std::vector<ov::Tensor> outputs;
+        int idx = 0;
+        for (auto&& shapes : targetStaticShapes) {
+            generate(idx++, shapes);
+            for (const auto& input : inputs) {
+                inferRequest.set_tensor(input.first, input.second);
+            }
+            inferRequest.infer();
+            auto outputTensor = inferRequest.get_output_tensor(0);
+            ov::Tensor copy{outputTensor.get_element_type(), outputTensor.get_shape()};
+            outputTensor.copy_to(copy);
+            outputs.push_back(copy);
+            if (idx > 1) {
+                fork_state(inferRequest, forkedRequest, use_truncate);
+                std::swap(inferRequest, forkedRequest);
+            }
+        }
+        // the last source of the fork, the inferences of the forked request must not change it
+        auto states = forkedRequest.query_state();
+        std::sort(states.begin(), states.end(), [](VariableState& a, VariableState& b) {
+            return a.get_name() > b.get_name();
+        });
+        for (auto&& state : states) {
+            auto state_tensor = state.get_state();
+            ov::Tensor copy{state_tensor.get_element_type(), state_tensor.get_shape()};
+            state_tensor.copy_to(copy);
+            outputs.push_back(copy);
+        }
+
+        return outputs;
+    }
+};
+
+TEST_P(ConcatSDPTransposeTestForkState, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    const auto& [inType, inputShapeAndOrders, hasShapeOf, quantKeyByChannel, groupSize] = this->GetParam();
+    // skip bf16 test on avx512 platform
+    if (inType == ElementType::bf16 && !ov::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+
+    auto actualOutputs = run_test(function, true);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+    // the reference states are plain buffers, so they are truncated via set_state
+    auto expectedOutputs = run_test(functionRefs, false);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 0);
+    for (size_t i = 0; i < actualOutputs.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], abs_threshold, rel_threshold);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeTestForkState,
+                         ConcatSDPTransposeTestForkState,
+                         ::testing::Combine(::testing::Values(ElementType::f32, ElementType::bf16, ElementType::f16),
+                                            ::testing::ValuesIn(inputShapeAndReordersSetState),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false),
+                                            ::testing::Values(0)),
+                         ConcatSDPTransposeTest::getTestCaseName);
+
+class ConcatSDPTransposeTestOffloadState : public ConcatSDPTransposeTestSetState {
+public:
+    void prepare_kv_cache() {
+        auto input_type = function->get_parameters()[0]->get_element_type();
+        // f16 checks the u8 kv cache with its quantization params, f32 checks the not quantized one
+        configuration[ov::hint::kv_cache_precision.name()] = input_type == ov::element::f32 ? "f32" : "u8";
+        prepare();
+    }
+
+    std::vector<ov::Tensor> run_test(std::shared_ptr<ov::Model> model) {
+        function = model;
+        prepare_kv_cache();
+        std::vector<ov::Tensor> outputs;
+        int idx = 0;
+        for (auto&& shapes : targetStaticShapes) {
+            generate(idx++, shapes);
+            for (const auto& input : inputs) {
+                inferRequest.set_tensor(input.first, input.second);
+            }
+            inferRequest.infer();
+            auto outputTensor = inferRequest.get_output_tensor(0);
+            ov::Tensor copy{outputTensor.get_element_type(), outputTensor.get_shape()};
+            outputTensor.copy_to(copy);
+            outputs.push_back(copy);
+            // the odd steps are restored lazily by the inference, the even ones are prefetched
+            for (auto&& state : inferRequest.query_state()) {
+                state.offload();
+                if (idx % 2 == 0) {
+                    state.prefetch();
+                }
+            }
+        }
+        auto states = inferRequest.query_state();
+        // k, v may be in any order
+        std::sort(states.begin(), states.end(), [](VariableState& a, VariableState& b) {
+            return a.get_name() > b.get_name();
+        });
+        for (auto&& state : states) {
+            auto state_tensor = state.get_state();
+            ov::Tensor copy{state_tensor.get_element_type(), state_tensor.get_shape()};
+            state_tensor.copy_to(copy);
+            outputs.push_back(copy);
+        }
+
+        return outputs;
+    }
+
+    void check() {
+        auto actualOutputs = run_test(function);
+        CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+        auto expectedOutputs = run_test(functionRefs);
+        CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 0);
+        for (size_t i = 0; i < actualOutputs.size(); i++) {
+            ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], abs_threshold, rel_threshold);
+        }
+    }
+
+    // the state read after the offload and the prefetch is the same as the one before the offload
+    void check_restored_state() {
+        prepare_kv_cache();
+        int idx = 0;
+        for (auto&& shapes : targetStaticShapes) {
+            generate(idx++, shapes);
+            for (const auto& input : inputs) {
+                inferRequest.set_tensor(input.first, input.second);
+            }
+            inferRequest.infer();
+        }
+        for (auto&& state : inferRequest.query_state()) {
+            auto state_tensor = state.get_state();
+            ov::Tensor expected{state_tensor.get_element_type(), state_tensor.get_shape()};
+            state_tensor.copy_to(expected);
+            state.offload();
+            state.prefetch();
+            auto actual = state.get_state();
+            ASSERT_EQ(expected.get_element_type(), actual.get_element_type());
+            ASSERT_EQ(expected.get_shape(), actual.get_shape());
+            ASSERT_EQ(0, std::memcmp(expected.data(), actual.data(), expected.get_byte_size())) << state.get_name();
+        }
+    }
+};
+
+TEST_P(ConcatSDPTransposeTestOffloadState, RestoredStateIsBitExact) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    check_restored_state();
+}
+
+TEST_P(ConcatSDPTransposeTestOffloadState, HostMemory) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    check();
+}
+
+TEST_P(ConcatSDPTransposeTestOffloadState, LocalDisk) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    configuration[ov::intel_cpu::cpu_kv_cache_offload_dir.name()] = ov::test::utils::getCurrentWorkingDir();
+    check();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeTestOffloadState,
+                         ConcatSDPTransposeTestOffloadState,
+                         ::testing::Combine(::testing::Values(ElementType::f32, ElementType::f16),
+                                            ::testing::ValuesIn(inputShapeAndReordersSetState),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false),
+                                            ::testing::Values(0)),
+                         ConcatSDPTransposeTest::getTestCaseName);
+
 class ConcatSDPTransposeTestWrongBeamIdx : public ConcatSDPTransposeTest {
 public:
     void generate(int idx, const std::vector<ov::Shape>& targetInputStaticShapes) override {
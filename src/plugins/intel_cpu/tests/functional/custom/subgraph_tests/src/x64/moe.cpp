@@ -299,6 +299,12 @@ const std::vector<MoeTestShapeParams> moe_params_smoke = {
         4,                                                           // number_of_experts
         256                                                          // intermediate_size
     },
+    {
+        {{-1, -1, 128}, {{1, 64, 128}, {1, 1, 128}, {2, 40, 128}}},  // Many tokens spread over many experts
+        8,                                                           // topk
+        16,                                                          // number_of_experts
+        256                                                          // intermediate_size
+    },
 };
 
 std::vector<ov::AnyMap> generate_additional_config() {
@@ -309,8 +315,37 @@ std::vector<ov::AnyMap> generate_additional_config() {
     return additional_config;
 }
 
+// The experts of GatherMatmul are executed as a grouped GEMM (GEMV without AMX) when there are at least two blocks of
+// tokens per thread and at most 256 tokens per expert on average, so the thread count is fixed to get both the grouped
+// and the per-expert execution.
+const std::vector<MoeTestShapeParams> moe_params_grouped = {
+    {
+        {{-1, -1, 128}, {{1, 48, 128}, {1, 1, 128}, {1, 600, 128}}},  // grouped, single token, per-expert
+        4,                                                            // topk
+        8,                                                            // number_of_experts
+        256                                                           // intermediate_size
+    },
+};
+
+std::vector<ov::AnyMap> generate_grouped_config() {
+    std::vector<ov::AnyMap> grouped_config;
+    for (auto config : generate_additional_config()) {
+        config[ov::num_streams.name()] = 1;
+        config[ov::inference_num_threads.name()] = 4;
+        grouped_config.push_back(std::move(config));
+    }
+    return grouped_config;
+}
+
 }  // namespace
 
+INSTANTIATE_TEST_SUITE_P(smoke_MoESubgraph_grouped,
+                         MoESubgraphTest,
+                         ::testing::Combine(::testing::ValuesIn(moe_params_grouped),
+                                            ::testing::ValuesIn(moe_types),
+                                            ::testing::ValuesIn(generate_grouped_config())),
+                         MoESubgraphTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_MoESubgraph_basic,
                          MoESubgraphTest,
                          ::testing::Combine(::testing::ValuesIn(moe_params_smoke),
@@ -339,4 +374,19 @@ INSTANTIATE_TEST_SUITE_P(smoke_MoeCompressedWeights,
                                             ::testing::Values(true)),  // use_matmul_decompression_impl
                          MoECompressedWeightsSubgraphTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_MoeCompressedWeights_grouped,
+                         MoECompressedWeightsSubgraphTest,
+                         ::testing::Combine(::testing::ValuesIn(moe_params_grouped),
+                                            ::testing::ValuesIn(moe_types),
+                                            ::testing::Values(ov::element::u4, ov::element::i8),
+                                            ::testing::ValuesIn(decompression_precisions),
+                                            ::testing::Values(ov::element::f32),
+                                            ::testing::Values(ov::test::utils::DecompressionType::full),
+                                            ::testing::Values(ov::test::utils::DecompressionType::full),
+                                            ::testing::Values(false),  // reshape on decompression
+                                            ::testing::Values(16),     // decompression group size
+                                            ::testing::ValuesIn(generate_grouped_config()),
+                                            ::testing::Values(true)),  // use_matmul_decompression_impl
+                         MoECompressedWeightsSubgraphTest::getTestCaseName);
+
 }  // namespace ov::test
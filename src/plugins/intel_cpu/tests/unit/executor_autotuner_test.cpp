@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+
+#include "cpu_memory.h"
+#include "cpu_shape.h"
+#include "cpu_types.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/executors/executor_autotuner.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "post_ops.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icore.hpp"
+#include "utils/codec_xor.hpp"
+#include "utils/graph_serializer/deserializer.hpp"
+#include "utils/graph_serializer/serializer.hpp"
+
+using namespace ov::intel_cpu;
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace {
+
+MemoryPtr makeMemory(const dnnl::engine& eng, const VectorDims& dims) {
+    return std::make_shared<Memory>(eng, std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape(dims)));
+}
+
+TEST(ExecutorAutotunerTest, CloseShapesShareKey) {
+    dnnl::engine eng{dnnl::engine::kind::cpu, 0};
+    const MemoryArgs memory{{ARG_SRC, makeMemory(eng, {1, 100, 64})}, {ARG_DST, makeMemory(eng, {1, 100, 32})}};
+    const MemoryArgs close{{ARG_DST, makeMemory(eng, {1, 120, 32})}, {ARG_SRC, makeMemory(eng, {1, 120, 64})}};
+    const MemoryArgs far{{ARG_SRC, makeMemory(eng, {1, 200, 64})}, {ARG_DST, makeMemory(eng, {1, 200, 32})}};
+
+    const auto key = ExecutorAutotuner::makeKey("fc", 0, memory);
+    ASSERT_EQ(key, ExecutorAutotuner::makeKey("fc", 0, close));
+    ASSERT_NE(key, ExecutorAutotuner::makeKey("fc", 0, far));
+    ASSERT_NE(key, ExecutorAutotuner::makeKey("matmul", 0, memory));
+}
+
+TEST(ExecutorAutotunerTest, AttrsAreKeyed) {
+    dnnl::engine eng{dnnl::engine::kind::cpu, 0};
+    const MemoryArgs memory{{ARG_SRC, makeMemory(eng, {1, 100, 64})}, {ARG_DST, makeMemory(eng, {1, 100, 32})}};
+    const auto keyOf = [&](const FCAttrs& attrs) {
+        return ExecutorAutotuner::makeKey("fc", ExecutorAutotuner::hashAttrs(attrs), memory);
+    };
+
+    FCAttrs plain;
+    FCAttrs relu;
+    relu.postOps.emplace_back(ActivationPostOp(ActivationPostOp::Type::relu, 0.0F, 0.0F, 0.0F));
+    FCAttrs scaled;
+    scaled.postOps.emplace_back(ScaleShiftPostOp(ScaleShiftPostOp::Type::multiply, {0.5F}, {}));
+    FCAttrs scaledOther;
+    scaledOther.postOps.emplace_back(ScaleShiftPostOp(ScaleShiftPostOp::Type::multiply, {2.0F}, {}));
+    FCAttrs nonTransposed;
+    nonTransposed.weightsNonTransposed = true;
+
+    ASSERT_NE(keyOf(plain), keyOf(relu));
+    ASSERT_NE(keyOf(plain), keyOf(scaled));
+    ASSERT_NE(keyOf(relu), keyOf(scaled));
+    ASSERT_NE(keyOf(plain), keyOf(nonTransposed));
+    // the layers differing only in the values of the scales share the decision
+    ASSERT_EQ(keyOf(scaled), keyOf(scaledOther));
+}
+
+TEST(ExecutorAutotunerTest, FirstDecisionIsKept) {
+    ExecutorAutotuner autotuner(true);
+    ASSERT_FALSE(autotuner.find("key").has_value());
+
+    ASSERT_EQ(autotuner.record("key", "brgemm"), "brgemm");
+    // another stream finished the tuning later
+    ASSERT_EQ(autotuner.record("key", "dnnl"), "brgemm");
+    ASSERT_EQ(autotuner.find("key").value(), "brgemm");
+}
+
+TEST(ExecutorAutotunerTest, ImportedDecisionsAreApplied) {
+    ExecutorAutotuner autotuner(false, {{"key", "dnnl"}});
+    ASSERT_FALSE(autotuner.tune());
+    ASSERT_EQ(autotuner.find("key").value(), "dnnl");
+    ASSERT_EQ(autotuner.decisions().size(), 1U);
+}
+
+TEST(ExecutorAutotunerTest, DecisionsRoundTripThroughBlob) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 16});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{std::make_shared<ov::op::v0::Result>(relu)},
+                                             ov::ParameterVector{param});
+    auto core = std::make_shared<NiceMock<ov::MockICore>>();
+    ON_CALL(*core, read_model(::testing::An<const std::shared_ptr<ov::AlignedBuffer>&>(), _))
+        .WillByDefault(Return(model));
+
+    const ExecutorAutotuner::Decisions decisions = {{"brgemm_fc,dnnl_fc;1f;0:f32_1_128", "dnnl_fc"},
+                                                    {"brgemm_fc,dnnl_fc;1f;0:f32_1_256", "brgemm_fc"}};
+    std::stringstream stream;
+    ModelSerializer serializer(stream, {}, false, nullptr, decisions);
+    serializer << model;
+
+    ModelDeserializer deserializer(stream, core, CacheDecrypt{}, false);
+    std::shared_ptr<ov::Model> imported;
+    deserializer >> imported;
+    ASSERT_EQ(deserializer.get_executor_decisions(), decisions);
+
+    // the imported decisions are applied without the tuning
+    ExecutorAutotuner autotuner(false, deserializer.get_executor_decisions());
+    ASSERT_EQ(autotuner.find("brgemm_fc,dnnl_fc;1f;0:f32_1_256").value(), "brgemm_fc");
+}
+
+}  // namespace
@@ -0,0 +1,190 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "dummy_node.hpp"
+#include "execution_dag.hpp"
+#include "graph.h"
+#include "nodes/input.h"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+using namespace ov::intel_cpu;
+using namespace ov::op;
+
+class ExecutionDagCPUTest : public ::testing::Test {
+    /*This test runs the following subgraph:
+
+                          param
+                            |
+                         Softmax
+                         /     \
+                       Add     Mul
+                        |       |
+                     Result0  Result1
+
+    Add and Mul only read the output of Softmax, so they are expected to be independent.
+    */
+protected:
+    void SetUp() override {
+        Config conf;
+        conf.rtCacheCapacity = 100;
+        conf.enableInterOpParallelism = true;
+        const auto context = std::make_shared<const GraphContext>(conf, nullptr, false);
+
+        const ov::PartialShape shape{2, 3, 4};
+        auto param = std::make_shared<v0::Parameter>(testPrec, shape);
+        auto inputNode = std::make_shared<node::Input>(param, context);
+
+        auto makeDummy = [&](const std::string& name) {
+            return std::make_shared<cpu_unit_test::DummyNode>(shape,
+                                                              testPrec,
+                                                              name,
+                                                              "DummyNode" /*type*/,
+                                                              context,
+                                                              LayoutType::ncsp,
+                                                              0 /*look*/,
+                                                              true /*is_executable*/);
+        };
+        softmax = makeDummy("softmax");
+        add = makeDummy("add");
+        mul = makeDummy("mul");
+
+        auto result0 = std::make_shared<node::Input>(add->getOutputShapeAtPort(0), testPrec, "_result0", "Result", context);
+        auto result1 = std::make_shared<node::Input>(mul->getOutputShapeAtPort(0), testPrec, "_result1", "Result", context);
+
+        addEdge(inputNode, softmax);
+        addEdge(softmax, add);
+        addEdge(softmax, mul);
+        addEdge(add, result0);
+        addEdge(mul, result1);
+
+        std::vector<NodePtr> nodes{inputNode, softmax, add, mul, result0, result1};
+        graph = std::make_shared<Graph>();
+        graph->CreateGraph(nodes, edges, context, "execution_dag_testgraph");
+
+        for (const auto& node : graph->GetNodes()) {
+            if (node->isExecutable()) {
+                executableNodes.push_back(node);
+            }
+        }
+    }
+
+    void addEdge(const NodePtr& parent, const NodePtr& child) {
+        auto edge = std::make_shared<Edge>(parent, child, 0, 0);
+        Node::addEdge(edge);
+        edges.push_back(edge);
+    }
+
+    size_t indexOf(const NodePtr& node) const {
+        return std::distance(executableNodes.begin(), std::find(executableNodes.begin(), executableNodes.end(), node));
+    }
+
+    const ov::element::Type_t testPrec = ov::element::Type_t::f32;
+    const dnnl::engine engine{dnnl::engine::kind::cpu, 0};
+    const ExecutionDag::StreamFactory makeStream = [this] {
+        return dnnl::stream(engine);
+    };
+    std::vector<EdgePtr> edges;
+    std::shared_ptr<Graph> graph;
+    std::vector<NodePtr> executableNodes;
+    NodePtr softmax, add, mul;
+};
+
+TEST_F(ExecutionDagCPUTest, smoke_independent_branches) {
+    ASSERT_EQ(executableNodes.size(), 3);
+    ExecutionDag dag(executableNodes, {});
+
+    ASSERT_EQ(dag.size(), 3);
+    ASSERT_EQ(dag.width(), 2);
+    ASSERT_EQ(dag.dependenciesCount(indexOf(softmax)), 0);
+    ASSERT_EQ(dag.dependenciesCount(indexOf(add)), 1);
+    ASSERT_EQ(dag.dependenciesCount(indexOf(mul)), 1);
+    ASSERT_EQ(dag.successors(indexOf(softmax)).size(), 2);
+}
+
+TEST_F(ExecutionDagCPUTest, smoke_scratch_pad_users_are_serialized) {
+    ExecutionDag dag(executableNodes, {add.get(), mul.get()});
+
+    ASSERT_EQ(dag.width(), 1);
+    ASSERT_EQ(dag.dependenciesCount(std::max(indexOf(add), indexOf(mul))), 2);
+}
+
+TEST_F(ExecutionDagCPUTest, smoke_cache_record_users_are_serialized) {
+    // add and mul may get the same executor object from the runtime cache
+    ExecutionDag dag(executableNodes, {}, {{add.get(), {7, 42}}, {mul.get(), {42}}, {softmax.get(), {1}}});
+
+    ASSERT_EQ(dag.width(), 1);
+    ASSERT_EQ(dag.dependenciesCount(std::max(indexOf(add), indexOf(mul))), 2);
+}
+
+TEST_F(ExecutionDagCPUTest, smoke_different_cache_records_keep_branches_independent) {
+    ExecutionDag dag(executableNodes, {}, {{add.get(), {7, 7}}, {mul.get(), {42}}});
+
+    ASSERT_EQ(dag.width(), 2);
+    ASSERT_EQ(dag.dependenciesCount(indexOf(add)), 1);
+    ASSERT_EQ(dag.dependenciesCount(indexOf(mul)), 1);
+}
+
+TEST_F(ExecutionDagCPUTest, smoke_run_respects_dependencies) {
+    ExecutionDag dag(executableNodes, {});
+
+    std::mutex mutex;
+    std::vector<size_t> order;
+    dag.run(
+        [&](size_t idx, const dnnl::stream&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(idx);
+        },
+        makeStream);
+
+    ASSERT_EQ(order.size(), 3);
+    ASSERT_EQ(order.front(), indexOf(softmax));
+}
+
+TEST_F(ExecutionDagCPUTest, smoke_run_rethrows_exception) {
+    ExecutionDag dag(executableNodes, {});
+
+    std::atomic<size_t> executed{0};
+    ASSERT_THROW(dag.run(
+                     [&](size_t idx, const dnnl::stream&) {
+                         executed++;
+                         if (idx == indexOf(softmax)) {
+                             OPENVINO_THROW("expected failure");
+                         }
+                     },
+                     makeStream),
+                 ov::Exception);
+    // the successors of the failed node are skipped
+    ASSERT_EQ(executed.load(), 1);
+}
+
+TEST_F(ExecutionDagCPUTest, smoke_concurrent_nodes_do_not_share_stream) {
+    ExecutionDag dag(executableNodes, {});
+
+    std::mutex mutex;
+    std::set<dnnl_stream_t> streamsInUse;
+    std::atomic<bool> shared{false};
+    for (size_t i = 0; i < 10; i++) {
+        dag.run(
+            [&](size_t, const dnnl::stream& stream) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    shared = shared || !streamsInUse.insert(stream.get()).second;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                std::lock_guard<std::mutex> lock(mutex);
+                streamsInUse.erase(stream.get());
+            },
+            makeStream);
+    }
+    ASSERT_FALSE(shared.load());
+}
@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "host_scheduler.hpp"
+#include "openvino/runtime/properties.hpp"
+
+using namespace ov::intel_cpu;
+using Priority = ov::hint::Priority;
+
+namespace {
+
+constexpr auto waitTime = std::chrono::milliseconds(50);
+
+std::unique_ptr<HostScheduler::Ticket> admit(HostScheduler& scheduler, Priority priority, int threads) {
+    return std::make_unique<HostScheduler::Ticket>(scheduler,
+                                                   priority,
+                                                   0.5F,
+                                                   threads,
+                                                   HostScheduler::Clock::now());
+}
+
+TEST(HostSchedulerTest, SinglePriorityIsNotLimited) {
+    HostScheduler scheduler(4);
+    HostScheduler::Registration medium(scheduler, Priority::MEDIUM);
+    HostScheduler::Registration otherMedium(scheduler, Priority::MEDIUM);
+    auto first = admit(scheduler, Priority::MEDIUM, 4);
+    auto second = admit(scheduler, Priority::MEDIUM, 4);
+    second->yield();
+
+    ASSERT_FALSE(first->active());
+    ASSERT_FALSE(second->active());
+    ASSERT_EQ(scheduler.getStatistics(Priority::MEDIUM).inferences, 2U);
+}
+
+TEST(HostSchedulerTest, TicketsAreActiveWhileSeveralPrioritiesAreRegistered) {
+    HostScheduler scheduler(8);
+    HostScheduler::Registration low(scheduler, Priority::LOW);
+    {
+        HostScheduler::Registration high(scheduler, Priority::HIGH);
+        ASSERT_TRUE(admit(scheduler, Priority::LOW, 4)->active());
+    }
+    // the high priority model is released
+    ASSERT_FALSE(admit(scheduler, Priority::LOW, 4)->active());
+    ASSERT_EQ(scheduler.getStatistics(Priority::LOW).inferences, 2U);
+}
+
+TEST(HostSchedulerTest, LowPriorityTakesThreadsLeftByHighPriority) {
+    HostScheduler scheduler(8);
+    HostScheduler::Registration highModel(scheduler, Priority::HIGH);
+    HostScheduler::Registration lowModel(scheduler, Priority::LOW);
+    auto high = admit(scheduler, Priority::HIGH, 4);
+    // the half of the threads is reserved for the high priority
+    auto low = admit(scheduler, Priority::LOW, 4);
+
+    std::atomic<bool> admitted{false};
+    std::thread waiting([&] {
+        auto ticket = admit(scheduler, Priority::LOW, 4);
+        admitted = true;
+    });
+    std::this_thread::sleep_for(waitTime);
+    ASSERT_FALSE(admitted);
+
+    high.reset();
+    waiting.join();
+    ASSERT_TRUE(admitted);
+}
+
+TEST(HostSchedulerTest, LowPriorityIsPreemptedByHighPriority) {
+    HostScheduler scheduler(8);
+    HostScheduler::Registration highModel(scheduler, Priority::HIGH);
+    HostScheduler::Registration lowModel(scheduler, Priority::LOW);
+    auto low = admit(scheduler, Priority::LOW, 8);
+    // the high priority inference doesn't wait, the low priority one yields its threads at the next preemption point
+    auto high = admit(scheduler, Priority::HIGH, 4);
+
+    std::atomic<bool> resumed{false};
+    std::thread preempted([&] {
+        low->yield();
+        resumed = true;
+    });
+    std::this_thread::sleep_for(waitTime);
+    ASSERT_FALSE(resumed);
+
+    high.reset();
+    preempted.join();
+    ASSERT_TRUE(resumed);
+}
+
+TEST(HostSchedulerTest, HighPriorityIsNotPreempted) {
+    HostScheduler scheduler(8);
+    HostScheduler::Registration highModel(scheduler, Priority::HIGH);
+    HostScheduler::Registration mediumModel(scheduler, Priority::MEDIUM);
+    auto high = admit(scheduler, Priority::HIGH, 8);
+    auto medium = admit(scheduler, Priority::MEDIUM, 0);
+    auto otherHigh = admit(scheduler, Priority::HIGH, 8);
+    high->yield();
+
+    ASSERT_EQ(scheduler.getStatistics(Priority::HIGH).inferences, 2U);
+    ASSERT_EQ(scheduler.getStatistics(Priority::LOW).inferences, 0U);
+}
+
+}  // namespace
@@ -0,0 +1,159 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "common_test_utils/common_utils.hpp"
+#include "config.h"
+#include "kernel_warmup_cache.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+
+using namespace ov::intel_cpu;
+
+class KernelWarmupCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_cacheDir = ov::test::utils::generateTestFilePrefix() + "_kernel_cache";
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_cacheDir);
+    }
+
+    static std::shared_ptr<ov::Model> makeModel(const ov::PartialShape& shape) {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+        auto result = std::make_shared<ov::op::v0::Result>(relu);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+    }
+
+    std::string m_cacheDir;
+};
+
+TEST_F(KernelWarmupCacheTest, StaticModelIsNotCached) {
+    ASSERT_EQ(KernelWarmupCache::create(m_cacheDir, makeModel({1, 3, 8, 8}), Config{}), nullptr);
+    ASSERT_EQ(KernelWarmupCache::create("", makeModel({-1, 3, 8, 8}), Config{}), nullptr);
+}
+
+TEST_F(KernelWarmupCacheTest, ShapesArePersisted) {
+    const auto model = makeModel({-1, 3, -1, -1});
+    const KernelWarmupCache::InputShapes shapes0{{1, 3, 8, 8}};
+    const KernelWarmupCache::InputShapes shapes1{{2, 3, 16, 16}};
+    const KernelWarmupCache::InputShapes oneOffShapes{{4, 3, 32, 32}};
+    {
+        auto cache = KernelWarmupCache::create(m_cacheDir, model, Config{});
+        ASSERT_NE(cache, nullptr);
+        ASSERT_TRUE(cache->getRecords().empty());
+        // the shapes are recorded on the second occurrence
+        ASSERT_FALSE(cache->registerInference(shapes0));
+        ASSERT_FALSE(cache->registerInference(shapes0));
+        ASSERT_TRUE(cache->registerInference(shapes0));
+        ASSERT_FALSE(cache->registerInference(shapes1));
+        ASSERT_FALSE(cache->registerInference(oneOffShapes));
+        ASSERT_FALSE(cache->registerInference(shapes1));
+
+        const auto stats = cache->getStatistics();
+        ASSERT_EQ(stats.hits, 1U);
+        ASSERT_EQ(stats.misses, 5U);
+    }
+
+    auto cache = KernelWarmupCache::create(m_cacheDir, model, Config{});
+    ASSERT_NE(cache, nullptr);
+    const auto records = cache->getRecords();
+    ASSERT_EQ(records.size(), 2U);
+    ASSERT_EQ(records[0], shapes0);
+    ASSERT_EQ(records[1], shapes1);
+
+    cache->completeWarmUp(records.size());
+    ASSERT_TRUE(cache->registerInference(shapes1));
+    const auto stats = cache->getStatistics();
+    ASSERT_EQ(stats.hits, 1U);
+    ASSERT_EQ(stats.misses, 0U);
+    ASSERT_EQ(stats.warmedShapes, 2U);
+}
+
+TEST_F(KernelWarmupCacheTest, DifferentModelsDoNotShareProfile) {
+    auto cache0 = KernelWarmupCache::create(m_cacheDir, makeModel({-1, 3}), Config{});
+    auto cache1 = KernelWarmupCache::create(m_cacheDir, makeModel({-1, 4}), Config{});
+    ASSERT_NE(cache0->getFilePath(), cache1->getFilePath());
+}
+
+TEST_F(KernelWarmupCacheTest, ScalarShapes) {
+    std::filesystem::create_directories(m_cacheDir);
+    const auto path = std::filesystem::path(m_cacheDir) / "profile.txt";
+    const KernelWarmupCache::InputShapes shapes{{}, {4, 5}, {}};
+    {
+        KernelWarmupCache cache(path);
+        cache.registerInference(shapes);
+        cache.registerInference(shapes);
+    }
+    KernelWarmupCache cache(path);
+    ASSERT_EQ(cache.getRecords(), std::vector<KernelWarmupCache::InputShapes>{shapes});
+}
+
+TEST_F(KernelWarmupCacheTest, ProfileIsStoredOnFlush) {
+    std::filesystem::create_directories(m_cacheDir);
+    const auto path = std::filesystem::path(m_cacheDir) / "profile.txt";
+    KernelWarmupCache cache(path);
+    // the inferences don't write the file
+    for (size_t i = 0; i < KernelWarmupCache::min_occurrences; i++) {
+        cache.registerInference({{1, 2}});
+        cache.registerInference({{3, 4}});
+    }
+    ASSERT_FALSE(std::filesystem::exists(path));
+
+    cache.flush();
+    ASSERT_EQ(KernelWarmupCache(path).getRecords().size(), 2U);
+}
+
+TEST_F(KernelWarmupCacheTest, RecordsAreCapped) {
+    std::filesystem::create_directories(m_cacheDir);
+    const auto path = std::filesystem::path(m_cacheDir) / "profile.txt";
+    constexpr size_t maxRecords = 4;
+    KernelWarmupCache cache(path, maxRecords);
+    for (size_t i = 0; i < 2 * maxRecords; i++) {
+        cache.registerInference({{i}});
+        cache.registerInference({{i}});
+    }
+    ASSERT_EQ(cache.getRecords().size(), maxRecords);
+    const auto records = cache.getRecords(2);
+    ASSERT_EQ(records.size(), 2U);
+    ASSERT_EQ(records[0], KernelWarmupCache::InputShapes{{0}});
+    ASSERT_EQ(records[1], KernelWarmupCache::InputShapes{{1}});
+}
+
+TEST_F(KernelWarmupCacheTest, OneOffShapesDoNotFillProfile) {
+    std::filesystem::create_directories(m_cacheDir);
+    const auto path = std::filesystem::path(m_cacheDir) / "profile.txt";
+    constexpr size_t maxRecords = 4;
+    KernelWarmupCache cache(path, maxRecords);
+    // the one-off shapes are tracked up to the max number of records, the others are not tracked at all
+    for (size_t i = 0; i < 4 * maxRecords; i++) {
+        cache.registerInference({{i}});
+    }
+    ASSERT_TRUE(cache.getRecords().empty());
+
+    cache.registerInference({{2 * maxRecords}});
+    cache.registerInference({{2 * maxRecords}});
+    cache.registerInference({{1}});
+    const auto records = cache.getRecords();
+    ASSERT_EQ(records.size(), 1U);
+    ASSERT_EQ(records[0], KernelWarmupCache::InputShapes{{1}});
+}
+
+TEST_F(KernelWarmupCacheTest, UnexpectedFileIsIgnored) {
+    std::filesystem::create_directories(m_cacheDir);
+    const auto path = std::filesystem::path(m_cacheDir) / "profile.txt";
+    {
+        std::ofstream file(path);
+        file << "garbage\n1,2,3\n";
+    }
+    KernelWarmupCache cache(path);
+    ASSERT_TRUE(cache.getRecords().empty());
+}
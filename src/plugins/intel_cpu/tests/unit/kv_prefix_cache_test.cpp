@@ -0,0 +1,173 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/kernels/scaled_attn/kv_prefix_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <vector>
+
+using ov::Extensions::Cpu::PagedKVPrefixCache;
+using Tokens = std::vector<PagedKVPrefixCache::Token>;
+
+namespace {
+Tokens make_tokens(size_t num, PagedKVPrefixCache::Token first = 0) {
+    Tokens tokens(num);
+    std::iota(tokens.begin(), tokens.end(), first);
+    return tokens;
+}
+}  // namespace
+
+TEST(PagedKVPrefixCacheTest, SharedPrefixIsReused) {
+    PagedKVPrefixCache cache(16, 4);
+    auto prompt0 = make_tokens(10);
+    auto prompt1 = make_tokens(10);
+    prompt1[9] = 100;  // differs in the last partial block only
+
+    const auto seq0 = cache.add_sequence(prompt0.data(), prompt0.size());
+    const auto seq1 = cache.add_sequence(prompt1.data(), prompt1.size());
+    const auto table0 = cache.block_table(seq0);
+    const auto table1 = cache.block_table(seq1);
+    ASSERT_EQ(table0.size(), 3U);
+    ASSERT_EQ(table1.size(), 3U);
+    EXPECT_EQ(table0[0], table1[0]);
+    EXPECT_EQ(table0[1], table1[1]);
+    EXPECT_NE(table0[2], table1[2]);
+    EXPECT_EQ(cache.cached_tokens(seq0), 0U);
+    EXPECT_EQ(cache.cached_tokens(seq1), 8U);
+
+    const auto stats = cache.get_statistics();
+    EXPECT_EQ(stats.reused_blocks, 2U);
+    EXPECT_EQ(stats.computed_blocks, 4U);
+    EXPECT_EQ(stats.free_blocks, 12U);
+    EXPECT_TRUE(cache.take_pending_copies().empty());
+}
+
+TEST(PagedKVPrefixCacheTest, DifferentPrefixIsNotReused) {
+    PagedKVPrefixCache cache(16, 4);
+    auto prompt0 = make_tokens(8);
+    auto prompt1 = make_tokens(8);
+    prompt1[0] = 100;  // the second block has the same tokens but a different prefix
+    cache.add_sequence(prompt0.data(), prompt0.size());
+    const auto seq1 = cache.add_sequence(prompt1.data(), prompt1.size());
+    EXPECT_EQ(cache.cached_tokens(seq1), 0U);
+    EXPECT_EQ(cache.get_statistics().reused_blocks, 0U);
+}
+
+TEST(PagedKVPrefixCacheTest, FullyCachedPromptCopiesLastBlock) {
+    PagedKVPrefixCache cache(16, 4);
+    const auto prompt = make_tokens(8);
+    const auto seq0 = cache.add_sequence(prompt.data(), prompt.size());
+    const auto seq1 = cache.add_sequence(prompt.data(), prompt.size());
+    // the last token is recomputed to produce the logits, so it can't be written into the shared block
+    EXPECT_EQ(cache.cached_tokens(seq1), 7U);
+    const auto table0 = cache.block_table(seq0);
+    const auto table1 = cache.block_table(seq1);
+    EXPECT_EQ(table0[0], table1[0]);
+    EXPECT_NE(table0[1], table1[1]);
+    const auto copies = cache.take_pending_copies();
+    ASSERT_EQ(copies.size(), 1U);
+    EXPECT_EQ(copies[0].src, table0[1]);
+    EXPECT_EQ(copies[0].dst, table1[1]);
+}
+
+TEST(PagedKVPrefixCacheTest, SharedPrefixDiverges) {
+    PagedKVPrefixCache cache(16, 4);
+    const auto prompt = make_tokens(8);
+    const auto seq0 = cache.add_sequence(prompt.data(), prompt.size());
+    const auto seq1 = cache.add_sequence(prompt.data(), prompt.size());
+    const auto shared_block = cache.block_table(seq0)[0];
+    cache.take_pending_copies();
+
+    // the sequences generate the different tokens, the second one writes them after the private copy of the last block
+    const auto tokens0 = make_tokens(4, 100);
+    const auto tokens1 = make_tokens(4, 200);
+    cache.append_tokens(seq0, tokens0.data(), tokens0.size());
+    cache.append_tokens(seq1, tokens1.data(), tokens1.size());
+    const auto table0 = cache.block_table(seq0);
+    const auto table1 = cache.block_table(seq1);
+    ASSERT_EQ(table0.size(), 3U);
+    ASSERT_EQ(table1.size(), 3U);
+    EXPECT_EQ(table1[0], shared_block);
+    EXPECT_NE(table0[1], table1[1]);
+    EXPECT_NE(table0[2], table1[2]);
+
+    // both continuations are chained to the shared prefix
+    auto prompt0 = prompt;
+    prompt0.insert(prompt0.end(), tokens0.begin(), tokens0.end());
+    prompt0.push_back(0);
+    const auto seq2 = cache.add_sequence(prompt0.data(), prompt0.size());
+    EXPECT_EQ(cache.cached_tokens(seq2), 12U);
+    EXPECT_EQ(cache.block_table(seq2)[2], table0[2]);
+
+    auto prompt1 = prompt;
+    prompt1.insert(prompt1.end(), tokens1.begin(), tokens1.end());
+    prompt1.push_back(0);
+    const auto seq3 = cache.add_sequence(prompt1.data(), prompt1.size());
+    EXPECT_EQ(cache.cached_tokens(seq3), 12U);
+    const auto table3 = cache.block_table(seq3);
+    EXPECT_EQ(table3[0], shared_block);
+    EXPECT_EQ(table3[1], table0[1]);
+    EXPECT_EQ(table3[2], table1[2]);
+    EXPECT_TRUE(cache.take_pending_copies().empty());
+}
+
+TEST(PagedKVPrefixCacheTest, ForkCopyOnWrite) {
+    PagedKVPrefixCache cache(16, 4);
+    const auto prompt = make_tokens(6);
+    const auto seq0 = cache.add_sequence(prompt.data(), prompt.size());
+    const auto seq1 = cache.fork(seq0);
+    EXPECT_EQ(cache.block_table(seq0), cache.block_table(seq1));
+
+    const PagedKVPrefixCache::Token token = 42;
+    cache.append_tokens(seq1, &token, 1);
+    const auto table0 = cache.block_table(seq0);
+    const auto table1 = cache.block_table(seq1);
+    EXPECT_EQ(table0[0], table1[0]);
+    EXPECT_NE(table0[1], table1[1]);
+    const auto copies = cache.take_pending_copies();
+    ASSERT_EQ(copies.size(), 1U);
+    EXPECT_EQ(copies[0].src, table0[1]);
+    EXPECT_EQ(copies[0].dst, table1[1]);
+
+    // the block is private now, so no more copies
+    cache.append_tokens(seq1, &token, 1);
+    EXPECT_TRUE(cache.take_pending_copies().empty());
+    EXPECT_EQ(cache.num_tokens(seq1), 8U);
+}
+
+TEST(PagedKVPrefixCacheTest, ReleasedBlocksAreReusedAndEvicted) {
+    PagedKVPrefixCache cache(4, 4);
+    const auto prompt0 = make_tokens(9);
+    const auto seq0 = cache.add_sequence(prompt0.data(), prompt0.size());
+    cache.release(seq0);
+    EXPECT_EQ(cache.get_statistics().free_blocks, 4U);
+
+    // the released full blocks keep their content
+    const auto seq1 = cache.add_sequence(prompt0.data(), prompt0.size());
+    EXPECT_EQ(cache.cached_tokens(seq1), 8U);
+    cache.release(seq1);
+
+    // a different prompt evicts the cached blocks
+    const auto prompt1 = make_tokens(16, 100);
+    cache.add_sequence(prompt1.data(), prompt1.size());
+    EXPECT_EQ(cache.get_statistics().evicted_blocks, 2U);
+    EXPECT_EQ(cache.get_statistics().free_blocks, 0U);
+    EXPECT_ANY_THROW(cache.add_sequence(prompt0.data(), prompt0.size()));
+}
+
+TEST(PagedKVPrefixCacheTest, CopyBlocks) {
+    std::vector<int> data = {0, 0, 1, 1, 2, 2, 3, 3};
+    PagedKVPrefixCache::copy_blocks(data.data(), data.size() * sizeof(int), 4, {{0, 3}, {2, 1}});
+    EXPECT_EQ(data, std::vector<int>({0, 0, 2, 2, 2, 2, 0, 0}));
+    // chained copies are applied in order
+    PagedKVPrefixCache::copy_blocks(data.data(), data.size() * sizeof(int), 4, {{1, 0}, {0, 3}});
+    EXPECT_EQ(data, std::vector<int>({2, 2, 2, 2, 2, 2, 2, 2}));
+    // the block is read by the first copy before it is overwritten by the second one
+    data = {0, 0, 1, 1, 2, 2, 3, 3};
+    PagedKVPrefixCache::copy_blocks(data.data(), data.size() * sizeof(int), 4, {{1, 2}, {3, 1}});
+    EXPECT_EQ(data, std::vector<int>({0, 0, 3, 3, 1, 1, 3, 3}));
+    EXPECT_ANY_THROW(PagedKVPrefixCache::copy_blocks(data.data(), data.size() * sizeof(int), 4, {{0, 4}}));
+}
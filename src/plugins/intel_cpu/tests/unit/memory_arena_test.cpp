@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "memory_arena.hpp"
+
+using namespace ov::intel_cpu;
+
+TEST(IntermediateMemoryArenaTest, ReleasedBufferIsReused) {
+    IntermediateMemoryArena arena;
+    auto buffer = arena.acquire(1024);
+    ASSERT_NE(buffer->getRawPtr(), nullptr);
+    const auto* ptr = buffer->getRawPtr();
+    arena.release(std::move(buffer));
+
+    auto reused = arena.acquire(512);
+    ASSERT_EQ(reused->getRawPtr(), ptr);
+    ASSERT_EQ(arena.allocatedBytes(), 1024U);
+}
+
+TEST(IntermediateMemoryArenaTest, ConcurrentUsersGetDistinctBuffers) {
+    IntermediateMemoryArena arena;
+    auto first = arena.acquire(256);
+    auto second = arena.acquire(256);
+    ASSERT_NE(first->getRawPtr(), second->getRawPtr());
+    ASSERT_EQ(arena.allocatedBytes(), 512U);
+}
+
+TEST(IntermediateMemoryArenaTest, SmallestFittingBufferIsSelected) {
+    IntermediateMemoryArena arena;
+    auto large = arena.acquire(4096);
+    auto small = arena.acquire(1024);
+    const auto* smallPtr = small->getRawPtr();
+    arena.release(std::move(large));
+    arena.release(std::move(small));
+
+    auto buffer = arena.acquire(512);
+    ASSERT_EQ(buffer->getRawPtr(), smallPtr);
+}
+
+TEST(IntermediateMemoryArenaTest, TooSmallBufferIsGrown) {
+    IntermediateMemoryArena arena;
+    arena.release(arena.acquire(256));
+
+    auto buffer = arena.acquire(2048);
+    ASSERT_GE(buffer->size(), 2048U);
+    ASSERT_EQ(arena.allocatedBytes(), 2048U);
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "memory_control.hpp"
+#include "openvino/core/except.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+MemoryRegion variableRegion(int start, int finish, int64_t size, int64_t id) {
+    return {start, finish, size, id, MemoryRegion::RegionType::VARIABLE, MemoryRegion::AllocType::POD};
+}
+
+}  // namespace
+
+TEST(MemoryControlTest, FirstFitPlacesBoxAtLowestFreeOffset) {
+    const std::vector<ov::MemorySolver::Box> boxes = {{0, 1, 4, 0}, {1, 2, 4, 1}, {2, 3, 4, 2}};
+
+    const auto [totalSize, offsets] = solveFirstFit(boxes);
+    ASSERT_EQ(totalSize, 8);
+    ASSERT_EQ(offsets.at(0), 0);
+    ASSERT_EQ(offsets.at(1), 4);
+    // the first box is not alive anymore, so its place is reused
+    ASSERT_EQ(offsets.at(2), 0);
+}
+
+TEST(MemoryControlTest, FirstFitSkipsTooSmallGaps) {
+    const std::vector<ov::MemorySolver::Box> boxes = {{0, 0, 2, 0}, {0, 2, 4, 1}, {1, 2, 3, 2}, {1, 2, 2, 3}};
+
+    const auto [totalSize, offsets] = solveFirstFit(boxes);
+    ASSERT_EQ(totalSize, 9);
+    ASSERT_EQ(offsets.at(1), 2);
+    // the gap left by the first box is too small for the third box, but fits the fourth one
+    ASSERT_EQ(offsets.at(2), 6);
+    ASSERT_EQ(offsets.at(3), 0);
+}
+
+TEST(MemoryControlTest, PlanFitsBudget) {
+    NetworkMemoryControl networkControl(256);
+    auto unit = networkControl.createMemoryControlUnit("main");
+    unit->insert({variableRegion(0, 1, 64, 0), variableRegion(1, 2, 64, 1), variableRegion(2, 3, 64, 2)}, {});
+    unit->solve();
+
+    const auto stats = networkControl.getPlanStatistics();
+    ASSERT_LE(stats.actual_size, 256U);
+    ASSERT_EQ(stats.optimal_size, 128U);
+}
+
+TEST(MemoryControlTest, BudgetBelowLowerBoundFails) {
+    NetworkMemoryControl networkControl(96);
+    auto unit = networkControl.createMemoryControlUnit("main");
+    unit->insert({variableRegion(0, 1, 64, 0), variableRegion(1, 2, 64, 1)}, {});
+
+    ASSERT_THROW(unit->solve(), ov::Exception);
+}
+
+TEST(MemoryControlTest, BudgetIsSharedByControlUnits) {
+    NetworkMemoryControl networkControl(192);
+    auto first = networkControl.createMemoryControlUnit("first");
+    first->insert({variableRegion(0, 1, 64, 0), variableRegion(1, 2, 64, 1)}, {});
+    first->solve();
+
+    // fits the budget alone, but not together with the plan of the first unit
+    auto second = networkControl.createMemoryControlUnit("second");
+    second->insert({variableRegion(0, 1, 64, 2), variableRegion(1, 2, 64, 3)}, {});
+    ASSERT_THROW(second->solve(), ov::Exception);
+}
+
+TEST(MemoryControlTest, UnlimitedBudgetByDefault) {
+    NetworkMemoryControl networkControl;
+    auto first = networkControl.createMemoryControlUnit("first");
+    first->insert({variableRegion(0, 1, 64, 0), variableRegion(1, 2, 64, 1)}, {});
+    first->solve();
+    auto second = networkControl.createMemoryControlUnit("second");
+    second->insert({variableRegion(0, 1, 64, 2), variableRegion(1, 2, 64, 3)}, {});
+    second->solve();
+
+    ASSERT_EQ(networkControl.getPlanStatistics().actual_size, 256U);
+}
@@ -0,0 +1,267 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "dnnl_extension_utils.h"
+#include "memory_desc/dnnl_memory_desc.h"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icore.hpp"
+#include "utils/codec_xor.hpp"
+#include "utils/graph_serializer/deserializer.hpp"
+#include "utils/graph_serializer/serializer.hpp"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace {
+
+class PackedWeightsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        srcDesc = DnnlExtensionUtils::makeDescriptor(
+            dnnl::memory::desc({16, 16}, dnnl::memory::data_type::f32, dnnl::memory::format_tag::ab));
+        dstDesc = DnnlExtensionUtils::makeDescriptor(
+            dnnl::memory::desc({16, 16}, dnnl::memory::data_type::f32, dnnl::memory::format_tag::AB16b16a));
+        weights.resize(16 * 16);
+        for (size_t i = 0; i < weights.size(); i++) {
+            weights[i] = static_cast<float>(i);
+        }
+    }
+
+    // imitates the repacking, which is not important for the cache
+    MemoryPtr pack(const MemoryCPtr& src) const {
+        auto dst = std::make_shared<Memory>(eng, dstDesc);
+        std::memcpy(dst->getData(), src->getData(), dst->getSize());
+        return dst;
+    }
+
+    dnnl::engine eng{dnnl::engine::kind::cpu, 0};
+    DnnlMemoryDescPtr srcDesc;
+    DnnlMemoryDescPtr dstDesc;
+    std::vector<float> weights;
+};
+
+TEST_F(PackedWeightsTest, ImportedWeightsAreNotRepacked) {
+    PackedWeights::Ptr exported;
+    MemoryPtr packed;
+    {
+        auto cache = std::make_shared<WeightsSharing>();
+        auto src = std::make_shared<Memory>(eng, srcDesc, weights.data());
+        cache->registerConstant(src->getData(), "fc_weights");
+        packed = MemoryPtr(*cache->findOrCreatePacked(eng, src, dstDesc, [&] {
+            return pack(src);
+        }));
+
+        exported = std::make_shared<PackedWeights>();
+        cache->collectPackedWeights(*exported);
+        ASSERT_EQ(exported->buffers.size(), 1U);
+    }
+
+    // the same constant in another compiled model lives at another address
+    std::vector<float> weightsCopy = weights;
+    auto cache = std::make_shared<WeightsSharing>();
+    cache->setImportedPackedWeights(exported);
+    auto src = std::make_shared<Memory>(eng, srcDesc, weightsCopy.data());
+    cache->registerConstant(src->getData(), "fc_weights");
+    bool repacked = false;
+    auto imported = MemoryPtr(*cache->findOrCreatePacked(eng, src, dstDesc, [&] {
+        repacked = true;
+        return pack(src);
+    }));
+
+    ASSERT_FALSE(repacked);
+    ASSERT_EQ(imported->getSize(), packed->getSize());
+    ASSERT_EQ(std::memcmp(imported->getData(), packed->getData(), packed->getSize()), 0);
+}
+
+TEST_F(PackedWeightsTest, MappedWeightsAreUsedInPlace) {
+    PackedWeights exported;
+    {
+        auto cache = std::make_shared<WeightsSharing>();
+        auto src = std::make_shared<Memory>(eng, srcDesc, weights.data());
+        cache->registerConstant(src->getData(), "fc_weights");
+        auto packed = MemoryPtr(*cache->findOrCreatePacked(eng, src, dstDesc, [&] {
+            return pack(src);
+        }));
+        cache->collectPackedWeights(exported);
+        ASSERT_EQ(exported.buffers.size(), 1U);
+    }
+    const auto& key = exported.buffers.begin()->first;
+    const auto& buffer = exported.buffers.begin()->second;
+
+    // imitates the mapped blob, the packed weights are aligned in it unless the blob is shifted
+    auto importFromBlob = [&](size_t shift) {
+        auto blob = std::make_shared<ov::AlignedBuffer>(buffer->size() + shift, PackedWeights::alignment);
+        std::memcpy(blob->get_ptr<char>() + shift, buffer->get_ptr(), buffer->size());
+        auto imported = std::make_shared<PackedWeights>();
+        imported->buffers[key] =
+            std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(blob->get_ptr<char>() + shift,
+                                                                                   buffer->size(),
+                                                                                   blob);
+        return imported;
+    };
+
+    for (const size_t shift : {size_t{0}, size_t{4}}) {
+        const auto imported = importFromBlob(shift);
+        const void* mapped = imported->buffers.begin()->second->get_ptr();
+        auto cache = std::make_shared<WeightsSharing>();
+        cache->setImportedPackedWeights(imported);
+        auto src = std::make_shared<Memory>(eng, srcDesc, weights.data());
+        cache->registerConstant(src->getData(), "fc_weights");
+        auto memory = MemoryPtr(*cache->findOrCreatePacked(eng, src, dstDesc, [&] {
+            return pack(src);
+        }));
+
+        ASSERT_EQ(std::memcmp(memory->getData(), buffer->get_ptr(), buffer->size()), 0) << shift;
+        const auto statistics = cache->dumpStatistics();
+        ASSERT_EQ(statistics.total_size, buffer->size()) << shift;
+        if (shift == 0) {
+            // no copy, the weights are read from the blob
+            ASSERT_EQ(memory->getData(), mapped);
+            ASSERT_EQ(statistics.external_size, buffer->size());
+        } else {
+            // the misaligned weights are copied
+            ASSERT_NE(memory->getData(), mapped);
+            ASSERT_EQ(statistics.external_size, 0U);
+        }
+    }
+}
+
+TEST_F(PackedWeightsTest, UnregisteredWeightsAreRepacked) {
+    auto cache = std::make_shared<WeightsSharing>();
+    auto src = std::make_shared<Memory>(eng, srcDesc, weights.data());
+    size_t repacked = 0;
+    auto packed = MemoryPtr(*cache->findOrCreatePacked(eng, src, dstDesc, [&] {
+        repacked++;
+        return pack(src);
+    }));
+    // the memory is shared by the cache
+    auto packedAgain = MemoryPtr(*cache->findOrCreatePacked(eng, src, dstDesc, [&] {
+        repacked++;
+        return pack(src);
+    }));
+
+    ASSERT_EQ(repacked, 1U);
+    ASSERT_EQ(packed, packedAgain);
+    PackedWeights exported;
+    cache->collectPackedWeights(exported);
+    ASSERT_TRUE(exported.buffers.empty());
+}
+
+TEST_F(PackedWeightsTest, AmbiguousConstantNameIsNotExported) {
+    std::vector<float> otherWeights(weights.size(), 1.0F);
+    auto cache = std::make_shared<WeightsSharing>();
+    auto src = std::make_shared<Memory>(eng, srcDesc, weights.data());
+    auto other = std::make_shared<Memory>(eng, srcDesc, otherWeights.data());
+    cache->registerConstant(src->getData(), "weights");
+    cache->registerConstant(other->getData(), "weights");
+
+    auto packed = MemoryPtr(*cache->findOrCreatePacked(eng, src, dstDesc, [&] {
+        return pack(src);
+    }));
+    auto otherPacked = MemoryPtr(*cache->findOrCreatePacked(eng, other, dstDesc, [&] {
+        return pack(other);
+    }));
+
+    PackedWeights exported;
+    cache->collectPackedWeights(exported);
+    ASSERT_TRUE(exported.buffers.empty());
+}
+
+class PackedWeightsSerializationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 16});
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+        model = std::make_shared<ov::Model>(ov::OutputVector{std::make_shared<ov::op::v0::Result>(relu)},
+                                            ov::ParameterVector{param});
+        core = std::make_shared<NiceMock<ov::MockICore>>();
+        ON_CALL(*core, read_model(::testing::An<const std::shared_ptr<ov::AlignedBuffer>&>(), _))
+            .WillByDefault(Return(model));
+
+        packed = std::make_shared<PackedWeights>();
+        packed->isa = "test";
+        // the sizes are not multiple of the alignment, so the buffers are padded
+        const std::vector<std::pair<std::string, size_t>> sizes = {{"first", 100}, {"second", 260}};
+        for (const auto& [key, size] : sizes) {
+            auto buffer = std::make_shared<ov::AlignedBuffer>(size, PackedWeights::alignment);
+            for (size_t i = 0; i < size; i++) {
+                buffer->get_ptr<uint8_t>()[i] = static_cast<uint8_t>(i + key.size());
+            }
+            packed->buffers[key] = buffer;
+        }
+    }
+
+    // the blob is preceded by the prefix, as the plugin blob is preceded by the header of the cache file
+    std::string exportModel() const {
+        std::stringstream stream;
+        stream << std::string(prefixSize, 'x');
+        ModelSerializer serializer(stream, {}, false, packed);
+        serializer << model;
+        return stream.str();
+    }
+
+    void checkImported(const ModelDeserializer& deserializer) const {
+        const auto& imported = deserializer.get_packed_weights();
+        ASSERT_NE(imported, nullptr);
+        ASSERT_EQ(imported->isa, packed->isa);
+        ASSERT_EQ(imported->buffers.size(), packed->buffers.size());
+        for (const auto& [key, buffer] : packed->buffers) {
+            const auto& importedBuffer = imported->buffers.at(key);
+            ASSERT_EQ(importedBuffer->size(), buffer->size());
+            ASSERT_EQ(reinterpret_cast<uintptr_t>(importedBuffer->get_ptr()) % PackedWeights::alignment, 0U) << key;
+            ASSERT_EQ(std::memcmp(importedBuffer->get_ptr(), buffer->get_ptr(), buffer->size()), 0) << key;
+        }
+    }
+
+    static constexpr size_t prefixSize = 5;
+    std::shared_ptr<ov::Model> model;
+    std::shared_ptr<NiceMock<ov::MockICore>> core;
+    PackedWeights::Ptr packed;
+};
+
+TEST_F(PackedWeightsSerializationTest, StreamImport) {
+    std::stringstream stream(exportModel());
+    stream.seekg(prefixSize);
+    ModelDeserializer deserializer(stream, core, CacheDecrypt{}, false);
+    std::shared_ptr<ov::Model> imported;
+    deserializer >> imported;
+
+    checkImported(deserializer);
+}
+
+TEST_F(PackedWeightsSerializationTest, MappedImport) {
+    const auto blob = exportModel();
+    // the mapped file keeps the alignment of the stream the blob was written to
+    auto file = std::make_shared<ov::AlignedBuffer>(blob.size(), PackedWeights::alignment);
+    std::memcpy(file->get_ptr(), blob.data(), blob.size());
+    std::shared_ptr<ov::AlignedBuffer> modelBuffer =
+        std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(file->get_ptr<char>() + prefixSize,
+                                                                               blob.size() - prefixSize,
+                                                                               file);
+    ModelDeserializer deserializer(modelBuffer, core, CacheDecrypt{}, false);
+    std::shared_ptr<ov::Model> imported;
+    deserializer >> imported;
+
+    checkImported(deserializer);
+}
+
+}  // namespace
@@ -2,15 +2,39 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/shared_cache.h"
 #include "common_test_utils/test_assertions.hpp"
 
+// the test values are never modified, so the SharedCache tests may share them between the caches
+namespace ov::intel_cpu {
+template <>
+struct SharedBetweenStreams<std::shared_ptr<int>> : std::true_type {};
+template <>
+struct SharedBetweenStreams<std::shared_ptr<std::string>> : std::true_type {};
+
+// a value owning a dynamically allocated buffer, which is accounted by the byte capacity of the SharedCache
+struct TestBlob {
+    std::vector<char> data;
+};
+
+template <>
+struct CacheFootprint<TestBlob> {
+    static size_t get(const TestBlob& value) {
+        return sizeof(value) + value.data.capacity();
+    }
+};
+}  // namespace ov::intel_cpu
+
 using namespace ov::intel_cpu;
 
 namespace {
@@ -380,3 +404,169 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(SharedCacheTests, GetOrCreate) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int records = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    auto shared = std::make_shared<SharedCache>(1024 * 1024);
+    MultiCache cache0(100, shared);
+    MultiCache cache1(100, shared);
+
+    for (int i = 0; i < records; ++i) {
+        auto intResult = cache0.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_NE(intResult.first, IntValueType());
+        ASSERT_EQ(*intResult.first, i);
+        ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Miss);
+        auto strResult = cache0.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+        ASSERT_NE(strResult.first, StrValueType());
+        ASSERT_EQ(*strResult.first, std::to_string(i));
+        ASSERT_EQ(strResult.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+
+    //the records created by the first cache are visible through the second one
+    for (int i = 0; i < records; ++i) {
+        auto intResult = cache1.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_EQ(*intResult.first, i);
+        ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Hit);
+        auto strResult = cache1.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+        ASSERT_EQ(*strResult.first, std::to_string(i));
+        ASSERT_EQ(strResult.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+
+    const auto stats = shared->getStatistics();
+    ASSERT_EQ(stats.misses, 2U * records);
+    ASSERT_EQ(stats.hits, 2U * records);
+    ASSERT_EQ(stats.evictions, 0U);
+    ASSERT_EQ(stats.records, 2U * records);
+    ASSERT_GT(stats.bytes, 0U);
+}
+
+TEST(SharedCacheTests, StatefulValuesArePerStream) {
+    // the values not allowed by SharedBetweenStreams may keep a state, so they are never shared
+    struct Stateful {
+        int data;
+    };
+    constexpr int records = 10;
+    auto builder = [&](const IntKey& key) { return std::make_shared<Stateful>(Stateful{key.data}); };
+
+    auto shared = std::make_shared<SharedCache>(1024 * 1024);
+    MultiCache cache0(100, shared);
+    MultiCache cache1(100, shared);
+
+    for (int i = 0; i < records; ++i) {
+        auto result0 = cache0.getOrCreate(IntKey{i}, builder);
+        ASSERT_EQ(result0.second, CacheEntryBase::LookUpStatus::Miss);
+        auto result1 = cache1.getOrCreate(IntKey{i}, builder);
+        ASSERT_EQ(result1.second, CacheEntryBase::LookUpStatus::Miss);
+        ASSERT_NE(result0.first, result1.first);
+        // the own storage of the stream still caches the value
+        ASSERT_EQ(cache0.getOrCreate(IntKey{i}, builder).second, CacheEntryBase::LookUpStatus::Hit);
+    }
+
+    const auto stats = shared->getStatistics();
+    ASSERT_EQ(stats.misses + stats.hits, 0U);
+    ASSERT_EQ(stats.records, 0U);
+}
+
+TEST(SharedCacheTests, ByteCapacityEviction) {
+    constexpr int records = 100;
+    constexpr size_t blobSize = 4096;
+    // a single shard to make the eviction order deterministic
+    constexpr size_t capacity = 16 * blobSize;
+    SharedCache cache(capacity, 1);
+
+    auto builder = [&](const IntKey& key) {
+        return std::make_shared<TestBlob>(TestBlob{std::vector<char>(blobSize, static_cast<char>(key.data))});
+    };
+    for (int i = 0; i < records; ++i) {
+        cache.getOrCreate(IntKey{i}, builder);
+        ASSERT_LE(cache.getStatistics().bytes, capacity);
+    }
+
+    auto stats = cache.getStatistics();
+    // the owned buffers are accounted, so the capacity holds less than 16 values
+    ASSERT_GT(stats.records, 0U);
+    ASSERT_LT(stats.records, capacity / blobSize);
+    ASSERT_GT(stats.bytes, stats.records * blobSize);
+    ASSERT_EQ(stats.records + stats.evictions, static_cast<size_t>(records));
+
+    // the most recently used record is kept, the least recently used one is evicted
+    ASSERT_EQ(cache.getOrCreate(IntKey{records - 1}, builder).second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(cache.getOrCreate(IntKey{0}, builder).second, CacheEntryBase::LookUpStatus::Miss);
+
+    // a large value evicts several small ones
+    const auto recordsBefore = cache.getStatistics().records;
+    auto largeBuilder = [&](const IntKey&) {
+        return std::make_shared<TestBlob>(TestBlob{std::vector<char>(8 * blobSize)});
+    };
+    ASSERT_EQ(cache.getOrCreate(IntKey{records}, largeBuilder).second, CacheEntryBase::LookUpStatus::Miss);
+    stats = cache.getStatistics();
+    ASSERT_LE(stats.bytes, capacity);
+    ASSERT_LE(stats.records, recordsBefore - 7);
+}
+
+TEST(SharedCacheTests, Empty) {
+    SharedCache cache(0);
+    auto builder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    for (int i = 0; i < 2; ++i) {
+        auto result = cache.getOrCreate(IntKey{10}, builder);
+        ASSERT_EQ(*result.first, 10);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+    ASSERT_EQ(cache.getStatistics().records, 0U);
+}
+
+TEST(SharedCacheTests, SmokeSingleFlight) {
+    constexpr size_t numThreads = 16;
+    constexpr int keys = 8;
+    constexpr size_t expectedBuilds = keys;
+
+    auto shared = std::make_shared<SharedCache>(1024 * 1024);
+    std::atomic<size_t> builds{0};
+    auto builder = [&](const IntKey& key) {
+        builds++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return std::make_shared<int>(key.data);
+    };
+
+    auto testRoutine = [&]() {
+        MultiCache cache(100, shared);
+        for (int i = 0; i < keys; ++i) {
+            auto result = cache.getOrCreate(IntKey{i}, builder);
+            ASSERT_NE(result.first, nullptr);
+            ASSERT_EQ(*result.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    // concurrent requests of the same key are coalesced, so each value is built only once
+    ASSERT_EQ(builds.load(), expectedBuilds);
+    const auto stats = shared->getStatistics();
+    ASSERT_EQ(stats.misses, expectedBuilds);
+    ASSERT_EQ(stats.hits, numThreads * expectedBuilds - expectedBuilds);
+}
+
+TEST(SharedCacheTests, BuilderException) {
+    SharedCache cache(1024 * 1024);
+    auto throwingBuilder = [&](const IntKey&) -> std::shared_ptr<int> {
+        OPENVINO_THROW("build failure");
+    };
+    auto builder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    ASSERT_THROW(cache.getOrCreate(IntKey{1}, throwingBuilder), ov::Exception);
+    // the failed record is not stored
+    ASSERT_EQ(cache.getOrCreate(IntKey{1}, builder).second, CacheEntryBase::LookUpStatus::Miss);
+}
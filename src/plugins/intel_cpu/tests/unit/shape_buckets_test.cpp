@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "openvino/core/except.hpp"
+#include "shape_buckets.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+IShapeInfer::Result makeResult(const VectorDims& dims) {
+    return {{dims}, ShapeInferStatus::success};
+}
+
+}  // namespace
+
+TEST(ShapeBucketsTest, ZeroCapacityThrows) {
+    ASSERT_THROW(ShapeBuckets(0, 1), ov::Exception);
+}
+
+TEST(ShapeBucketsTest, RecordedResultIsReplayed) {
+    ShapeBuckets buckets(2, 3);
+    const ShapeBuckets::InputShapes shapes{{1, 3, 8, 8}};
+
+    ASSERT_FALSE(buckets.select(shapes));
+    ASSERT_FALSE(buckets.entry(1).has_value());
+    buckets.entry(1) = makeResult({1, 3, 4, 4});
+
+    ASSERT_TRUE(buckets.select(shapes));
+    ASSERT_TRUE(buckets.entry(1).has_value());
+    ASSERT_EQ(buckets.entry(1)->dims.front(), (VectorDims{1, 3, 4, 4}));
+    ASSERT_FALSE(buckets.entry(0).has_value());
+
+    const auto stats = buckets.getStatistics();
+    ASSERT_EQ(stats.hits, 1U);
+    ASSERT_EQ(stats.misses, 1U);
+    ASSERT_EQ(stats.evictions, 0U);
+}
+
+TEST(ShapeBucketsTest, BucketsAreSeparatedByInputShapes) {
+    ShapeBuckets buckets(2, 1);
+
+    ASSERT_FALSE(buckets.select({{1, 16}, {1}}));
+    buckets.entry(0) = makeResult({1, 16});
+    ASSERT_FALSE(buckets.select({{1, 32}, {1}}));
+    ASSERT_FALSE(buckets.entry(0).has_value());
+    buckets.entry(0) = makeResult({1, 32});
+
+    ASSERT_TRUE(buckets.select({{1, 16}, {1}}));
+    ASSERT_EQ(buckets.entry(0)->dims.front(), (VectorDims{1, 16}));
+}
+
+TEST(ShapeBucketsTest, LeastRecentlyUsedBucketIsEvicted) {
+    ShapeBuckets buckets(2, 1);
+    const ShapeBuckets::InputShapes a{{1}};
+    const ShapeBuckets::InputShapes b{{2}};
+    const ShapeBuckets::InputShapes c{{3}};
+
+    ASSERT_FALSE(buckets.select(a));
+    ASSERT_FALSE(buckets.select(b));
+    // a becomes the most recently used one, so b is evicted by c
+    ASSERT_TRUE(buckets.select(a));
+    ASSERT_FALSE(buckets.select(c));
+    ASSERT_TRUE(buckets.select(a));
+    ASSERT_FALSE(buckets.select(b));
+
+    const auto stats = buckets.getStatistics();
+    ASSERT_EQ(stats.hits, 2U);
+    ASSERT_EQ(stats.misses, 4U);
+    ASSERT_EQ(stats.evictions, 2U);
+}
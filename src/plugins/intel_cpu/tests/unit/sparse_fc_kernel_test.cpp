@@ -0,0 +1,173 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nodes/kernels/x64/sparse_fc.hpp"
+#include "nodes/kernels/x64/sparse_fc_weights.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::vector<float> randomData(size_t size, std::mt19937& gen) {
+    std::uniform_real_distribution<float> dist(-1.0F, 1.0F);
+    std::vector<float> data(size);
+    std::generate(data.begin(), data.end(), [&] {
+        return dist(gen);
+    });
+    return data;
+}
+
+// keeps the weights with the given probability
+std::vector<float> unstructuredWeights(size_t N, size_t K, float density, std::mt19937& gen) {
+    auto weights = randomData(N * K, gen);
+    std::bernoulli_distribution keep(density);
+    for (auto& w : weights) {
+        w = keep(gen) ? w : 0.0F;
+    }
+    return weights;
+}
+
+// keeps n random weights of each group of m input channels
+std::vector<float> structuredWeights(size_t N, size_t K, size_t n, size_t m, std::mt19937& gen) {
+    auto weights = randomData(N * K, gen);
+    std::vector<size_t> lanes(m);
+    for (size_t i = 0; i < N; i++) {
+        for (size_t k = 0; k < K; k += m) {
+            std::iota(lanes.begin(), lanes.end(), 0);
+            std::shuffle(lanes.begin(), lanes.end(), gen);
+            for (size_t j = n; j < m; j++) {
+                if (k + lanes[j] < K) {
+                    weights[i * K + k + lanes[j]] = 0.0F;
+                }
+            }
+        }
+    }
+    return weights;
+}
+
+std::vector<uint8_t> packWeights(const std::vector<float>& weights, size_t N, size_t K) {
+    std::vector<uint8_t> packed(SparseFCWeights::packedSize(weights.data(), N, K));
+    SparseFCWeights::pack(weights.data(), N, K, packed.data());
+    return packed;
+}
+
+void checkAgainstDense(const std::vector<float>& weights, size_t M, size_t N, size_t K, std::mt19937& gen) {
+    const auto src = randomData(M * K, gen);
+    const auto bias = randomData(N, gen);
+    const auto packed = packWeights(weights, N, K);
+    const auto view = SparseFCWeights::view(packed.data());
+
+    std::vector<float> srcT(M * K);
+    ov::Extensions::Cpu::XARCH::sparse_fc_transpose(src.data(), K, M, K, srcT.data());
+    for (const auto* transposed : {static_cast<const float*>(nullptr), static_cast<const float*>(srcT.data())}) {
+        std::vector<float> dst(M * N, 0.0F);
+        // the output channels are split to check the partial ranges
+        const auto split = N / 3;
+        const auto* b = bias.data();
+        ov::Extensions::Cpu::XARCH::sparse_fc(view, src.data(), K, transposed, dst.data(), N, b, M, 0, split);
+        ov::Extensions::Cpu::XARCH::sparse_fc(view, src.data(), K, transposed, dst.data(), N, b, M, split, N);
+
+        for (size_t r = 0; r < M; r++) {
+            for (size_t i = 0; i < N; i++) {
+                float expected = bias[i];
+                for (size_t k = 0; k < K; k++) {
+                    expected += src[r * K + k] * weights[i * K + k];
+                }
+                ASSERT_NEAR(dst[r * N + i], expected, 1e-4F) << "row " << r << " channel " << i;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(SparseFCKernelTest, UnstructuredMatchesDense) {
+    std::mt19937 gen(42);
+    for (const size_t K : {16, 64, 100, 257}) {
+        const auto weights = unstructuredWeights(37, K, 0.6F, gen);
+        const auto packed = packWeights(weights, 37, K);
+        ASSERT_EQ(SparseFCWeights::view(packed.data()).format, SparseFCWeights::Format::Unstructured);
+        for (const size_t M : {1, 3, 4, 9, 50}) {
+            checkAgainstDense(weights, M, 37, K, gen);
+        }
+    }
+}
+
+TEST(SparseFCKernelTest, StructuredMatchesDense) {
+    std::mt19937 gen(7);
+    for (const auto& [n, m] : std::vector<std::pair<size_t, size_t>>{{2, 4}, {1, 4}, {2, 8}, {4, 16}, {1, 16}}) {
+        for (const size_t K : {32, 96, 88}) {
+            const auto weights = structuredWeights(21, K, n, m, gen);
+            const auto packed = packWeights(weights, 21, K);
+            const auto view = SparseFCWeights::view(packed.data());
+            ASSERT_EQ(view.format, SparseFCWeights::Format::Structured);
+            // the detected structure is not denser than the generated one
+            ASSERT_LE(view.n * m, n * view.m);
+            for (const size_t M : {1, 5, 8, 35}) {
+                checkAgainstDense(weights, M, 21, K, gen);
+            }
+        }
+    }
+}
+
+TEST(SparseFCKernelTest, ZeroWeightsProduceBias) {
+    std::mt19937 gen(1);
+    const std::vector<float> weights(8 * 48, 0.0F);
+    checkAgainstDense(weights, 2, 8, 48, gen);
+}
+
+// Compares the sparse kernel with the dense weights (all of them are stored) over the sparsity ratios, run with
+// --gtest_also_run_disabled_tests --gtest_filter=*SparseFCKernelBenchmark*
+TEST(SparseFCKernelTest, DISABLED_SparseFCKernelBenchmark) {
+    constexpr size_t N = 1024;
+    constexpr size_t K = 1024;
+    constexpr size_t iterations = 20;
+    std::mt19937 gen(0);
+    const auto dense = packWeights(unstructuredWeights(N, K, 1.0F, gen), N, K);
+
+    const auto measure = [&](const std::vector<uint8_t>& packed, const std::vector<float>& src, size_t M) {
+        const auto view = SparseFCWeights::view(packed.data());
+        std::vector<float> srcT(M * K);
+        std::vector<float> dst(M * N);
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++) {
+            ov::Extensions::Cpu::XARCH::sparse_fc_transpose(src.data(), K, M, K, srcT.data());
+            ov::Extensions::Cpu::XARCH::sparse_fc(view, src.data(), K, srcT.data(), dst.data(), N, nullptr, M, 0, N);
+        }
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() /
+               iterations;
+    };
+
+    for (const size_t M : {1, 16, 64}) {
+        const auto src = randomData(M * K, gen);
+        const auto denseTime = measure(dense, src, M);
+        const auto report = [&](const std::vector<float>& weights, const std::string& pattern) {
+            const auto packed = packWeights(weights, N, K);
+            const auto format = SparseFCWeights::view(packed.data()).format;
+            const auto time = measure(packed, src, M);
+            std::cout << "M=" << M << " " << pattern
+                      << (format == SparseFCWeights::Format::Structured ? " structured " : " unstructured ") << time
+                      << " us, dense " << denseTime << " us (x" << denseTime / time << ")" << std::endl;
+        };
+        for (const float sparsity : {0.5F, 0.7F, 0.9F}) {
+            report(unstructuredWeights(N, K, 1.0F - sparsity, gen), "sparsity=" + std::to_string(sparsity));
+        }
+        for (const auto& [n, m] : std::vector<std::pair<size_t, size_t>>{{2, 4}, {1, 4}, {1, 8}}) {
+            report(structuredWeights(N, K, n, m, gen), std::to_string(n) + ":" + std::to_string(m));
+        }
+    }
+}
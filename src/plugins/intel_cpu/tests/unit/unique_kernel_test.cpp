@@ -0,0 +1,201 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "nodes/common/unique_kernel.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+template <typename T>
+struct UniqueResult {
+    std::vector<T> data;
+    std::vector<int32_t> first;
+    std::vector<int32_t> inToOut;
+    std::vector<int32_t> occurrences;
+};
+
+// straightforward definition of op::v10::Unique
+template <typename T>
+UniqueResult<T> referenceUnique(const std::vector<T>& src, bool sorted) {
+    UniqueResult<T> result;
+    for (size_t i = 0; i < src.size(); i++) {
+        const auto it = std::find(result.data.begin(), result.data.end(), src[i]);
+        if (it == result.data.end()) {
+            result.data.push_back(src[i]);
+            result.first.push_back(static_cast<int32_t>(i));
+            result.occurrences.push_back(1);
+        } else {
+            result.occurrences[it - result.data.begin()]++;
+        }
+    }
+    if (sorted) {
+        std::vector<size_t> order(result.data.size());
+        for (size_t u = 0; u < order.size(); u++) {
+            order[u] = u;
+        }
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return result.data[a] < result.data[b];
+        });
+        UniqueResult<T> sortedResult;
+        for (const auto u : order) {
+            sortedResult.data.push_back(result.data[u]);
+            sortedResult.first.push_back(result.first[u]);
+            sortedResult.occurrences.push_back(result.occurrences[u]);
+        }
+        result = sortedResult;
+    }
+    for (const auto& value : src) {
+        const auto it = std::find(result.data.begin(), result.data.end(), value);
+        result.inToOut.push_back(static_cast<int32_t>(it - result.data.begin()));
+    }
+    return result;
+}
+
+template <typename T>
+UniqueResult<T> runUnique(const std::vector<T>& src, bool sorted, size_t chunks) {
+    UniqueResult<T> result{std::vector<T>(src.size()),
+                           std::vector<int32_t>(src.size()),
+                           std::vector<int32_t>(src.size()),
+                           std::vector<int32_t>(src.size())};
+    const auto uniqueLen = ov::intel_cpu::flattenedUnique(src.data(),
+                                                          src.size(),
+                                                          sorted,
+                                                          result.data.data(),
+                                                          result.first.data(),
+                                                          result.inToOut.data(),
+                                                          result.occurrences.data(),
+                                                          chunks);
+    result.data.resize(uniqueLen);
+    result.first.resize(uniqueLen);
+    result.occurrences.resize(uniqueLen);
+    return result;
+}
+
+template <typename T>
+std::vector<T> randomData(size_t size, size_t distinct, uint32_t seed) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> distribution(0, static_cast<int>(distinct) - 1);
+    std::vector<T> data(size);
+    for (auto& value : data) {
+        // the negative values check the ordering of the signed types
+        value = static_cast<T>(distribution(generator) - static_cast<int>(distinct) / 2);
+    }
+    return data;
+}
+
+template <typename T>
+void checkUnique(const std::vector<T>& src, bool sorted, size_t chunks) {
+    const auto expected = referenceUnique(src, sorted);
+    const auto actual = runUnique(src, sorted, chunks);
+    ASSERT_EQ(actual.data, expected.data);
+    ASSERT_EQ(actual.first, expected.first);
+    ASSERT_EQ(actual.inToOut, expected.inToOut);
+    ASSERT_EQ(actual.occurrences, expected.occurrences);
+}
+
+using UniqueKernelParams = std::tuple<bool /* sorted */, size_t /* chunks */>;
+
+class UniqueKernelTest : public ::testing::TestWithParam<UniqueKernelParams> {};
+
+TEST_P(UniqueKernelTest, Float) {
+    const auto [sorted, chunks] = GetParam();
+    auto data = randomData<float>(3000, 200, 1);
+    // -0 and +0 are the same unique value
+    data[10] = -0.0F;
+    data[20] = 0.0F;
+    checkUnique(data, sorted, chunks);
+}
+
+TEST_P(UniqueKernelTest, Int32) {
+    const auto [sorted, chunks] = GetParam();
+    checkUnique(randomData<int32_t>(3000, 2500, 2), sorted, chunks);
+}
+
+TEST_P(UniqueKernelTest, Int8) {
+    const auto [sorted, chunks] = GetParam();
+    checkUnique(randomData<int8_t>(3000, 250, 3), sorted, chunks);
+}
+
+TEST_P(UniqueKernelTest, UInt8SingleValue) {
+    const auto [sorted, chunks] = GetParam();
+    checkUnique(std::vector<uint8_t>(1000, 7), sorted, chunks);
+}
+
+TEST_P(UniqueKernelTest, OnlyUniqueData) {
+    const auto [sorted, chunks] = GetParam();
+    const auto src = randomData<int32_t>(3000, 100, 4);
+    const auto expected = referenceUnique(src, sorted);
+    std::vector<int32_t> data(src.size());
+    const auto uniqueLen = ov::intel_cpu::flattenedUnique(src.data(),
+                                                          src.size(),
+                                                          sorted,
+                                                          data.data(),
+                                                          nullptr,
+                                                          nullptr,
+                                                          nullptr,
+                                                          chunks);
+    data.resize(uniqueLen);
+    ASSERT_EQ(data, expected.data);
+}
+
+INSTANTIATE_TEST_SUITE_P(UniqueKernel,
+                         UniqueKernelTest,
+                         ::testing::Combine(::testing::Values(true, false), ::testing::Values(1, 3, 8)));
+
+// Unique over the input sizes and the duplicate ratios, it is not a regular test, so it is disabled and is run
+// explicitly: ov_cpu_unit_tests --gtest_filter=*UniqueKernelBenchmark* --gtest_also_run_disabled_tests
+using UniqueBenchmarkParams = std::tuple<size_t /* size */, double /* distinct ratio */>;
+
+class UniqueKernelBenchmark : public ::testing::TestWithParam<UniqueBenchmarkParams> {};
+
+TEST_P(UniqueKernelBenchmark, DISABLED_Throughput) {
+    using Clock = std::chrono::steady_clock;
+    const auto [size, ratio] = GetParam();
+    const auto distinct = std::max<size_t>(static_cast<size_t>(static_cast<double>(size) * ratio), 1);
+    const auto src = randomData<float>(size, distinct, 5);
+    UniqueResult<float> result{std::vector<float>(size),
+                               std::vector<int32_t>(size),
+                               std::vector<int32_t>(size),
+                               std::vector<int32_t>(size)};
+
+    for (const auto sorted : {true, false}) {
+        // single chunk is the serial execution
+        for (const auto chunks : {size_t{1}, size_t{0}}) {
+            constexpr int iterations = 5;
+            const auto start = Clock::now();
+            for (int i = 0; i < iterations; i++) {
+                ov::intel_cpu::flattenedUnique(src.data(),
+                                               size,
+                                               sorted,
+                                               result.data.data(),
+                                               result.first.data(),
+                                               result.inToOut.data(),
+                                               result.occurrences.data(),
+                                               chunks);
+            }
+            const std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+            std::cout << "size: " << size << ", distinct: " << distinct << (sorted ? ", sorted" : ", unsorted")
+                      << (chunks == 1 ? ", serial: " : ", parallel: ") << elapsed.count() / iterations << " ms"
+                      << std::endl;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(UniqueKernelBenchmark,
+                         UniqueKernelBenchmark,
+                         ::testing::Combine(::testing::Values(size_t{1} << 16, size_t{1} << 20, size_t{1} << 24),
+                                            ::testing::Values(0.001, 0.1, 1.0)));
+
+}  // namespace